@@ -0,0 +1,176 @@
+//spectrum analysis helpers for host-side DSM measurements
+
+#pragma once
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#define ANALYSIS_PI 3.14159265358979323846
+
+//blackman-harris 4-term main lobe is +-4 bins wide
+#define ANALYSIS_WINDOW_HALF_WIDTH 4
+
+#define ANALYSIS_MAX_DISTORTION_FREQS 16
+
+typedef struct analysis_result
+{
+    double signalPower;     //mean square of the tones
+    double distortionPower; //mean square of the listed harmonics/intermodulation products
+    double noisePower;      //mean square of everything else in the band
+    double snrDb;           //signal vs noise, distortion excluded
+    double thdnDb;          //distortion + noise vs signal
+    double noiseDbfs;       //noise relative to a full-scale sine
+    double maxSpurDbfs;     //highest single noise bin relative to a full-scale sine, idle tones show up here
+    double maxSpurFreq;
+} analysis_result_t;
+
+//in-place radix-2 complex fft, n must be a power of two
+static void analysis_fft(double* re, double* im, int n)
+{
+    for (int i = 1, j = 0; i < n; ++i)
+    {
+        int bit = n >> 1;
+
+        for (; j & bit; bit >>= 1)
+            j ^= bit;
+
+        j ^= bit;
+
+        if (i < j)
+        {
+            double t = re[i]; re[i] = re[j]; re[j] = t;
+            t = im[i]; im[i] = im[j]; im[j] = t;
+        }
+    }
+
+    for (int len = 2; len <= n; len <<= 1)
+    {
+        double angle = -2 * ANALYSIS_PI / len;
+        double wRe = cos(angle), wIm = sin(angle);
+
+        for (int i = 0; i < n; i += len)
+        {
+            double curRe = 1, curIm = 0;
+
+            for (int j = 0; j < len / 2; ++j)
+            {
+                double *aRe = &re[i + j], *aIm = &im[i + j];
+                double *bRe = &re[i + j + len / 2], *bIm = &im[i + j + len / 2];
+
+                double tRe = *bRe * curRe - *bIm * curIm;
+                double tIm = *bRe * curIm + *bIm * curRe;
+
+                *bRe = *aRe - tRe;
+                *bIm = *aIm - tIm;
+                *aRe += tRe;
+                *aIm += tIm;
+
+                double nextRe = curRe * wRe - curIm * wIm;
+                curIm = curRe * wIm + curIm * wRe;
+                curRe = nextRe;
+            }
+        }
+    }
+}
+
+//windowed one-sided power spectrum, power[0..n/2]
+//normalized so that the bins of a tone sum up to its mean square (A^2/2 for a sine)
+static void analysis_power_spectrum(const double* signal, int n, double* power)
+{
+    double *re = (double*)malloc(sizeof(double) * n),
+           *im = (double*)calloc(n, sizeof(double));
+
+    double windowPower = 0;
+
+    for (int i = 0; i < n; ++i)
+    {
+        double x = 2 * ANALYSIS_PI * i / n;
+        double w = 0.35875 - 0.48829 * cos(x) + 0.14128 * cos(2 * x) - 0.01168 * cos(3 * x);
+
+        re[i] = signal[i] * w;
+        windowPower += w * w;
+    }
+
+    analysis_fft(re, im, n);
+
+    for (int i = 0; i <= n / 2; ++i)
+        power[i] = (re[i] * re[i] + im[i] * im[i]) * (i == 0 || i == n / 2 ? 1 : 2) / (n * windowPower);
+
+    free(re);
+    free(im);
+}
+
+static inline int analysis_bin(double freq, int n, double sampleRate)
+{
+    return (int)(freq * n / sampleRate + 0.5);
+}
+
+static inline double analysis_db(double ratio)
+{
+    return ratio > 0 ? 10 * log10(ratio) : -999;
+}
+
+//splits the band (DC excluded, up to bandHigh) into tones, distortion products and noise
+//full scale is a +-1 sine
+static void analysis_evaluate(const double* power, int n, double sampleRate, double bandHigh,
+    const double* toneFreqs, int toneCount,
+    const double* distortionFreqs, int distortionCount,
+    analysis_result_t* result)
+{
+    int lastBin = analysis_bin(bandHigh, n, sampleRate);
+
+    if (lastBin > n / 2)
+        lastBin = n / 2;
+
+    char* binClass = (char*)calloc(lastBin + 1, 1); //0 noise, 1 tone, 2 distortion
+
+    for (int i = 0; i < distortionCount; ++i)
+    {
+        int center = analysis_bin(distortionFreqs[i], n, sampleRate);
+
+        for (int j = center - ANALYSIS_WINDOW_HALF_WIDTH; j <= center + ANALYSIS_WINDOW_HALF_WIDTH; ++j)
+            if (j >= 0 && j <= lastBin)
+                binClass[j] = 2;
+    }
+
+    for (int i = 0; i < toneCount; ++i)
+    {
+        int center = analysis_bin(toneFreqs[i], n, sampleRate);
+
+        for (int j = center - ANALYSIS_WINDOW_HALF_WIDTH; j <= center + ANALYSIS_WINDOW_HALF_WIDTH; ++j)
+            if (j >= 0 && j <= lastBin)
+                binClass[j] = 1;
+    }
+
+    result->signalPower = result->distortionPower = result->noisePower = 0;
+    result->maxSpurDbfs = -999;
+    result->maxSpurFreq = 0;
+
+    double maxSpur = 0;
+
+    for (int i = ANALYSIS_WINDOW_HALF_WIDTH + 1; i <= lastBin; ++i)
+    {
+        if (binClass[i] == 1)
+            result->signalPower += power[i];
+        else if (binClass[i] == 2)
+            result->distortionPower += power[i];
+        else
+        {
+            result->noisePower += power[i];
+
+            if (power[i] > maxSpur)
+            {
+                maxSpur = power[i];
+                result->maxSpurFreq = i * sampleRate / n;
+            }
+        }
+    }
+
+    free(binClass);
+
+    result->snrDb = analysis_db(result->signalPower / result->noisePower);
+    result->thdnDb = analysis_db((result->distortionPower + result->noisePower) / result->signalPower);
+    result->noiseDbfs = analysis_db(result->noisePower / 0.5);
+    result->maxSpurDbfs = analysis_db(maxSpur / 0.5);
+}
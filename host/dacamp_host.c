@@ -0,0 +1,303 @@
+//runs the real dacamp.c producer/consumer pipeline on a PC:
+//this thread plays tinyUSB and feeds dacamp_pcm_put every 1 ms, core1_worker runs on its own pthread
+//and the mocked PIO drains the fifos at 1.536 MHz. every 1 ms SOF it reads dacamp_get_feedback and sends
+//as many frames as that asks for, like an asynchronous-endpoint host; -n sends the nominal count instead.
+//-c fails (exit 1) when the feedback or the frames sent are off the nominal rate by more than HOST_CHECK_MAX_PPM
+//
+//  dacamp_host [-s scenario] [-t seconds] [-d drift_ppm] [-n] [-p low|normal|safe] [-c]
+//  scenarios: steady48, steady96, underrun, flush, rateswitch, stopstart, all (default)
+
+#define _GNU_SOURCE
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "pico/stdlib.h"
+
+#include "dacamp.h"
+#include "feedback.h"
+#include "pico_mock.h"
+
+#define HOST_MAX_PACKET_FRAMES 128
+
+//  far beyond any crystal and what a loaded host adds with scheduler stalls, a broken feedback value is off by 10%s
+#define HOST_CHECK_MAX_PPM 20000
+
+typedef struct host_stream
+{
+    uint32_t sampleRate;
+    int sampleSize;     //4 for PCM16, 8 for PCM24 like main.c
+    double phase;
+    double driftPpm;    //positive: the host USB frame is shorter than the device millisecond
+    bool feedback;      //frames per packet from dacamp_get_feedback, not from sampleRate
+
+    uint32_t frameNumber;
+    uint32_t feedbackFraction;  //what the host has been asked for but did not send yet, 16.16
+    double feedbackPpm;         //against the nominal rate, summed over the second half of every stream_for
+    int feedbackCount;
+
+    uint64_t framesSent;
+    uint64_t framesAccepted;
+    uint64_t framesNominal;     //what sampleRate / 1000 per packet would have sent
+} host_stream_t;
+
+static bool noFeedback;
+static bool check;
+
+static int16_t volume[3];
+static int8_t mute[3];
+
+static void sleep_until(struct timespec* deadline, uint64_t addNs)
+{
+    deadline->tv_nsec += addNs;
+
+    while (deadline->tv_nsec >= 1000000000)
+    {
+        deadline->tv_nsec -= 1000000000;
+        ++deadline->tv_sec;
+    }
+
+    clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, deadline, NULL);
+}
+
+static int fill_packet(host_stream_t* stream, uint32_t* buf, int frames)
+{
+    double step = 2 * M_PI * 1000 / stream->sampleRate;
+
+    for (int i = 0; i < frames; ++i)
+    {
+        double value = 0.5 * sin(stream->phase);
+        stream->phase += step;
+
+        if (stream->sampleSize == 4)
+        {
+            int16_t pcm = (int16_t)lrint(value * 32767);
+            buf[i] = (uint16_t)pcm | ((uint32_t)(uint16_t)pcm << 16);
+        }
+        else
+        {
+            //24 bit in the top of 32 bit slots
+            uint32_t pcm = (uint32_t)(lrint(value * 8388607) << 8);
+            buf[2 * i] = pcm;
+            buf[2 * i + 1] = pcm;
+        }
+    }
+
+    stream->phase = fmod(stream->phase, 2 * M_PI);
+
+    return frames;
+}
+
+//sends one USB frame worth of audio every millisecond
+static void stream_for(host_stream_t* stream, double seconds)
+{
+    uint32_t buf[2 * HOST_MAX_PACKET_FRAMES];
+
+    struct timespec deadline;
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+
+    uint64_t periodNs = (uint64_t)(1000000 / (1 + stream->driftPpm * 1e-6));
+    int packets = (int)(seconds * 1000);
+
+    for (int p = 0; p < packets; ++p)
+    {
+        int frames = stream->sampleRate / 1000;
+
+        if (stream->feedback)
+        {
+            //SOF, then a packet of what the feedback value adds up to
+            uint32_t value = dacamp_get_feedback(stream->frameNumber++ & 0x7FF);
+
+            stream->feedbackFraction += value;
+            frames = stream->feedbackFraction >> FEEDBACK_FRACTION_BITS;
+            stream->feedbackFraction &= (1 << FEEDBACK_FRACTION_BITS) - 1;
+
+            if (frames > HOST_MAX_PACKET_FRAMES)
+                frames = HOST_MAX_PACKET_FRAMES;
+
+            if (2 * p >= packets)
+            {
+                stream->feedbackPpm += ((double)value * 1000 / ((uint64_t)stream->sampleRate << FEEDBACK_FRACTION_BITS) - 1) * 1e6;
+                ++stream->feedbackCount;
+            }
+        }
+
+        fill_packet(stream, buf, frames);
+
+        stream->framesSent += frames;
+        stream->framesNominal += stream->sampleRate / 1000;
+        stream->framesAccepted += dacamp_pcm_put(buf, frames, stream->sampleSize, volume, mute);
+
+        sleep_until(&deadline, periodNs);
+    }
+}
+
+static void stream_start(host_stream_t* stream, uint32_t sampleRate, int sampleSize)
+{
+    stream->sampleRate = sampleRate;
+    stream->sampleSize = sampleSize;
+
+    //same order as tud_audio_set_itf_cb
+    dacamp_flush();
+    dacamp_start(sampleRate);
+}
+
+//returns false if -c is given and the stream rate is off
+static bool report(const char* name, host_stream_t* stream, uint64_t startNs)
+{
+    pico_mock_stats_t stats;
+    pico_mock_get_stats(&stats);
+
+    double seconds = (pico_mock_time_ns() - startNs) * 1e-9;
+
+    printf("%-11s %5.2f s  frames sent %7llu  rejected %6llu  |", name, seconds,
+        (unsigned long long)stream->framesSent,
+        (unsigned long long)(stream->framesSent - stream->framesAccepted));
+
+    for (int sm = 0; sm < 2; ++sm)
+        printf("  %s: %7llu words, %3llu underruns (%6.2f ms), %3llu overflows", sm ? "R" : "L",
+            (unsigned long long)stats.pioWordsDrained[sm],
+            (unsigned long long)stats.pioUnderruns[sm],
+            stats.pioStallNs[sm] * 1e-6,
+            (unsigned long long)stats.pioOverflows[sm]);
+
+    //core1 falling a lap behind the DMA ring and modulator overloads, both counted since dacamp_init
+    printf("  | ring underruns %lu  overloads %lu", (unsigned long)dacamp_get_pio_underruns(),
+        (unsigned long)dacamp_get_dsm_overloads());
+
+    printf("  | watchdog %llu  | latency %5.2f ms", (unsigned long long)stats.watchdogExpirations, dacamp_get_latency_ns() * 1e-6);
+
+    //the rate the device asked for against the nominal one, about -drift_ppm once settled
+    double feedbackPpm = stream->feedbackCount ? stream->feedbackPpm / stream->feedbackCount : 0;
+    double ratePpm = stream->framesNominal ? ((double)stream->framesSent / stream->framesNominal - 1) * 1e6 : 0;
+
+    if (stream->feedbackCount)
+        printf("  | feedback %+5.0f ppm", feedbackPpm);
+
+    printf("  | frames %+5.0f ppm\n", ratePpm);
+
+    if (check && (fabs(feedbackPpm) > HOST_CHECK_MAX_PPM || fabs(ratePpm) > HOST_CHECK_MAX_PPM))
+    {
+        printf("FAIL %s: feedback or frames sent more than %d ppm off the nominal rate\n", name, HOST_CHECK_MAX_PPM);
+        return false;
+    }
+
+    return true;
+}
+
+static bool run_scenario(const char* name, double seconds, double driftPpm)
+{
+    host_stream_t stream = { .driftPpm = driftPpm, .feedback = !noFeedback };
+
+    dacamp_stop();
+    sleep_ms(20);
+
+    pico_mock_reset_stats();
+    uint64_t startNs = pico_mock_time_ns();
+
+    if (!strcmp(name, "steady48"))
+    {
+        stream_start(&stream, 48000, 4);
+        stream_for(&stream, seconds);
+    }
+    else if (!strcmp(name, "steady96"))
+    {
+        stream_start(&stream, 96000, 8);
+        stream_for(&stream, seconds);
+    }
+    else if (!strcmp(name, "underrun"))
+    {
+        //host stops sending for 50 ms mid-stream
+        stream_start(&stream, 48000, 4);
+        stream_for(&stream, seconds / 2);
+        sleep_ms(50);
+        stream_for(&stream, seconds / 2);
+    }
+    else if (!strcmp(name, "flush"))
+    {
+        stream_start(&stream, 48000, 4);
+        stream_for(&stream, seconds / 2);
+        dacamp_flush();
+        stream_for(&stream, seconds / 2);
+    }
+    else if (!strcmp(name, "rateswitch"))
+    {
+        //same calls as tud_audio_clock_set_request followed by an alt setting change
+        stream_start(&stream, 48000, 4);
+        stream_for(&stream, seconds / 2);
+        dacamp_change_sample_rate(96000);
+        stream_start(&stream, 96000, 8);
+        stream_for(&stream, seconds / 2);
+    }
+    else if (!strcmp(name, "stopstart"))
+    {
+        stream_start(&stream, 48000, 4);
+        stream_for(&stream, seconds / 2);
+        dacamp_stop();
+        sleep_ms(100);
+        stream_start(&stream, 48000, 4);
+        stream_for(&stream, seconds / 2);
+    }
+    else
+    {
+        fprintf(stderr, "unknown scenario %s\n", name);
+        exit(2);
+    }
+
+    return report(name, &stream, startNs);
+}
+
+int main(int argc, char** argv)
+{
+    const char* scenario = "all";
+    double seconds = 2;
+    double driftPpm = 0;
+
+    int opt;
+
+    while ((opt = getopt(argc, argv, "s:t:d:np:c")) != -1)
+    {
+        switch (opt)
+        {
+            case 's': scenario = optarg; break;
+            case 't': seconds = atof(optarg); break;
+            case 'd': driftPpm = atof(optarg); break;
+            case 'n': noFeedback = true; break;
+            case 'c': check = true; break;
+            case 'p':
+                if (!strcmp(optarg, "low"))
+                    dacamp_set_latency_profile(DACAMP_LATENCY_LOW);
+                else if (!strcmp(optarg, "safe"))
+                    dacamp_set_latency_profile(DACAMP_LATENCY_SAFE);
+                else
+                    dacamp_set_latency_profile(DACAMP_LATENCY_NORMAL);
+                break;
+            default:
+                fprintf(stderr, "usage: %s [-s scenario] [-t seconds] [-d drift_ppm] [-n] [-p low|normal|safe] [-c]\n", argv[0]);
+                return 2;
+        }
+    }
+
+    pico_mock_init();
+    dacamp_init();
+
+    bool ok = true;
+
+    if (strcmp(scenario, "all"))
+        ok = run_scenario(scenario, seconds, driftPpm);
+    else
+    {
+        const char* all[] = { "steady48", "steady96", "underrun", "flush", "rateswitch", "stopstart" };
+
+        for (size_t i = 0; i < sizeof(all) / sizeof(all[0]); ++i)
+            ok &= run_scenario(all[i], seconds, driftPpm);
+    }
+
+    dacamp_stop();
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,544 @@
+//host-native DSM benchmark: speed, modeled cortex-m0+ cycles and passband quality of dsm.h
+//
+//  dsm_bench [-d rect|tpdf|highpass] [-i] [-l depth] [-o order] [-t percent]
+//
+//  -d      dither of dither.h, rect by default
+//  -o      modulator order of dsm.h, 2..5, 4 by default
+//  -t      transition penalty of dsm_set_transition_penalty in percent of _DSM_INT_MAX, off by default
+//  -l      look-ahead depth of dsm_set_lookahead, off by default. also sweeps the usable input range with and without it
+//  -i      16/48 goes through the halfband.h 2x interpolator and the x16 modulator path like the firmware does,
+//          instead of the x32 path with only its own linear interpolation
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "dsm.h" //built with DSM_INTEGRATOR_METRICS, see CMakeLists.txt
+#include "dither.h"
+#include "halfband.h"
+
+#include "analysis.h"
+#include "dsm_bench.h"
+
+#define BENCH_OUTPUT_RATE       1536000.0
+#define BENCH_OUTPUT_SAMPLES    (1 << 18)   //5.86 Hz bins
+#define BENCH_WARMUP_FRAMES     2048
+#define BENCH_BAND_HIGH         20000.0
+
+//mirrors hbridge.pio: a changed output state starts with a dead time gap
+#define BENCH_T_PULSE_CLOCKS    25
+#define BENCH_T_DEAD_CLOCKS     4
+
+#define BENCH_CORE1_CLOCK       192000000.0
+
+#define BENCH_DITHER_BLOCK      8 //words per dither_fill, like core1
+
+static dither_mode_t ditherMode = DITHER_RECTANGULAR;
+static bool halfband48k = false;
+static const dsm_kernel_t* kernel;
+static int32_t transitionPenalty = 0;
+static int lookahead = 0;
+static const uint32_t ditherSeed[4] = { 0xC0FFEE, 0x1BADB002, 0xDEADBEEF, 0x0DDBA11 };
+
+typedef struct bench_test
+{
+    const char* name;
+    double amplitude[2];    //relative to PCM full scale
+    double freq[2];         //snapped to bin centers
+    int toneCount;
+} bench_test_t;
+
+//average bridge output over one symbol period, +-1 is full scale
+static inline double symbol_level(uint32_t symbol, uint32_t prevSymbol)
+{
+    double level = symbol == 0b01 ? 1 : symbol == 0b10 || symbol == 0b11 ? -1 : 0;
+
+    if (symbol != prevSymbol)
+        level *= (double)(BENCH_T_PULSE_CLOCKS - BENCH_T_DEAD_CLOCKS) / BENCH_T_PULSE_CLOCKS;
+
+    return level;
+}
+
+//  the same for _halfband_push per channel sample: two history loads, add, asr, coefficient load, muls, add per pair,
+// plus the two history stores, the index and the final shift
+#define _M0_HALFBAND_PER_PAIR       10
+#define _M0_HALFBAND_OVERHEAD       16
+
+//  rough cortex-m0+ cost of _dsm_calculate as gcc -O3 lays it out with only 8 low registers:
+// integrators and prevOutput get loaded and stored every iteration,
+// ALU ops are 1 cycle, loads/stores 2, taken branches 2 and not taken 1
+// the per-integrator part scales with the order, order 4 is what the constants were fitted to
+#define _M0_ALU_OPS_PER_SYMBOL(order)   (11 + 3 * (order))  //quantizer sum, compares, integrator updates, output packing, interpolation step
+#define _M0_MEM_OPS_PER_SYMBOL(order)   (3 + 2 * (order))   //integrator loads + stores, prevOutput load + store, quantizer level literal
+#define _M0_OVERHEAD_PER_SAMPLE     40  //call, interpolation setup, dither extraction, 64 bit return
+#define _M0_OVERLOAD_CHECK(order)   (3 + 5 * (order)) //per 16 symbols: integrator loads, quantizer sum, unsigned compares
+
+//  look-ahead: two runs of depth + 1 symbols on a copy of the state, each a word copy of dsm_t, then the chosen symbol.
+// the runs pay the plain symbol cost with an average decision, the cost sum is a 32x32->64 multiply in ~4 muls plus adds
+#define _M0_LOOKAHEAD_COPY(order)       (4 * ((order) + 4))  //ldm/stm would do better, gcc does not use them for structs this size
+#define _M0_LOOKAHEAD_COST_PER_SYMBOL   (3 + 12)            //error, squaring, 64 bit accumulate
+#define _M0_LOOKAHEAD_PER_SYMBOL(order, depth) \
+    (2 * _M0_LOOKAHEAD_COPY(order) + 2 * ((depth) + 1) * (_M0_ALU_OPS_PER_SYMBOL(order) + 2 * _M0_MEM_OPS_PER_SYMBOL(order) + 5 + _M0_LOOKAHEAD_COST_PER_SYMBOL))
+
+static double model_m0_cycles_per_sample(const uint64_t* words, int count, int symbolsPerWord, int depth)
+{
+    uint64_t cycles = 0;
+    uint32_t prev = 0b11;
+
+    for (int i = 0; i < count; ++i)
+    {
+        cycles += _M0_OVERHEAD_PER_SAMPLE + 2 * _M0_OVERLOAD_CHECK(kernel->order);
+
+        for (int s = 0; s < 32; ++s)
+        {
+            uint32_t symbol = (uint32_t)(words[i] >> (62 - 2 * s)) & 0b11;
+
+            cycles += _M0_ALU_OPS_PER_SYMBOL(kernel->order) + 2 * _M0_MEM_OPS_PER_SYMBOL(kernel->order);
+
+            if (depth)
+                cycles += _M0_LOOKAHEAD_PER_SYMBOL(kernel->order, depth);
+            cycles += symbol == 0b10 ? 1 + 2 : symbol == 0b01 ? 2 + 1 + 2 : 2 + 2; //minus, plus and zero compares, jumps to the end
+            cycles += symbol != prev ? 2 : 1;        //short pulse select
+
+            prev = symbol;
+        }
+    }
+
+    //per input sample of one channel
+    return (double)cycles / count * symbolsPerWord / 32;
+}
+
+#ifdef DSM_M0_BIN_PATH
+#define BENCH_M0_FRAMES 2048 //m0_model is slow, a few thousand blocks give a steady average
+
+double dsm_m0_glue_cycles_per_block(const int32_t* dsmPcm, int frames);
+#endif
+
+//  M0+ cycles per input sample of one channel. order 4 without penalty and look-ahead is dsm_m0.S on the device:
+// when an ARM assembler was found its blocks are run in m0_model (dsm_m0_glue.c) and only the C wrapper around
+// them is estimated, measured tells. everything else is the model_m0_cycles_per_sample estimate
+static double m0_cycles_per_sample(const int32_t* dsmPcm, int frames, const uint64_t* words, int count,
+                                   int symbolsPerWord, int depth, bool* measured)
+{
+#ifdef DSM_M0_BIN_PATH
+    if (kernel->order == 4 && !transitionPenalty && !depth)
+    {
+        double block = dsm_m0_glue_cycles_per_block(dsmPcm, frames < BENCH_M0_FRAMES ? frames : BENCH_M0_FRAMES);
+
+        *measured = true;
+        return (2 * block + _M0_OVERHEAD_PER_SAMPLE + 2 * _M0_OVERLOAD_CHECK(4)) * symbolsPerWord / 32;
+    }
+#endif
+
+    *measured = false;
+    return model_m0_cycles_per_sample(words, count, symbolsPerWord, depth);
+}
+
+static int32_t pcm_to_dsm(double value, bool pcm24)
+{
+    if (value > 1)
+        value = 1;
+    else if (value < -1)
+        value = -1;
+
+    if (pcm24)
+        return DSM_INT24_TO_INT32((int32_t)lrint(value * 8388607));
+
+    return DSM_INT16_TO_INT32((int16_t)lrint(value * 32767));
+}
+
+//48 kHz pcm of one channel to 96 kHz, through halfband.h with the other channel silent
+static int32_t* interpolate_pcm(const int32_t* pcm, int frames)
+{
+    uint64_t* stereo = (uint64_t*)malloc(sizeof(uint64_t) * 2 * frames);
+    int32_t* out = (int32_t*)malloc(sizeof(int32_t) * 2 * frames);
+
+    for (int i = 0; i < frames; ++i)
+        stereo[frames + i] = PCM_DSM_FRAME(pcm[i], 0);
+
+    halfband_t halfband;
+    halfband_init(&halfband);
+    halfband_process(&halfband, stereo, stereo + frames, frames);
+
+    for (int i = 0; i < 2 * frames; ++i)
+        out[i] = PCM_DSM_LEFT(stereo[i]);
+
+    free(stereo);
+
+    return out;
+}
+
+//tone power around freq, the window main lobe
+static double tone_power(const double* power, double freq)
+{
+    int center = analysis_bin(freq, BENCH_OUTPUT_SAMPLES, BENCH_OUTPUT_RATE);
+    double sum = 0;
+
+    for (int j = center - ANALYSIS_WINDOW_HALF_WIDTH; j <= center + ANALYSIS_WINDOW_HALF_WIDTH; ++j)
+        sum += power[j];
+
+    return sum;
+}
+
+static int32_t* generate_pcm(const bench_test_t* test, int frames, double sampleRate, bool pcm24)
+{
+    int32_t* pcm = (int32_t*)malloc(sizeof(int32_t) * frames);
+
+    for (int i = 0; i < frames; ++i)
+    {
+        double value = 0;
+
+        for (int t = 0; t < test->toneCount; ++t)
+            value += test->amplitude[t] * sin(2 * ANALYSIS_PI * test->freq[t] * i / sampleRate);
+
+        pcm[i] = pcm_to_dsm(value, pcm24);
+    }
+
+    return pcm;
+}
+
+//runs the modulator over pcm and converts the analysed part into bridge levels
+static void run_dsm(dsm_t* dsm, const int32_t* pcm, int frames, bool sampleRate96k, double* levels, uint64_t* words)
+{
+    dither_t dither;
+    dither_init(&dither, ditherSeed, ditherMode);
+
+    uint32_t random[BENCH_DITHER_BLOCK];
+    uint32_t prevSymbol = 0b11;
+    int wordIdx = 0;
+
+    int step = sampleRate96k ? 2 : 1;
+
+    for (int i = 0, n = 0; i + step <= frames; i += step, ++n)
+    {
+        if (n % BENCH_DITHER_BLOCK == 0)
+            dither_fill(&dither, 0, random, BENCH_DITHER_BLOCK);
+
+        uint64_t word = sampleRate96k
+            ? kernel->sample_x16(dsm, pcm[i], pcm[i + 1], random[n % BENCH_DITHER_BLOCK])
+            : kernel->sample_x32(dsm, pcm[i], random[n % BENCH_DITHER_BLOCK]);
+
+        if (i < BENCH_WARMUP_FRAMES)
+            continue;
+
+        for (int s = 0; s < 32; ++s)
+        {
+            uint32_t symbol = (uint32_t)(word >> (62 - 2 * s)) & 0b11;
+
+            levels[wordIdx * 32 + s] = symbol_level(symbol, prevSymbol);
+            prevSymbol = symbol;
+        }
+
+        words[wordIdx++] = word;
+    }
+}
+
+//share of symbols in the bridge zero state and bridge state changes per second, what the gate drivers pay for
+static void count_states(const uint64_t* words, int count, double* zeroShare, double* transitionsPerSecond)
+{
+    int zeros = 0, transitions = 0;
+    uint32_t prevSymbol = (uint32_t)(words[0] >> 62);
+
+    for (int i = 0; i < count; ++i)
+        for (int s = 0; s < 32; ++s)
+        {
+            uint32_t symbol = (uint32_t)(words[i] >> (62 - 2 * s)) & 0b11;
+
+            zeros += symbol == 0b00;
+            transitions += symbol != prevSymbol;
+            prevSymbol = symbol;
+        }
+
+    *zeroShare = (double)zeros / (count * 32);
+    *transitionsPerSecond = (double)transitions / (count * 32) * BENCH_OUTPUT_RATE;
+}
+
+static void run_test(const bench_test_t* test, bool sampleRate96k)
+{
+    double sampleRate = sampleRate96k ? 96000 : 48000;
+    bool pcm24 = sampleRate96k; //16/48 and 24/96 are the two common host setups
+
+    int wordCount = BENCH_OUTPUT_SAMPLES / 32;
+    int frames = BENCH_WARMUP_FRAMES + wordCount * (sampleRate96k ? 2 : 1);
+
+    int32_t* pcm = generate_pcm(test, frames, sampleRate, pcm24);
+
+    //the modulator input: interpolated 48 kHz runs the 96 kHz path over twice the frames, warmup twice as long
+    bool interpolate = halfband48k && !sampleRate96k;
+    int32_t* dsmPcm = interpolate ? interpolate_pcm(pcm, frames) : pcm;
+    int dsmFrames = interpolate ? 2 * frames - BENCH_WARMUP_FRAMES : frames;
+    int dsmFramesPerSample = interpolate ? 2 : 1;
+
+    if (interpolate)
+        dsmPcm += BENCH_WARMUP_FRAMES;
+
+    double* levels = (double*)malloc(sizeof(double) * BENCH_OUTPUT_SAMPLES);
+    double* power = (double*)malloc(sizeof(double) * (BENCH_OUTPUT_SAMPLES / 2 + 1));
+    uint64_t* words = (uint64_t*)malloc(sizeof(uint64_t) * wordCount);
+
+    dsm_t dsm;
+    memset(&dsm, 0, sizeof(dsm));
+    dsm_init(&dsm);
+    dsm_set_transition_penalty(&dsm, transitionPenalty);
+    dsm_set_lookahead(&dsm, lookahead);
+
+    run_dsm(&dsm, dsmPcm, dsmFrames, sampleRate96k || interpolate, levels, words);
+
+    analysis_power_spectrum(levels, BENCH_OUTPUT_SAMPLES, power);
+
+    double distortion[ANALYSIS_MAX_DISTORTION_FREQS];
+    int distortionCount = 0;
+
+    if (test->toneCount == 1)
+        for (int h = 2; h <= 9 && h * test->freq[0] <= BENCH_BAND_HIGH; ++h)
+            distortion[distortionCount++] = h * test->freq[0];
+    else if (test->toneCount == 2)
+    {
+        double f1 = test->freq[0], f2 = test->freq[1];
+
+        distortion[distortionCount++] = f2 - f1;
+        distortion[distortionCount++] = 2 * f1 - f2;
+        if (2 * f2 - f1 <= BENCH_BAND_HIGH)
+            distortion[distortionCount++] = 2 * f2 - f1;
+    }
+
+    analysis_result_t result;
+    analysis_evaluate(power, BENCH_OUTPUT_SAMPLES, BENCH_OUTPUT_RATE, BENCH_BAND_HIGH,
+        test->freq, test->toneCount, distortion, distortionCount, &result);
+
+    //per input sample of one channel, the halfband runs on core0
+    double ns = dsm_bench_ns_per_sample(kernel->order, transitionPenalty, lookahead, dsmPcm, dsmFrames, 16, sampleRate96k || interpolate) * dsmFramesPerSample;
+    bool measured;
+    double cycles = m0_cycles_per_sample(dsmPcm, dsmFrames, words, wordCount, sampleRate96k || interpolate ? 16 : 32, lookahead,
+        &measured) * dsmFramesPerSample;
+
+    //stereo load of core1 from those cycles
+    double load = cycles * 2 * sampleRate / BENCH_CORE1_CLOCK * 100;
+
+    if (test->toneCount)
+        printf("%-18s %s  SNR %7.2f dB  THD+N %7.2f dB", test->name, sampleRate96k ? "24/96" : "16/48", result.snrDb, result.thdnDb);
+    else
+        printf("%-18s %s  noise %5.1f dBFS  ", test->name, sampleRate96k ? "24/96" : "16/48", result.noiseDbfs);
+
+    printf("  max spur %7.2f dBFS @ %7.0f Hz  %6.1f ns/sample  %5.0f M0+ cycles/sample (%3.0f%% core1, %s)\n",
+        result.maxSpurDbfs, result.maxSpurFreq, ns, cycles, load, measured ? "dsm_m0.S measured" : "est.");
+
+    //images of the tone around the input rate, what the interpolation leaves for the modulator to handle
+    if (test->toneCount == 1)
+        printf("    image @ %5.0f Hz %7.2f dBc", sampleRate - test->freq[0],
+            analysis_db(tone_power(power, sampleRate - test->freq[0]) / tone_power(power, test->freq[0])));
+
+    if (interpolate)
+        printf("    halfband on core0: %5.1f ns/sample  %3d M0+ cycles/sample",
+            halfband_bench_ns_per_sample(pcm, frames), _M0_HALFBAND_OVERHEAD + _M0_HALFBAND_PER_PAIR * HALFBAND_PAIRS);
+
+    if (test->toneCount == 1 || interpolate)
+        printf("\n");
+
+    printf("    integrators min/max:");
+    for (int i = 0; i < kernel->order; ++i)
+        printf(" [%d, %d]", dsm.integratorMin[i], dsm.integratorMax[i]);
+    double zeroShare, transitionsPerSecond;
+    count_states(words, wordCount, &zeroShare, &transitionsPerSecond);
+
+    printf("  quantizer: [%d, %d]  overloads %u\n", dsm.quantizerMin, dsm.quantizerMax, dsm.overloads);
+    printf("    zero state %5.1f%%  %6.0f k transitions/s\n", 100 * zeroShare, transitionsPerSecond / 1000);
+
+    if (interpolate)
+        free(dsmPcm - BENCH_WARMUP_FRAMES);
+
+    free(pcm);
+    free(levels);
+    free(power);
+    free(words);
+}
+
+//  highest 1 kHz level at 16/48 the loop stays within the dsm_search limits for, the modulator input taken up
+// to _DSM_INT_MAX past the 45/64 of DSM_INT24_TO_INT32. SNR is taken at that level
+#define BENCH_RANGE_LIMIT_QUANTIZER     (1 << 26)
+#define BENCH_RANGE_LIMIT_INTEGRATOR    0x70000000
+#define BENCH_RANGE_STEP_DB             0.25
+
+static bool run_range_level(double amplitude, int depth, double freq, int32_t* pcm, uint64_t* words, double* snrDb)
+{
+    int wordCount = BENCH_OUTPUT_SAMPLES / 32;
+    double* levels = (double*)malloc(sizeof(double) * BENCH_OUTPUT_SAMPLES);
+    bool stable = true;
+
+    dsm_t dsm;
+    memset(&dsm, 0, sizeof(dsm));
+    dsm_init(&dsm);
+    dsm_set_transition_penalty(&dsm, transitionPenalty);
+    dsm_set_lookahead(&dsm, depth);
+
+    uint32_t random = ditherSeed[0];
+    uint32_t prevSymbol = 0b11;
+
+    for (int i = 0; i < BENCH_WARMUP_FRAMES + wordCount && stable; ++i)
+    {
+        random = bench_xorshift32(random);
+
+        double sample = amplitude * DSM_INT24_TO_INT32(0x7FFFFF) * sin(2 * ANALYSIS_PI * freq * i / 48000);
+
+        pcm[i] = (int32_t)lrint(fmin(fmax(sample, -_DSM_INT_MAX), _DSM_INT_MAX));
+
+        uint64_t word = kernel->sample_x32(&dsm, pcm[i], random);
+
+        stable = dsm.quantizerMax <= BENCH_RANGE_LIMIT_QUANTIZER && dsm.quantizerMin >= -BENCH_RANGE_LIMIT_QUANTIZER;
+
+        for (int j = 0; j < kernel->order; ++j)
+            stable = stable && dsm.integratorMax[j] <= BENCH_RANGE_LIMIT_INTEGRATOR && dsm.integratorMin[j] >= -BENCH_RANGE_LIMIT_INTEGRATOR;
+
+        if (i < BENCH_WARMUP_FRAMES)
+            continue;
+
+        words[i - BENCH_WARMUP_FRAMES] = word;
+
+        for (int s = 0; s < 32; ++s)
+        {
+            uint32_t symbol = (uint32_t)(word >> (62 - 2 * s)) & 0b11;
+
+            levels[(i - BENCH_WARMUP_FRAMES) * 32 + s] = symbol_level(symbol, prevSymbol);
+            prevSymbol = symbol;
+        }
+    }
+
+    if (stable)
+    {
+        double* power = (double*)malloc(sizeof(double) * (BENCH_OUTPUT_SAMPLES / 2 + 1));
+        analysis_result_t result;
+
+        analysis_power_spectrum(levels, BENCH_OUTPUT_SAMPLES, power);
+        analysis_evaluate(power, BENCH_OUTPUT_SAMPLES, BENCH_OUTPUT_RATE, BENCH_BAND_HIGH, &freq, 1, NULL, 0, &result);
+
+        *snrDb = result.snrDb;
+        free(power);
+    }
+
+    free(levels);
+
+    return stable;
+}
+
+//time and cycles are taken at the highest stable level
+static void run_range(int depth, double freq)
+{
+    int wordCount = BENCH_OUTPUT_SAMPLES / 32;
+    int32_t* pcm = (int32_t*)malloc(sizeof(int32_t) * (BENCH_WARMUP_FRAMES + wordCount));
+    uint64_t* words = (uint64_t*)malloc(sizeof(uint64_t) * wordCount);
+
+    //0 dBFS is the largest PCM sample, _DSM_INT_MAX is ~+3 dB above it
+    double maxDb = 20 * log10((double)_DSM_INT_MAX / DSM_INT24_TO_INT32(0x7FFFFF));
+    double stableDb = -INFINITY, snrDb = 0, ns = 0, cycles = 0;
+    bool measured = false;
+
+    for (double db = -6; db <= maxDb; db += BENCH_RANGE_STEP_DB)
+    {
+        double snr;
+
+        if (!run_range_level(pow(10, db / 20), depth, freq, pcm, words, &snr))
+            break;
+
+        stableDb = db;
+        snrDb = snr;
+        ns = dsm_bench_ns_per_sample(kernel->order, transitionPenalty, depth, pcm, BENCH_WARMUP_FRAMES + wordCount, 1, false);
+        cycles = m0_cycles_per_sample(pcm, BENCH_WARMUP_FRAMES + wordCount, words, wordCount, 32, depth, &measured);
+    }
+
+    if (stableDb == -INFINITY)
+        printf("look-ahead %d  unstable from -6 dBFS\n", depth);
+    else
+        printf("look-ahead %d  stable up to %+5.2f dBFS (%5.1f%% of _DSM_INT_MAX)  SNR there %6.2f dB  %7.1f ns/sample  %6.0f M0+ cycles/sample (%s)\n",
+            depth, stableDb, 100 * pow(10, stableDb / 20) * DSM_INT24_TO_INT32(0x7FFFFF) / _DSM_INT_MAX, snrDb, ns, cycles,
+            measured ? "dsm_m0.S measured" : "est.");
+
+    free(pcm);
+    free(words);
+}
+
+static double bin_center(double freq)
+{
+    double bin = BENCH_OUTPUT_RATE / BENCH_OUTPUT_SAMPLES;
+
+    return round(freq / bin) * bin;
+}
+
+int main(int argc, char** argv)
+{
+    static const char* ditherNames[] = { "rect", "tpdf", "highpass" };
+
+    kernel = dsm_kernel(4);
+
+    for (int i = 1; i < argc; ++i)
+    {
+        bool known = false;
+
+        if (!strcmp(argv[i], "-o") && i + 1 < argc)
+        {
+            int order = atoi(argv[++i]);
+
+            kernel = dsm_kernel(order);
+            known = kernel->order == order;
+        }
+        else if (!strcmp(argv[i], "-t") && i + 1 < argc)
+        {
+            transitionPenalty = (int32_t)(atof(argv[++i]) / 100 * _DSM_INT_MAX);
+            known = transitionPenalty >= 0;
+        }
+        else if (!strcmp(argv[i], "-l") && i + 1 < argc)
+        {
+            lookahead = atoi(argv[++i]);
+            known = lookahead >= 1 && lookahead <= DSM_MAX_LOOKAHEAD;
+        }
+        else if (!strcmp(argv[i], "-i"))
+        {
+            halfband48k = true;
+            known = true;
+        }
+        else if (!strcmp(argv[i], "-d") && i + 1 < argc)
+        {
+            ++i;
+
+            for (int m = 0; m < 3; ++m)
+                if (!strcmp(argv[i], ditherNames[m]))
+                {
+                    ditherMode = (dither_mode_t)m;
+                    known = true;
+                }
+        }
+
+        if (!known)
+        {
+            printf("usage: %s [-d rect|tpdf|highpass] [-i] [-l depth] [-o order] [-t percent]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    bench_test_t tests[] = {
+        { "sine 1k -6dB",     { 0.5 },          { bin_center(1000) },                       1 },
+        { "sine 1k -60dB",    { 0.001 },        { bin_center(1000) },                       1 },
+        { "sine 1k full",     { 1.0 },          { bin_center(1000) },                       1 },
+        { "sine 10k full",    { 1.0 },          { bin_center(10000) },                      1 },
+        { "two-tone 19k+20k", { 0.5, 0.5 },     { bin_center(19000), bin_center(20000) },   2 },
+        { "silence",          { 0 },            { 0 },                                      0 },
+    };
+
+    printf("passband 20 Hz - %.0f kHz, full scale is a +-1 bridge output sine\n", BENCH_BAND_HIGH / 1000);
+    printf("order %d, transition penalty %.0f%%, look-ahead %d, dither %s, %.2f ns/word to generate\n", kernel->order,
+        100.0 * transitionPenalty / _DSM_INT_MAX, lookahead, ditherNames[ditherMode], dither_bench_ns_per_word(ditherMode, 1 << 22));
+    printf("16/48 %s\n", halfband48k ? "through the halfband.h interpolator, x16 modulator" : "x32 modulator, linear interpolation only");
+
+    for (int r = 0; r < 2; ++r)
+        for (size_t i = 0; i < sizeof(tests) / sizeof(tests[0]); ++i)
+            run_test(&tests[i], r == 1);
+
+    if (lookahead)
+    {
+        printf("\nusable input range, 1 kHz at 16/48 x32 in %.2f dB steps\n", BENCH_RANGE_STEP_DB);
+        run_range(0, bin_center(1000));
+        run_range(lookahead, bin_center(1000));
+    }
+
+    return 0;
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+static inline uint32_t bench_xorshift32(uint32_t x)
+{
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return x;
+}
+
+//wall clock ns per input sample (one channel), dsmPcm is already scaled with DSM_INTxx_TO_INT32
+double dsm_bench_ns_per_sample(int order, int32_t transitionPenalty, int lookahead, const int32_t* dsmPcm, int frames, int repeat, bool sampleRate96k);
+
+//wall clock ns per dither word of dither.h, generated in core1 sized blocks
+double dither_bench_ns_per_word(int mode, int words);
+
+//wall clock ns per channel sample of halfband.h, pcm is one channel of DSM input at 48 kHz
+double halfband_bench_ns_per_sample(const int32_t* pcm, int frames);
@@ -0,0 +1,110 @@
+//timing loops live in a separate translation unit so dsm.h is compiled here without DSM_INTEGRATOR_METRICS
+
+#include <stdint.h>
+#include <time.h>
+
+#include "dsm.h"
+#include "dither.h"
+#include "halfband.h"
+
+#include "dsm_bench.h"
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+volatile uint64_t dsmBenchSink;
+
+double dsm_bench_ns_per_sample(int order, int32_t transitionPenalty, int lookahead, const int32_t* dsmPcm, int frames, int repeat, bool sampleRate96k)
+{
+    const dsm_kernel_t* kernel = dsm_kernel(order);
+
+    dsm_t dsm;
+    dsm_init(&dsm);
+    dsm_set_transition_penalty(&dsm, transitionPenalty);
+    dsm_set_lookahead(&dsm, lookahead);
+
+    uint32_t random = 0x12345678;
+    uint64_t acc = 0;
+
+    double start = now_ns();
+
+    for (int r = 0; r < repeat; ++r)
+    {
+        if (sampleRate96k)
+            for (int i = 0; i + 1 < frames; i += 2)
+            {
+                random = bench_xorshift32(random);
+                acc ^= kernel->sample_x16(&dsm, dsmPcm[i], dsmPcm[i + 1], random);
+            }
+        else
+            for (int i = 0; i < frames; ++i)
+            {
+                random = bench_xorshift32(random);
+                acc ^= kernel->sample_x32(&dsm, dsmPcm[i], random);
+            }
+    }
+
+    double elapsed = now_ns() - start;
+
+    dsmBenchSink = acc;
+
+    return elapsed / ((double)frames * repeat);
+}
+
+double dither_bench_ns_per_word(int mode, int words)
+{
+    static const uint32_t seed[4] = { 1, 2, 3, 4 };
+
+    dither_t dither;
+    dither_init(&dither, seed, (dither_mode_t)mode);
+
+    uint32_t block[8];
+    uint32_t acc = 0;
+
+    double start = now_ns();
+
+    for (int i = 0; i < words; i += 8)
+    {
+        dither_fill(&dither, i & 1, block, 8);
+        acc ^= block[7];
+    }
+
+    double elapsed = now_ns() - start;
+
+    dsmBenchSink = acc;
+
+    return elapsed / words;
+}
+
+double halfband_bench_ns_per_sample(const int32_t* pcm, int frames)
+{
+    static uint64_t in[64], out[128];
+
+    halfband_t halfband;
+    halfband_init(&halfband);
+
+    uint64_t acc = 0;
+    double elapsed = 0;
+
+    for (int i = 0; i + 64 <= frames; i += 64)
+    {
+        for (int j = 0; j < 64; ++j)
+            in[j] = PCM_DSM_FRAME(pcm[i + j], pcm[i + j]);
+
+        double start = now_ns();
+        halfband_process(&halfband, out, in, 64);
+        elapsed += now_ns() - start;
+
+        acc ^= out[127];
+    }
+
+    dsmBenchSink = acc;
+
+    //stereo frames in, per channel sample out
+    return elapsed / (2.0 * (frames & ~63));
+}
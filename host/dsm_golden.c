@@ -0,0 +1,545 @@
+//bit-exact regression test for the modulator: fixed inputs and dither seeds must produce the recorded output words
+//for every order of dsmCoefficients.h, then every order has to come back from an overload.
+//the pipeline vectors run USB packets through dacamp_pcm_put's chain first: pcmConvert.h with a volume ramp,
+//limiter.h driven into reduction, halfband.h at 48 kHz, then core1's stereo blocks
+//
+//  dsm_golden              compares against dsm_golden_vectors.h, exits with 1 on any bit difference
+//  dsm_golden --generate   prints a new dsm_golden_vectors.h to stdout,
+//                          only do this when an output change is intended
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "dsm.h"
+#include "halfband.h"
+#include "limiter.h"
+#include "pcmConvert.h"
+
+#define GOLDEN_EXPLICIT_WORDS   256     //recorded word by word
+#define GOLDEN_SECONDS          2       //the rest is covered by a hash
+#define GOLDEN_BLOCK_LENGTH     8       //words per dsm_process_block_* call, the block path has to match the single calls
+
+typedef enum golden_signal
+{
+    GOLDEN_SIGNAL_SINE,     //997 Hz at -3 dB with a little noise
+    GOLDEN_SIGNAL_HOT,      //5 kHz + 13 kHz clipped at full scale, drives the integrators to their limits
+    GOLDEN_SIGNAL_SILENCE,  //dither only
+} golden_signal_t;
+
+typedef struct golden_vector
+{
+    const char* name;
+    int order;              //dsm_kernel, 4 is the firmware default and the one with every format
+    golden_signal_t signal;
+    bool pcm24;
+    bool sampleRate96k;
+    uint32_t ditherSeed;
+} golden_vector_t;
+
+static const golden_vector_t goldenVectors[] = {
+    { "sine 16/48",       4, GOLDEN_SIGNAL_SINE,    false, false, 0x1BADB002 },
+    { "hot 16/48",        4, GOLDEN_SIGNAL_HOT,     false, false, 0x0DDBA11 },
+    { "silence 16/48",    4, GOLDEN_SIGNAL_SILENCE, false, false, 0xDEADBEEF },
+    { "sine 24/48",       4, GOLDEN_SIGNAL_SINE,    true,  false, 0x1BADB002 },
+    { "hot 24/48",        4, GOLDEN_SIGNAL_HOT,     true,  false, 0x0DDBA11 },
+    { "silence 24/48",    4, GOLDEN_SIGNAL_SILENCE, true,  false, 0xDEADBEEF },
+    { "sine 16/96",       4, GOLDEN_SIGNAL_SINE,    false, true,  0x1BADB002 },
+    { "hot 16/96",        4, GOLDEN_SIGNAL_HOT,     false, true,  0x0DDBA11 },
+    { "silence 16/96",    4, GOLDEN_SIGNAL_SILENCE, false, true,  0xDEADBEEF },
+    { "sine 24/96",       4, GOLDEN_SIGNAL_SINE,    true,  true,  0x1BADB002 },
+    { "hot 24/96",        4, GOLDEN_SIGNAL_HOT,     true,  true,  0x0DDBA11 },
+    { "silence 24/96",    4, GOLDEN_SIGNAL_SILENCE, true,  true,  0xDEADBEEF },
+    { "sine 16/48 o2",    2, GOLDEN_SIGNAL_SINE,    false, false, 0x1BADB002 },
+    { "hot 16/48 o2",     2, GOLDEN_SIGNAL_HOT,     false, false, 0x0DDBA11 },
+    { "silence 16/48 o2", 2, GOLDEN_SIGNAL_SILENCE, false, false, 0xDEADBEEF },
+    { "sine 24/96 o2",    2, GOLDEN_SIGNAL_SINE,    true,  true,  0x1BADB002 },
+    { "hot 24/96 o2",     2, GOLDEN_SIGNAL_HOT,     true,  true,  0x0DDBA11 },
+    { "silence 24/96 o2", 2, GOLDEN_SIGNAL_SILENCE, true,  true,  0xDEADBEEF },
+    { "sine 16/48 o3",    3, GOLDEN_SIGNAL_SINE,    false, false, 0x1BADB002 },
+    { "hot 16/48 o3",     3, GOLDEN_SIGNAL_HOT,     false, false, 0x0DDBA11 },
+    { "silence 16/48 o3", 3, GOLDEN_SIGNAL_SILENCE, false, false, 0xDEADBEEF },
+    { "sine 24/96 o3",    3, GOLDEN_SIGNAL_SINE,    true,  true,  0x1BADB002 },
+    { "hot 24/96 o3",     3, GOLDEN_SIGNAL_HOT,     true,  true,  0x0DDBA11 },
+    { "silence 24/96 o3", 3, GOLDEN_SIGNAL_SILENCE, true,  true,  0xDEADBEEF },
+    { "sine 16/48 o5",    5, GOLDEN_SIGNAL_SINE,    false, false, 0x1BADB002 },
+    { "hot 16/48 o5",     5, GOLDEN_SIGNAL_HOT,     false, false, 0x0DDBA11 },
+    { "silence 16/48 o5", 5, GOLDEN_SIGNAL_SILENCE, false, false, 0xDEADBEEF },
+    { "sine 24/96 o5",    5, GOLDEN_SIGNAL_SINE,    true,  true,  0x1BADB002 },
+    { "hot 24/96 o5",     5, GOLDEN_SIGNAL_HOT,     true,  true,  0x0DDBA11 },
+    { "silence 24/96 o5", 5, GOLDEN_SIGNAL_SILENCE, true,  true,  0xDEADBEEF },
+};
+
+#define GOLDEN_VECTOR_COUNT ((int)(sizeof(goldenVectors) / sizeof(goldenVectors[0])))
+
+//  hot at unity scale, so the limiter reduces, and a volume step at half time for the gain ramp. order 4 like core1
+static const golden_vector_t goldenPipelineVectors[] = {
+    { "pipeline 16/48",   4, GOLDEN_SIGNAL_HOT,     false, false, 0x0DDBA11 },
+    { "pipeline 24/48",   4, GOLDEN_SIGNAL_HOT,     true,  false, 0x0DDBA11 },
+    { "pipeline 16/96",   4, GOLDEN_SIGNAL_HOT,     false, true,  0x0DDBA11 },
+    { "pipeline 24/96",   4, GOLDEN_SIGNAL_HOT,     true,  true,  0x0DDBA11 },
+};
+
+#define GOLDEN_PIPELINE_COUNT   ((int)(sizeof(goldenPipelineVectors) / sizeof(goldenPipelineVectors[0])))
+#define GOLDEN_PIPELINE_SECONDS 1
+#define GOLDEN_PIPELINE_VOLUME  (-9 * DACAMP_VOLUME_PER_DB_UAC2) //UAC2 volume after the step
+
+#include "dsm_golden_vectors.h"
+
+static inline uint32_t xorshift32(uint32_t x)
+{
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return x;
+}
+
+//integer-only oscillator so the inputs do not depend on the host libm
+typedef struct golden_osc
+{
+    int64_t x, y;   //Q30
+    int64_t c;      //2*sin(pi*f/fs), Q30
+} golden_osc_t;
+
+static void golden_osc_init(golden_osc_t* osc, int64_t c)
+{
+    osc->x = 1 << 30;
+    osc->y = 0;
+    osc->c = c;
+}
+
+static inline int64_t golden_osc_next(golden_osc_t* osc)
+{
+    osc->x -= (osc->c * osc->y) >> 30;
+    osc->y += (osc->c * osc->x) >> 30;
+    return osc->y;
+}
+
+//2*sin(pi*f/fs) in Q30, precomputed to keep the generator integer-only
+#define GOLDEN_C_997_48K    140031393
+#define GOLDEN_C_5K_48K     690285996
+#define GOLDEN_C_13K_48K    1614563692
+#define GOLDEN_C_997_96K    70052979
+#define GOLDEN_C_5K_96K     349815365
+#define GOLDEN_C_13K_96K    886281598
+
+typedef struct golden_source
+{
+    const golden_vector_t* vector;
+    golden_osc_t osc1, osc2;
+    uint32_t noise;
+} golden_source_t;
+
+static void golden_source_init(golden_source_t* src, const golden_vector_t* vector)
+{
+    src->vector = vector;
+    src->noise = 0x2545F491;
+
+    golden_osc_init(&src->osc1, vector->sampleRate96k ? GOLDEN_C_997_96K : GOLDEN_C_997_48K);
+
+    if (vector->signal == GOLDEN_SIGNAL_HOT)
+    {
+        golden_osc_init(&src->osc1, vector->sampleRate96k ? GOLDEN_C_5K_96K : GOLDEN_C_5K_48K);
+        golden_osc_init(&src->osc2, vector->sampleRate96k ? GOLDEN_C_13K_96K : GOLDEN_C_13K_48K);
+    }
+}
+
+//next input sample as the host sends it, 16 or 24 bit
+static int32_t golden_source_pcm(golden_source_t* src)
+{
+    int32_t full = src->vector->pcm24 ? 0x7FFFFF : 0x7FFF;
+    int64_t value = 0; //Q30 of full scale
+
+    switch (src->vector->signal)
+    {
+        case GOLDEN_SIGNAL_SINE:
+            src->noise = xorshift32(src->noise);
+            value = (golden_osc_next(&src->osc1) * 181) >> 8; //-3 dB
+            value += ((int32_t)src->noise) >> 16;
+            break;
+
+        case GOLDEN_SIGNAL_HOT:
+            value = (golden_osc_next(&src->osc1) * 3 + golden_osc_next(&src->osc2) * 2) >> 2;
+            break;
+
+        case GOLDEN_SIGNAL_SILENCE:
+            break;
+    }
+
+    int32_t pcm = (int32_t)((value * full) >> 30);
+
+    if (pcm > full)
+        pcm = full;
+    else if (pcm < -full)
+        pcm = -full;
+
+    return pcm;
+}
+
+//next input sample at the modulator full scale
+static int32_t golden_source_next(golden_source_t* src)
+{
+    int32_t pcm = golden_source_pcm(src);
+
+    return src->vector->pcm24
+        ? DSM_INT24_TO_INT32(pcm)
+        : DSM_INT16_TO_INT32((int16_t)pcm);
+}
+
+static inline uint64_t fnv1a64(uint64_t hash, uint64_t word)
+{
+    for (int i = 0; i < 8; ++i)
+    {
+        hash ^= (word >> (8 * i)) & 0xFF;
+        hash *= 0x100000001B3ULL;
+    }
+
+    return hash;
+}
+
+//runs one vector through single calls (blockLength 0) or the block functions,
+//fills explicit words and returns the hash over all words
+static uint64_t golden_run(const golden_vector_t* vector, int blockLength, uint64_t* explicitWords)
+{
+    golden_source_t src;
+    golden_source_init(&src, vector);
+
+    const dsm_kernel_t* kernel = dsm_kernel(vector->order);
+
+    dsm_t dsm;
+    dsm_init(&dsm);
+
+    uint32_t random = vector->ditherSeed;
+    uint64_t hash = 0xCBF29CE484222325ULL;
+
+    int wordCount = GOLDEN_SECONDS * 48000; //both rates produce 48000 words per second
+
+    for (int i = 0; i < wordCount; )
+    {
+        int32_t pcm[2 * GOLDEN_BLOCK_LENGTH];
+        uint32_t randomBits[GOLDEN_BLOCK_LENGTH];
+        uint64_t words[GOLDEN_BLOCK_LENGTH];
+
+        int n = blockLength ? blockLength : 1;
+
+        if (n > wordCount - i)
+            n = wordCount - i;
+
+        for (int j = 0; j < n; ++j)
+        {
+            randomBits[j] = random = xorshift32(random);
+
+            pcm[2 * j] = golden_source_next(&src);
+
+            if (vector->sampleRate96k)
+                pcm[2 * j + 1] = golden_source_next(&src);
+        }
+
+        if (!blockLength)
+            words[0] = vector->sampleRate96k
+                ? kernel->sample_x16(&dsm, pcm[0], pcm[1], randomBits[0])
+                : kernel->sample_x32(&dsm, pcm[0], randomBits[0]);
+        else if (vector->sampleRate96k)
+            kernel->block_x16(&dsm, pcm, 1, n, randomBits, words);
+        else
+        {
+            for (int j = 1; j < n; ++j) //x32 takes one frame per word
+                pcm[j] = pcm[2 * j];
+
+            kernel->block_x32(&dsm, pcm, 1, n, randomBits, words);
+        }
+
+        for (int j = 0; j < n; ++j, ++i)
+        {
+            if (i < GOLDEN_EXPLICIT_WORDS)
+                explicitWords[i] = words[j];
+
+            hash = fnv1a64(hash, words[j]);
+        }
+    }
+
+    return hash;
+}
+
+//  one vector through the firmware chain: 1 ms packets into pcm_convert_select, limiter_process and at 48 kHz
+// halfband_process, then both channels x16 in blocks of GOLDEN_BLOCK_LENGTH with interleaved pcm and words like
+// process_block. explicit words and the hash take the interleaved left/right words
+static uint64_t golden_pipeline_run(const golden_vector_t* vector, uint64_t* explicitWords)
+{
+    golden_source_t src;
+    golden_source_init(&src, vector);
+
+    const dsm_kernel_t* kernel = dsm_kernel(vector->order);
+
+    int packetFrames = vector->sampleRate96k ? 96 : 48;
+    int sampleSize = vector->pcm24 ? 8 : 4;
+
+    gain_t gainLeft, gainRight;
+    gain_init(&gainLeft, GAIN_UNITY);
+    gain_init(&gainRight, GAIN_UNITY);
+
+    limiter_t limiter;
+    limiter_init(&limiter, packetFrames);
+
+    halfband_t halfband;
+    halfband_init(&halfband);
+
+    dsm_t dsmLeft, dsmRight;
+    dsm_init(&dsmLeft);
+    dsm_init(&dsmRight);
+
+    uint32_t random = vector->ditherSeed;
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    int explicitCount = 0;
+
+    for (int p = 0; p < GOLDEN_PIPELINE_SECONDS * 1000; ++p)
+    {
+        uint32_t packet[2 * 96];
+        uint64_t frames[96]; //dsm rate, 2 per output word
+        uint64_t words[2 * GOLDEN_BLOCK_LENGTH];
+        uint32_t randomBits[2 * GOLDEN_BLOCK_LENGTH];
+
+        for (int i = 0; i < packetFrames; ++i)
+        {
+            int32_t pcm = golden_source_pcm(&src);
+
+            //right is the inverted left at half the level, the channels must not get mixed up
+            if (vector->pcm24)
+            {
+                packet[2 * i] = (uint32_t)pcm << 8;
+                packet[2 * i + 1] = (uint32_t)(-pcm / 2) << 8;
+            }
+            else
+                packet[i] = (uint16_t)pcm | ((uint32_t)(uint16_t)(-pcm / 2) << 16);
+        }
+
+        if (p == GOLDEN_PIPELINE_SECONDS * 1000 / 2)
+        {
+            gain_set_target(&gainLeft, gain_from_uac2(GOLDEN_PIPELINE_VOLUME, false));
+            gain_set_target(&gainRight, gain_from_uac2(GOLDEN_PIPELINE_VOLUME / 2, false));
+        }
+
+        pcm_convert_t convert = pcm_convert_select(sampleSize, &gainLeft, &gainRight);
+
+        if (vector->sampleRate96k)
+        {
+            convert(frames, packet, packetFrames, &gainLeft, &gainRight);
+            limiter_process(&limiter, frames, packetFrames);
+        }
+        else
+        {
+            convert(frames + packetFrames, packet, packetFrames, &gainLeft, &gainRight);
+            limiter_process(&limiter, frames + packetFrames, packetFrames);
+            halfband_process(&halfband, frames, frames + packetFrames, packetFrames);
+        }
+
+        const int32_t* pcm = (const int32_t*)frames;
+
+        for (int w = 0; w < 48; w += GOLDEN_BLOCK_LENGTH, pcm += 4 * GOLDEN_BLOCK_LENGTH)
+        {
+            for (int j = 0; j < 2 * GOLDEN_BLOCK_LENGTH; ++j)
+                randomBits[j] = random = xorshift32(random);
+
+            kernel->block_x16(&dsmLeft, &pcm[0], 2, GOLDEN_BLOCK_LENGTH, &randomBits[0], &words[0]);
+            kernel->block_x16(&dsmRight, &pcm[1], 2, GOLDEN_BLOCK_LENGTH, &randomBits[GOLDEN_BLOCK_LENGTH], &words[1]);
+
+            for (int j = 0; j < 2 * GOLDEN_BLOCK_LENGTH; ++j)
+            {
+                if (explicitCount < GOLDEN_EXPLICIT_WORDS)
+                    explicitWords[explicitCount++] = words[j];
+
+                hash = fnv1a64(hash, words[j]);
+            }
+        }
+    }
+
+    return hash;
+}
+
+static void golden_print_words(const char* name, const uint64_t* words)
+{
+    printf("    { // %s\n", name);
+
+    for (int i = 0; i < GOLDEN_EXPLICIT_WORDS; i += 4)
+        printf("        0x%016llX, 0x%016llX, 0x%016llX, 0x%016llX,\n",
+            (unsigned long long)words[i], (unsigned long long)words[i + 1],
+            (unsigned long long)words[i + 2], (unsigned long long)words[i + 3]);
+
+    printf("    },\n");
+}
+
+static void golden_generate(void)
+{
+    uint64_t words[GOLDEN_EXPLICIT_WORDS];
+
+    printf("//generated by `dsm_golden --generate`, do not edit by hand\n\n");
+    printf("#pragma once\n\n#include <stdint.h>\n\n");
+    printf("#define DSM_GOLDEN_VECTOR_COUNT %d\n", GOLDEN_VECTOR_COUNT);
+    printf("#define DSM_GOLDEN_EXPLICIT_WORDS %d\n\n", GOLDEN_EXPLICIT_WORDS);
+
+    uint64_t hashes[GOLDEN_VECTOR_COUNT];
+
+    printf("static const uint64_t dsmGoldenWords[DSM_GOLDEN_VECTOR_COUNT][DSM_GOLDEN_EXPLICIT_WORDS] = \n{\n");
+
+    for (int v = 0; v < GOLDEN_VECTOR_COUNT; ++v)
+    {
+        hashes[v] = golden_run(&goldenVectors[v], 0, words);
+        golden_print_words(goldenVectors[v].name, words);
+    }
+
+    printf("};\n\n");
+
+    printf("static const uint64_t dsmGoldenHashes[DSM_GOLDEN_VECTOR_COUNT] = \n{\n");
+
+    for (int v = 0; v < GOLDEN_VECTOR_COUNT; ++v)
+        printf("    0x%016llXULL, // %s\n", (unsigned long long)hashes[v], goldenVectors[v].name);
+
+    printf("};\n\n");
+
+    uint64_t pipelineHashes[GOLDEN_PIPELINE_COUNT];
+
+    printf("#define DSM_GOLDEN_PIPELINE_COUNT %d\n\n", GOLDEN_PIPELINE_COUNT);
+    printf("static const uint64_t dsmGoldenPipelineWords[DSM_GOLDEN_PIPELINE_COUNT][DSM_GOLDEN_EXPLICIT_WORDS] = \n{\n");
+
+    for (int v = 0; v < GOLDEN_PIPELINE_COUNT; ++v)
+    {
+        pipelineHashes[v] = golden_pipeline_run(&goldenPipelineVectors[v], words);
+        golden_print_words(goldenPipelineVectors[v].name, words);
+    }
+
+    printf("};\n\n");
+
+    printf("static const uint64_t dsmGoldenPipelineHashes[DSM_GOLDEN_PIPELINE_COUNT] = \n{\n");
+
+    for (int v = 0; v < GOLDEN_PIPELINE_COUNT; ++v)
+        printf("    0x%016llXULL, // %s\n", (unsigned long long)pipelineHashes[v], goldenPipelineVectors[v].name);
+
+    printf("};\n");
+}
+
+static int golden_check(void)
+{
+    uint64_t words[GOLDEN_EXPLICIT_WORDS];
+    int failed = 0;
+
+    if (DSM_GOLDEN_VECTOR_COUNT != GOLDEN_VECTOR_COUNT || DSM_GOLDEN_EXPLICIT_WORDS != GOLDEN_EXPLICIT_WORDS ||
+        DSM_GOLDEN_PIPELINE_COUNT != GOLDEN_PIPELINE_COUNT)
+    {
+        printf("dsm_golden_vectors.h does not match the vector table, regenerate it\n");
+        return -1;
+    }
+
+    for (int v = 0; v < GOLDEN_VECTOR_COUNT; ++v)
+        for (int blockLength = 0; blockLength <= GOLDEN_BLOCK_LENGTH; blockLength += GOLDEN_BLOCK_LENGTH)
+        {
+            const char* path = blockLength ? "blocks" : "single";
+
+            uint64_t hash = golden_run(&goldenVectors[v], blockLength, words);
+            int mismatch = -1;
+
+            for (int i = 0; i < GOLDEN_EXPLICIT_WORDS && mismatch < 0; ++i)
+                if (words[i] != dsmGoldenWords[v][i])
+                    mismatch = i;
+
+            if (mismatch >= 0)
+                printf("FAIL %-18s %s word %d: 0x%016llX, expected 0x%016llX\n", goldenVectors[v].name, path, mismatch,
+                    (unsigned long long)words[mismatch], (unsigned long long)dsmGoldenWords[v][mismatch]);
+            else if (hash != dsmGoldenHashes[v])
+                printf("FAIL %-18s %s hash over %d s differs\n", goldenVectors[v].name, path, GOLDEN_SECONDS);
+            else
+            {
+                printf("ok   %-18s %s\n", goldenVectors[v].name, path);
+                continue;
+            }
+
+            ++failed;
+        }
+
+    for (int v = 0; v < GOLDEN_PIPELINE_COUNT; ++v)
+    {
+        uint64_t hash = golden_pipeline_run(&goldenPipelineVectors[v], words);
+        int mismatch = -1;
+
+        for (int i = 0; i < GOLDEN_EXPLICIT_WORDS && mismatch < 0; ++i)
+            if (words[i] != dsmGoldenPipelineWords[v][i])
+                mismatch = i;
+
+        if (mismatch >= 0)
+            printf("FAIL %-18s word %d: 0x%016llX, expected 0x%016llX\n", goldenPipelineVectors[v].name, mismatch,
+                (unsigned long long)words[mismatch], (unsigned long long)dsmGoldenPipelineWords[v][mismatch]);
+        else if (hash != dsmGoldenPipelineHashes[v])
+            printf("FAIL %-18s hash over %d s differs\n", goldenPipelineVectors[v].name, GOLDEN_PIPELINE_SECONDS);
+        else
+        {
+            printf("ok   %s\n", goldenPipelineVectors[v].name);
+            continue;
+        }
+
+        ++failed;
+    }
+
+    return failed;
+}
+
+//  a +3 dBFS square wave (the input at _DSM_INT_MAX) overloads every order, the following silence has to see the loop
+// out of it: no new overloads and the output no longer railed. the golden vectors above never overload
+#define GOLDEN_OVERLOAD_WORDS   2400    //50 ms at 48 kHz
+#define GOLDEN_RECOVERY_WORDS   480     //10 ms, the last half is checked
+
+static int golden_overload_check(void)
+{
+    int failed = 0;
+
+    for (int order = 2; order <= DSM_MAX_ORDER; ++order)
+    {
+        const dsm_kernel_t* kernel = dsm_kernel(order);
+
+        dsm_t dsm;
+        dsm_init(&dsm);
+
+        uint32_t random = 0x0DDBA11;
+
+        for (int i = 0; i < GOLDEN_OVERLOAD_WORDS; ++i)
+            kernel->sample_x32(&dsm, (i / 48) & 1 ? -_DSM_INT_MAX : _DSM_INT_MAX, random = xorshift32(random));
+
+        uint32_t overloads = dsm.overloads;
+        int railed = 0;
+
+        for (int i = 0; i < GOLDEN_RECOVERY_WORDS; ++i)
+        {
+            uint64_t word = kernel->sample_x32(&dsm, 0, random = xorshift32(random));
+
+            railed += i >= GOLDEN_RECOVERY_WORDS / 2 && (word == 0x5555555555555555ULL || word == 0xAAAAAAAAAAAAAAAAULL);
+        }
+
+        if (!overloads || dsm.overloads != overloads || railed)
+        {
+            printf("FAIL overload order %d: %u overloads, %u more in silence, %d railed words\n", order,
+                overloads, dsm.overloads - overloads, railed);
+            ++failed;
+        }
+        else
+            printf("ok   overload order %d: %u overloads, recovered\n", order, overloads);
+    }
+
+    return failed;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc > 1 && !strcmp(argv[1], "--generate"))
+    {
+        golden_generate();
+        return 0;
+    }
+
+    int failed = golden_check();
+
+    if (failed < 0)
+        return 1;
+
+    failed += golden_overload_check();
+
+    return failed ? 1 : 0;
+}
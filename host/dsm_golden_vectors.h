@@ -0,0 +1,2304 @@
+//generated by `dsm_golden --generate`, do not edit by hand
+
+#pragma once
+
+#include <stdint.h>
+
+#define DSM_GOLDEN_VECTOR_COUNT 30
+#define DSM_GOLDEN_EXPLICIT_WORDS 256
+
+static const uint64_t dsmGoldenWords[DSM_GOLDEN_VECTOR_COUNT][DSM_GOLDEN_EXPLICIT_WORDS] = 
+{
+    { // sine 16/48
+        0x0000060618664000, 0x1990001900640019, 0x0190640641901919, 0x0406590196659106,
+        0x4659106446591041, 0x0411194194119411, 0x0446510444111111, 0x0594116505944165,
+        0x1650594594414144, 0x4444595111111414, 0x4445951651116544, 0x4445114444511165,
+        0x4595944595111165, 0x4459595944505111, 0x1144595959444444, 0x5111111165656594,
+        0x4441656519596504, 0x5965104444111194, 0x4104465194194104, 0x1046506596410659,
+        0x6419641964196659, 0x9191919919019064, 0x0190066466400066, 0x4066199990001801,
+        0x8006000000099998, 0x0266660026009800, 0x980980982602609A, 0x660809A669826982,
+        0x698808208209A69A, 0x62089A698889A082, 0x22688220888829A6, 0x8889A22226A6829A,
+        0x2220A20A20A22222, 0x229A888828888A22, 0x29A9A829A9A29A88, 0x2888A6A29A9A9A22,
+        0x288A6A0A2228888A, 0x229A888888A29A9A, 0x9A229A9A229A29A2, 0x9A29A0A0A6A68888,
+        0x8888A68229A208A6, 0x8822226A69A68820, 0x888222689A09A082, 0x0822082082089882,
+        0x02080820209A6699, 0xA662626260098260, 0x0989982666099982, 0x6666609266666601,
+        0x8018018619999900, 0x0666641999066640, 0x6406406406419019, 0x6646584065906441,
+        0x9641065919659104, 0x1965965911941194, 0x1194651944105965, 0x1110444444444165,
+        0x6510594445944444, 0x5959444450595119, 0x5111165444145951, 0x0511654144459511,
+        0x1414445111145959, 0x5059505051116544, 0x5944594595059445, 0x9594444594594416,
+        0x5651110459596511, 0x0444446511110411, 0x1104441194110411, 0x9410465910659659,
+        0x9644041964196659, 0x0196406419190190, 0x1900641990199000, 0x6640066666400001,
+        0x8060600180002649, 0x9980926600266266, 0x6099899898098098, 0x982626262609A609,
+        0xA609A698209A6989, 0xA69A698220822208, 0x9A2689A082222226, 0x889A222268888888,
+        0x8889A88829A9A222, 0x2222888888A6A222, 0x2228888A22229A8A, 0x688A6A26A2222888,
+        0xA2228888A2288888, 0xA22888A6A2222228, 0x88A229A29A29A29A, 0x229A229A22229A9A,
+        0x0A688888828829A2, 0x2208888882222268, 0x89A269A689A69889, 0xA269882082089A62,
+        0x69880826209A6699, 0xA60989899A660262, 0x6026626000980098, 0x0009980000999998,
+        0x0180180601986666, 0x4001999001999199, 0x0019019066464064, 0x1906599191966465,
+        0x9965906590465964, 0x1046506596596596, 0x5964444111044446, 0x5119444411659594,
+        0x1650594445944444, 0x4459505944594594, 0x5959445959595959, 0x4445951165416544,
+        0x4445114445951116, 0x5444145951111654, 0x4444595111651165, 0x1651651651059505,
+        0x9444444444444444, 0x4441651104446511, 0x9441104651196596, 0x5965919659104104,
+        0x1065910101065919, 0x0646465864641906, 0x6586406406400190, 0x0066400066490000,
+        0x0180601806000000, 0x2666000266602660, 0x2660266260098998, 0x9826260989898209,
+        0x89A62626989A6269, 0xA6209A09A6820822, 0x6882268222268222, 0x0A69A22208888888,
+        0x8888888A689A9A9A, 0x220A6A20A0A20A22, 0x28288888A2229A88, 0xA688A6A6A2222288,
+        0x8A229A8888A6A222, 0x82888A6A29A229A9, 0xA282888888A29A9A, 0x229A222229A9A29A,
+        0x208A6A6888229A22, 0x6A689A220888229A, 0x6882268222682208, 0x22682269A6269A62,
+        0x09A608209A626269, 0x989880982699809A, 0x4989800980980099, 0x8099800009980000,
+        0x0099092492409000, 0x0006664186664006, 0x4066406401901906, 0x4641901904191966,
+        0x5906441964119641, 0x1964465910441046, 0x5104119446519411, 0x1044444116510594,
+        0x1165111119510595, 0x9444144445959594, 0x4594445951111656, 0x5414144459511141,
+        0x4445951651656541, 0x6541444595111654, 0x1414444451146544, 0x1416544414141414,
+        0x1656519594416511, 0x0594446565965119, 0x4411044651044659, 0x6596596465065910,
+        0x4104196440419196, 0x4196646465864640, 0x6464019006419000, 0x1900066401866666,
+        0x4000001801800002, 0x4926660002660099, 0x9899989982662602, 0x6098260989898989,
+        0x8989A60208208269, 0x8820820822082268, 0x22682268222689A2, 0x08829A088A69A0A6,
+        0x8829A2222229A0A6, 0x8A6A6829A9A229A9, 0xA222288288A0A222, 0x28888A229A9A8888,
+        0x8A22228A6A222228, 0x88A2228888A229A9, 0xA829A9A9A9A2229A, 0x9A9A229A222229A8,
+        0x229A2226A0A68882, 0x9A20A68889A22088, 0x8222222682268220, 0x89A0822082089A69,
+        0x89A62098820989A6, 0x26260989A6626098, 0x0989809802662600, 0x2660026600099998,
+        0x0000000026424009, 0x0066199900066400, 0x6640190066586406, 0x4640641919065991,
+        0x0196419641065910, 0x4196446591046594, 0x1041119411044411, 0x1194441111104594,
+        0x4656504594441416, 0x5656504595944594, 0x4595945945959445, 0x0505111445959505,
+        0x0511165445051111, 0x6545195105111444, 0x5951116565165165, 0x1656511116565116,
+        0x5105950459465651, 0x1959651104444444, 0x6519465104411946, 0x5196591044194106,
+        0x5064464419641064, 0x4191966464646406, 0x4641991900640664, 0x6664019900199990,
+        0x0000619866198660, 0x6018009999800266, 0x0099809982662662, 0x662609809A662026,
+        0x2626202098820988, 0x2082082682082088, 0x226822089A268220, 0x888822222208A69A,
+        0x220A688888888A68, 0x29A8229A22229A9A, 0x9A22229A9A9A9A9A, 0x222228A222229A8A,
+        0x0A6A6A0A20A2288A, 0x6A22229A8888A6A2, 0x9A29A229A89A8888, 0x88A6A22229A22229,
+        0xA9A2220A0A0A68A6, 0x9A2220A68229A268, 0x822268889A089A26, 0x9A089A69A6988268,
+        0x269A626989A609A6, 0x262699A602626262, 0x6026026266266026, 0x0026609998002666,
+        0x6002424909249264, 0x0900901999990199, 0x9006640664064064, 0x0641901961966464,
+        0x4064659064419646, 0x5904659646596596, 0x4659465941046511, 0x9441105965119596,
+        0x5045944165111111, 0x1651111165651111, 0x1654654654165416, 0x5444144511165444,
+        0x4511114459511165, 0x6544444511144445, 0x1656565116514144, 0x1444511051114165,
+    },
+    { // hot 16/48
+        0x0066465965051145, 0x4514545165441441, 0x6519659190640066, 0x6406659965965165,
+        0x4444595111119444, 0x6590000020829A8A, 0x8A28A8AA2A2A28A8, 0xA8A2288298898266,
+        0x0180000600909090, 0x9926009826988269, 0xA269980024019104, 0x6516511115954565,
+        0x5445655116541650, 0x4464640180026989, 0xA209A62626266600, 0x0018090924249926,
+        0x66026982222228A2, 0xA8A88AA2A2A2A2A2, 0x8A22882098019919, 0x4119596565165165,
+        0x4444459119190199, 0x0001991919641044, 0x5944444514514515, 0x1451654410406406,
+        0x18026269A08A6A88, 0xA8A88A9AA222229A, 0x2088208269980999, 0x8002626269A688A6,
+        0xA222288888A6889A, 0x0989800646594451, 0x5145454551454545, 0x1565594650644019,
+        0x9999240024000000, 0x0006406406591946, 0x5964640024260226, 0x829A22288A22A28A,
+        0x8A2A22A222882882, 0x9A60800990006591, 0x1196591906406664, 0x0024000000001866,
+        0x6664404651111151, 0x5151455151451551, 0x4516564640180262, 0x2088888888A6A229,
+        0xA88829A698809980, 0x02666260209A69A2, 0x68888A6A29AA28A2, 0xA22A6A2088260998,
+        0x0066590441141595, 0x5159544451654444, 0x6510419646466664, 0x0019019644651111,
+        0x6559594596511119, 0x41919998269A6A6A, 0xA28A2A8A2A2A8A2A, 0x2A6A88889A626099,
+        0x9860000000060249, 0x2499802620209A68, 0x2269982642419106, 0x5111111145159545,
+        0x1516554445950459, 0x6591919999899A62, 0x08822699A6609999, 0x8060600001802424,
+        0x2660988220A222A2, 0xA28A8A8AA28A2AA2, 0x88A29A0989990041, 0x0444441654414445,
+        0x9565644106590019, 0x9901990644041119, 0x4444595111454514, 0x5151444111964006,
+        0x18099A626A688A2A, 0x28A28A28A28829A2, 0x9888226269262666, 0x6002609A6220A68A,
+        0x229A88888888A69A, 0x09A6666404105114, 0x5455145451545511, 0x5151111650419019,
+        0x9999990000900000, 0x0199991919101044, 0x6596406618026089, 0xA2220A2288A88A8A,
+        0x2A28A28A222889A9, 0xA098980090064659, 0x1194196466466400, 0x0090061818186661,
+        0x9901964651951145, 0x4515154515451455, 0x1511104646666262, 0x6889A2222229A88A,
+        0x6A22208826980980, 0x00009898988089A0, 0xA6888A6A28A6A8A8, 0x8A8A6A0A6209A499,
+        0x2400106594459515, 0x9551445114451165, 0x1041196464190666, 0x1991906441104595,
+        0x1654414165651044, 0x11906660089A2288, 0xAA2A28A8AA2A28A2, 0xA8A22829A09A6609,
+        0x9249266666018060, 0x06026626698209A2, 0x0898980240019644, 0x1111651654516555,
+        0x1145445144451105, 0x9659919249989882, 0x0889A62009826600, 0x0600002402424992,
+        0x6662698220A6A88A, 0x2A8A2A2A28AA8A2A, 0x288A226980900196, 0x5965111059595116,
+        0x5416510411906400, 0x6199019065910411, 0x1111654445145445, 0x5144451104646401,
+        0x800989A6226A288A, 0x8A88A8A229AA6888, 0x2226820989826600, 0x2666698268222228,
+        0x88A6A29A22220888, 0x9A69090065965114, 0x5514545454545451, 0x5451111651919199,
+        0x9999990000000900, 0x6066646404041194, 0x6591919998026089, 0xA20A6A0A228A28A8,
+        0xA2A28A228A6A2688, 0x9A69989999064046, 0x5044196659919990, 0x0900900000000661,
+        0x9990104651051151, 0x4515514515454545, 0x1451111019926698, 0x822222222228288A,
+        0x29A222209A602600, 0x00998998809A69A2, 0x68888A6A28A6A8A9, 0xAA8A68889A026266,
+        0x6491906594445115, 0x1511514511654411, 0x6594104064641999, 0x9906419196594444,
+        0x5144459594416504, 0x41019999A6088A28, 0xA8A2A2A8A8A2A2A2, 0xA22A229A68202660,
+        0x0249249264999986, 0x0060998262620882, 0x089A600900019646, 0x5111111145145145,
+        0x4565544595950444, 0x4419190000260826, 0x82269A6098266000, 0x0909249249999998,
+        0x00266989A22288A8, 0xA28AA8A2A28AA2A2, 0xA6A89A6998000196, 0x5194411111444451,
+        0x1459465065901900, 0x0199919064419465, 0x1059595951459551, 0x4514445946599066,
+        0x6662609A08A6A6A8, 0xA88A9AA88888A6A0, 0x889A09A609899800, 0x099989A6269A2222,
+        0x888A22289A822208, 0x9A69240010411445, 0x4545451545154515, 0x1456559659665999,
+        0x0000006061860666, 0x1990019065906504, 0x650101999980269A, 0x68889A88A228A2A2,
+        0x8A8A88A6A82829A0, 0x8820982490199104, 0x6519641966466400, 0x0002401860618666,
+        0x1901910411114514, 0x5154515454514554, 0x5114446599009826, 0x9A208A69A9A9A9A9,
+        0xA889A9889A602660, 0x09266098988209A2, 0x220A22288A2A22A2, 0x8A8A6A088209A499,
+        0x9990646594445114, 0x5514454451441441, 0x6519659190190666, 0x6400659965946565,
+        0x6544444511959441, 0x04064002626888A2, 0xA28AA28A8AA28A2A, 0x8A88A68889A62660,
+        0x0000002490992664, 0x99982600989A6988, 0x8209898001991964, 0x4441444451595456,
+        0x5544511595651110, 0x4659666424980822, 0x689A698098998266, 0x4266666666600180,
+        0x009809A689A9A8A2, 0x8A8A8A2AA22A8A8A, 0x2A22222699990191, 0x9441111165165654,
+        0x4459446596419000, 0x6664019196650651, 0x1059595111454454, 0x5451146511919000,
+        0x60008089A22222A2, 0x8AA228A9A888A688, 0x8822682626260000, 0x09989826220888A6,
+        0xA29A9A9A22226888, 0x9A60240010416545, 0x4455145514545514, 0x5451165659641900,
+        0x0186061986666642, 0x4000064191964651, 0x965901999998989A, 0x20888A22288A8A2A,
+        0x2A288A28A229A222, 0x2698998900064104, 0x4119419191900001, 0x9866664909240090,
+        0x0066591944165454, 0x5145455151514515, 0x5116564641860269, 0x8889A9A0A6A6A0A2,
+        0x228829A080809809, 0x92660262698269A2, 0x0A68A6A2228A28AA, 0x29AA9A2089880980,
+        0x1866599411165445, 0x4545145954444445, 0x9651964196640666, 0x4019904196504595,
+        0x1111445059444111, 0x19100002608888A2, 0xA88AA2A28AA28AA2, 0x8A28A20A69A62661,
+        0x8000000009249924, 0x999989809A669A62, 0x2269800924006596, 0x5941414459545145,
+        0x4514516554411111, 0x0465900660098268, 0x2269A69989800998, 0x6001800600002490,
+    },
+    { // silence 16/48
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000024018, 0x0000000001809000, 0x0024006000000000, 0x0000000000009001,
+        0x8000000000000000, 0x0002400600000000, 0x0000000900180000, 0x0000000090018000,
+        0x0000000090006000, 0x0000000024001800, 0x0000000240018000, 0x0000024000600000,
+        0x0000240006000000, 0x0090001800000009, 0x0001800000090000, 0x6000000240001800,
+        0x0002400006000002, 0x4000018000009000, 0x0060000240000060, 0x0002400000600009,
+        0x0000006000090000, 0x0006000240000001, 0x8000900000000600, 0x0240000000001800,
+        0x2400000000018002, 0x4000000000000018, 0x0090000000000000, 0x0006002400000000,
+        0x0000000000000000, 0x0000600900000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0900600000000000, 0x0000000000000090,
+        0x0180000000000000, 0x2400600000000000, 0x0240018000000000, 0x0090006000000002,
+        0x4001800000000900, 0x0180000000240001, 0x8000000090001800, 0x0002400018000000,
+        0x9000018000002400, 0x0060000024000060, 0x0000900001800002, 0x4000018000024000,
+        0x0060000240000180, 0x0024000006000090, 0x0000060000900000, 0x0060000900000000,
+        0x6000240000000180, 0x0240000000060009, 0x0000000000600090, 0x0000000000018002,
+        0x4000000000000000, 0x1800900000000000, 0x0000000001802400, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000900180000000,
+        0x0000000000000002, 0x4006000000000000, 0x0090006000000000, 0x0000900060000000,
+        0x0024000600000000, 0x0900018000000024, 0x0001800000024000, 0x1800000240000600,
+        0x0002400006000009, 0x0000060000240000, 0x0600009000000600, 0x0090000000600024,
+        0x0000000180009000, 0x0000000180024000, 0x0000000006002400, 0x0000000000000000,
+        0x0180240000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000002401,
+        0x8000000000000000, 0x0000090006000000, 0x0000024001800000, 0x0024000600000002,
+        0x4000180000024000, 0x1800002400001800, 0x0024000006000090, 0x0000018000900000,
+        0x0018002400000000, 0x0180024000000000, 0x0000000018024000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000090060, 0x0000000000000000, 0x0240018000000000,
+        0x0900018000000024, 0x0001800000090000, 0x1800000900000600, 0x0024000000600009,
+        0x0000000180009000, 0x0000000180024000, 0x0000000000000006, 0x0090000000000000,
+        0x0000000000000000, 0x0000002401800000, 0x0000000000000090, 0x0060000000024000,
+        0x6000000090000600, 0x0002400001800002, 0x4000001800090000, 0x0006000240000000,
+        0x0001800900000000, 0x0000000001802400, 0x0000000000000900, 0x6000000000000000,
+        0x0000000000240006, 0x0000000002400060, 0x0000024000180000, 0x0240000180000900,
+        0x0000180002400000, 0x0006000900000000, 0x0000600240000000, 0x0000000000000000,
+        0x0000000000000000, 0x0009001800000000, 0x0000090001800000, 0x0024000180000090,
+        0x0000600002400000, 0x0600024000000018, 0x0024000000000000, 0x0000018024000000,
+        0x0000000900600000, 0x0000000000000002, 0x4001800000000900, 0x0180000024000060,
+        0x0000900000180002, 0x4000000060009000, 0x0000000018009000, 0x0000000000000000,
+        0x0000000000000000, 0x0900180000000000, 0x0009000180000009, 0x0000600000900000,
+        0x1800024000000180, 0x0090000000000000, 0x6002400000000000, 0x0000000000000000,
+        0x0002401800000000, 0x0000090006000000, 0x0900006000002400, 0x0018000240000006,
+        0x0009000000000180, 0x0900000000000000, 0x0000000000000000, 0x0000000090018000,
+        0x0000009000180000, 0x0090000180000900, 0x0000600024000000, 0x0006000900000000,
+        0x0000000000000000, 0x0000000000000009, 0x0006000000000024, 0x0001800000240000,
+        0x1800009000000018, 0x0024000000000001, 0x8009000000000000, 0x0009006000000000,
+        0x0000000009000180, 0x0000090000180000, 0x9000000600024000, 0x0000000600240000,
+        0x0000000000000000, 0x0000000240060000, 0x0000000240006000, 0x0009000006000090,
+        0x0000018002400000, 0x0000000600900000, 0x0000000000024018, 0x0000000000000090,
+        0x0018000000240000, 0x1800009000000180, 0x0240000000000180, 0x2400000000000000,
+        0x0000009001800000, 0x0000000240006000, 0x0024000006000090, 0x0000001800240000,
+        0x0000000000000000, 0x0000000000000002, 0x4000600000000900, 0x0018000024000000,
+        0x6000240000000000, 0x0180240000000000, 0x0000002400600000, 0x0000000090001800,
+        0x0009000001800024, 0x0000000018002400, 0x0000000000000000, 0x0000000000240060,
+        0x0000000024000600, 0x0009000006000240, 0x0000001800900000, 0x0000000000000000,
+        0x0000000000240018, 0x0000000240001800, 0x0024000001800090, 0x0000000001800900,
+        0x0000000000000002, 0x4018000000000000, 0x2400060000009000, 0x0018000240000000,
+        0x0180090000000000, 0x0000000000000009, 0x0018000000002400, 0x0180000240000018,
+        0x0009000000000000, 0x0060090000000090, 0x0180000000000009, 0x0001800002400001,
+        0x8000240000000000, 0x6002400000000000, 0x0000024006000000, 0x0000009000060000,
+        0x2400000600024000, 0x0000000000018024, 0x0000002400600000, 0x0000002400018000,
+        0x0024000001800090, 0x0000000001800900, 0x0000000009006000, 0x0000000000090001,
+        0x8000009000001800, 0x0240000000000600, 0x2400000000000024, 0x0180000000000009,
+    },
+    { // sine 24/48
+        0x0000060618664000, 0x1990001900640019, 0x0191990640646419, 0x6196659010644101,
+        0x0659196441965964, 0x6594196594104111, 0x0444651944111059, 0x4111650444445965,
+        0x6510594594444445, 0x0595059459594445, 0x9505111116559459, 0x4459511111445111,
+        0x1445951111654445, 0x9511111655944459, 0x4595059595944444, 0x4595111195959441,
+        0x6511111111059596, 0x5104465111194110, 0x4446594659644650, 0x4194196591065919,
+        0x6410644191019101, 0x9065990641906406, 0x6466419900664006, 0x6640006666664000,
+        0x2409024926666000, 0x2666009980266009, 0x8026260098260989, 0x82609A6698082020,
+        0x82698208268269A6, 0x209A089A69A08208, 0x88222088829A6882, 0x222220A6829A2222,
+        0x2222229A22222229, 0xA889A829A29A9A29, 0xA29A29A288288A6A, 0x22229A888A0A2222,
+        0x8A6A0A22229A8A0A, 0x6A6A6A6A6A6888A6, 0xA2229A229A9A9A22, 0x229A29A222229A22,
+        0x22229A0A68829A22, 0x0888888822208889, 0xA22682089A088226, 0x9A6989A6988269A6,
+        0x69A60988082699A6, 0x6998989809898026, 0x0998998266600980, 0x0026600000249999,
+        0x9998619999000001, 0x9999066640019019, 0x0019066464064191, 0x9064196659964106,
+        0x5996590410659659, 0x0465965965965910, 0x4446519465044446, 0x5110445965659444,
+        0x1651651195059444, 0x5945944459594459, 0x5959445959595959, 0x4445111444451165,
+        0x4459459505051165, 0x4444511116559444, 0x4595951950594595, 0x9444445959596511,
+        0x1116510594444441, 0x6519444465104411, 0x1104441194119410, 0x4650659646596465,
+        0x9191065906440404, 0x0659919190190641, 0x9906401900664006, 0x6406666664000661,
+        0x9861861818180026, 0x6666009980026009, 0x9826626626026699, 0x8989898262626202,
+        0x0988269A609A6226, 0x9882269A69A69889, 0xA268226882220888, 0x8829A6A69A26A69A,
+        0x2222229A0A68A6A6, 0x829A29A9A229A229, 0xA29A88282888A6A2, 0x29A9A29A9A9A9A82,
+        0x9A88888A229A8A68, 0xA68A6A6A26A22222, 0x28A6A6A688A68888, 0xA2222229A89A9A08,
+        0xA6A6829A20A68888, 0x8829A68889A22682, 0x220889A2682269A6, 0x9A6988268269A626,
+        0x989A609A62620262, 0x0262626266262662, 0x6626002602600026, 0x0009998026492666,
+        0x6000606060666666, 0x4019999906640019, 0x0064066419199064, 0x6419064646464659,
+        0x9641964410659046, 0x5965964104651041, 0x1044111044465104, 0x4441111659444656,
+        0x5059444141416541, 0x1165111656511651, 0x6516541141444459, 0x5141656514414459,
+        0x5165651165654445, 0x9595951051111655, 0x9459444445111414, 0x4144144459594441,
+        0x6565111111105945, 0x9651104441651944, 0x6504651044104465, 0x1964410465965906,
+        0x5964659064419665, 0x9019641906419019, 0x6190190199199906, 0x6640199990186186,
+        0x6666409264999998, 0x0000999809998002, 0x60998098099A4989, 0x89802699A6698262,
+        0x6982698208209A69, 0x82269A69A6268208, 0x82208882226889A2, 0x6889A20A68229A20,
+        0x8A688882829A8222, 0x9A222229A8829A9A, 0x9A229A9A29A9A29A, 0x288888A6A9A9A29A,
+        0x228888A6A9A8229A, 0x9A88888A6A29A9A9, 0xA22229A88A688A68, 0x8A6A6A6829A9A222,
+        0x9A0A6A689A9A2688, 0x88889A2222688822, 0x2688822088220889, 0xA68269A69A608268,
+        0x209A626982698989, 0x8209826998989989, 0x8266266266026609, 0x9980999980099999,
+        0x9801800001818186, 0x6640000190001990, 0x1990664199064064, 0x6406464191919191,
+        0x9665904196465964, 0x1041041104650650, 0x4119441104465119, 0x4411119596510594,
+        0x4165111111111165, 0x6511111165651165, 0x1656511144444595, 0x1656565111144595,
+        0x1114144459511656, 0x5465444445951441, 0x4144445111654441, 0x6544444450595944,
+        0x4444445959651110, 0x5944416505965110, 0x4651104651046519, 0x6596591041196591,
+        0x0659101041964041, 0x0646464646659906, 0x4190640190664006, 0x4006640666666400,
+        0x6619986619998618, 0x0000009800026600, 0x9982660098098098, 0x9809826260988098,
+        0x9A6098808208269A, 0x60820822082269A0, 0x822682088889A089, 0xA222268822222222,
+        0x2226A68888888888, 0x8A6A68A688282888, 0x8A6A2222229A8A68, 0x88A0A222288A2222,
+        0x8888A29A8288888A, 0x29A88888A6A9A29A, 0x2229A8888A6A6A26, 0xA6888A6A68A689A9,
+        0xA9A2220A6A6889A9, 0xA2688889A2220888, 0x889A088822088822, 0x682269A09A6989A6,
+        0x988269880826209A, 0x609A662626260980, 0x9898260026026009, 0x9826660026660000,
+        0x0266666606198666, 0x6400000666400666, 0x4199066400641906, 0x4199191906419196,
+        0x6590644196464419, 0x6441191196446504, 0x1044110444650441, 0x1110445965944444,
+        0x1165105945944116, 0x5656594594444595, 0x9595944444451144, 0x4459511165144145,
+        0x9511111445951165, 0x1654444459565651, 0x1116544450595105, 0x9511111116544444,
+        0x1654416511111105, 0x1195944411045941, 0x6594110444650441, 0x1041104410411065,
+        0x9659065964196465, 0x9964041919190646, 0x6599019019199019, 0x9006640199900019,
+        0x9999000900000002, 0x4926666000266609, 0x9980098098009826, 0x0980262626260202,
+        0x6202098826209A62, 0x09889A62089A6988, 0x9A682269A089A208, 0x82222208888889A2,
+        0x9A68829A229A0A68, 0x8888A6A688888A68, 0xA6A6A6888A68A0A0, 0xA2228888A2228888,
+        0xA229A88888A229A8, 0x8A6A6A688A22229A, 0x8A68A6A6888A0A22, 0x229A8882882888A6,
+        0x8A688889A8829A22, 0x22220A688829A088, 0x8882220888222268, 0x2089A268269A6268,
+        0x209A698988269898, 0x9A66989826262602, 0x6998098980266260, 0x0098009980266660,
+        0x0000999999999998, 0x6666401819999001, 0x9901990064006466, 0x4190641906419191,
+        0x9664659964659041, 0x9659041196591196, 0x5910446519410446, 0x5119446519444116,
+        0x5959651111059594, 0x4414141414165656, 0x5111116544444451, 0x1165445945959459,
+        0x5951111144595111, 0x1654595944595051, 0x1114445111114445, 0x9511951059510595,
+    },
+    { // hot 24/48
+        0x0066465965051145, 0x4514545165444146, 0x5659644064640199, 0x9906406591045945,
+        0x1165441441416594, 0x41919980988229AA, 0x2A28A8A2AA28A2A8, 0xA8A6A222209A6609,
+        0x9926666660180060, 0x00026609A66989A0, 0x89A6999999901964, 0x4594144459559545,
+        0x6551451144511105, 0x9659619999809A60, 0x889A09A669260099, 0x9264999980600600,
+        0x0026082088A6A22A, 0x28A8A8A8AA28A8A2, 0xA9AA682609990191, 0x9465111105111459,
+        0x5111119410641900, 0x0199906464410411, 0x1116565414514515, 0x1511444441190642,
+        0x42669988829A88A2, 0xA28A88A9A8A0A689, 0xA9A698209A660009, 0x998098209A268888,
+        0xA29A8888888A69A2, 0x6989986404111115, 0x1515151455145514, 0x5151654110659901,
+        0x9866666490242400, 0x9006640101041941, 0x1065900600008268, 0x9A222229AA6A88A8,
+        0xA2A288A88A6A6A69, 0xA620980240019119, 0x6506591966400664, 0x0090000900180618,
+        0x1990404111051451, 0x5145514551454545, 0x1565659190000988, 0x9A0888888A6A6A6A,
+        0x229A208826989998, 0x0026602699A69A69, 0xA0A6A22228A2A28A, 0x28A8888A62260999,
+        0x8664196446544514, 0x5151451445114656, 0x5041196464190199, 0x9990646446594445,
+        0x1114445951944650, 0x46599999A608A6A8, 0xA28A2AA2A28A8A8A, 0x2A888A6A69826261,
+        0x8060000000000249, 0x9266009898988208, 0x89A6266006640410, 0x4459445951145151,
+        0x5115145165444656, 0x59641990000989A6, 0x8208988098980092, 0x4926666666660000,
+        0x0009A6268229AA6A, 0xA22A2A2A8A2A2A2A, 0x28A22689A4000644, 0x1105944414144511,
+        0x1444444119664199, 0x9000640646596596, 0x5959459511445454, 0x5159511119101900,
+        0x000989A622229AA2, 0xA29AA8A6A22229A8, 0x2268209A66998009, 0x9998269820889A88,
+        0xA22282888882829A, 0x6989999019659511, 0x5151455151514545, 0x4544595046599619,
+        0x9009000900060180, 0x6066406464196596, 0x5964190000262626, 0x8829A29A88A28A2A,
+        0x2A288A9AA2222222, 0x6898982640064104, 0x6504659966466640, 0x0006000060618661,
+        0x9901964111111451, 0x5154515151455151, 0x4565650640180982, 0x26888829A9A29A88,
+        0x8A6A682269826626, 0x666609826209A689, 0xA20A0A228A28A22A, 0x8A28A0A69A626024,
+        0x9001904650595145, 0x1595514444516565, 0x1941041966599900, 0x0666599104465165,
+        0x4444511165111194, 0x41906600082229AA, 0x2A28A2A8A8A8A8A2, 0xA88A229A209A6609,
+        0x9909999998600180, 0x6002660989A60822, 0x6880980900019104, 0x4411654444545145,
+        0x4515115111444444, 0x465906640998269A, 0x6220826202600999, 0x9981806060000000,
+        0x0260989A088A228A, 0x2A2A8A8A2A2A2A2A, 0x2A6A088098240644, 0x6504444444595114,
+        0x4444444464401900, 0x0006419010659650, 0x4444595114454455, 0x1451414110419019,
+        0x98009A6268A68A28, 0xA8A88A288A29A822, 0x2208226209809980, 0x00260989A69A6A6A,
+        0x6A0A22229A9A2689, 0xA626000191194451, 0x5151454545514545, 0x4565459411910199,
+        0x9000000000006618, 0x1999019964196441, 0x6441960600008269, 0xA222222288A9AAA2,
+        0x2A6AA6A29A829A22, 0x0880989990019196, 0x5041065919006664, 0x0009000000018606,
+        0x6640659105959544, 0x5451545454545151, 0x5144444191800988, 0x222688888A6A6A6A,
+        0x2222220889A49802, 0x499989809A620882, 0x22229A88A228A2A2, 0xA29AA22682698024,
+        0x9241904105951115, 0x1514565511111144, 0x4111065919019900, 0x1999190410465441,
+        0x4511165416505965, 0x1919000989A69AA2, 0x2A2A2A2A2A2A28A8, 0xAA6A882226988026,
+        0x6649986000600018, 0x0099982609882268, 0x2262009999006441, 0x1059595111655451,
+        0x4515115114445941, 0x1196419998026082, 0x2688262026266000, 0x0000249099266666,
+        0x6626020822288A28, 0xA8A8A8A8A8A2A8A2, 0xA288888260900196, 0x5194111111414459,
+        0x5651104119641990, 0x0000641966596444, 0x6565165444515145, 0x1514459591966400,
+        0x60026209A26A22A6, 0xAA9AA6A28888A6A0, 0x8889A62626926602, 0x499809882088888A,
+        0x6A9A829A220A6888, 0x9A60000665916545, 0x1454545515145154, 0x5451165659101900,
+        0x6186619999924024, 0x0901990196419650, 0x4659199909982698, 0x8888A68A222A28A2,
+        0xA28A8A22888A20A6, 0x89A6009999991041, 0x0446591919066664, 0x0000001800606198,
+        0x6641966519595954, 0x5451455151455151, 0x5114164406499826, 0x88222222229A9A9A,
+        0x8A68822082698009, 0x9999898982022688, 0x9A29A29A8A228A2A, 0x2A288A6822699826,
+        0x4246659110595115, 0x1511514511414654, 0x1104650196664664, 0x9006644046510595,
+        0x1144444595059659, 0x6590660260829A8A, 0x2A28AA28AA28AA28, 0xA2A22889A2699899,
+        0x9999806060000180, 0x0926602609A62082, 0x2269989999019196, 0x5104595951445151,
+        0x4545145144445944, 0x1119066402662698, 0x8822698262600999, 0x9999818060018000,
+        0x9266209A6888A22A, 0x28AA2A2A2A28A8A8, 0xA8A0A69899806659, 0x6596511651051144,
+        0x4511659659064019, 0x9900664644046594, 0x6565111445145445, 0x5115950441065866,
+        0x66009882688A222A, 0x8A28A28A2288A688, 0x889A698202692666, 0x0099808268222222,
+        0x88A22282829A2268, 0x2260264019411144, 0x5515451454551455, 0x1451146565906419,
+        0x8661999900900240, 0x0000641906590465, 0x1964640000260208, 0x89A9A9A9A9AA6AA2,
+        0x2A28A6AA2229A688, 0x8826266000190659, 0x6504101019190000, 0x6060618666199909,
+        0x0006465965111451, 0x4551514545515145, 0x1516564646600269, 0x88889A9A222222A6,
+        0xA9A08889A6098098, 0x6009998809A69888, 0x89A9A8888A2A6AA9, 0xAA2289A9A6982601,
+        0x8199065965111655, 0x5144565511114444, 0x1650410406406400, 0x0666599104411144,
+        0x4511144445944111, 0x0419000262088A6A, 0xA2A22A8A2A8A8A2A, 0x2A29AA69A0989800,
+        0x9926666060180600, 0x180998260209A69A, 0x0898260000190644, 0x4441654595114515,
+        0x1515114451165411, 0x1964640000098208, 0x82269A6260266009, 0x0249249992666600,
+    },
+    { // silence 24/48
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000024018, 0x0000000001809000, 0x0024006000000000, 0x0000000000009001,
+        0x8000000000000000, 0x0002400600000000, 0x0000000900180000, 0x0000000090018000,
+        0x0000000090006000, 0x0000000024001800, 0x0000000240018000, 0x0000024000600000,
+        0x0000240006000000, 0x0090001800000009, 0x0001800000090000, 0x6000000240001800,
+        0x0002400006000002, 0x4000018000009000, 0x0060000240000060, 0x0002400000600009,
+        0x0000006000090000, 0x0006000240000001, 0x8000900000000600, 0x0240000000001800,
+        0x2400000000018002, 0x4000000000000018, 0x0090000000000000, 0x0006002400000000,
+        0x0000000000000000, 0x0000600900000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0900600000000000, 0x0000000000000090,
+        0x0180000000000000, 0x2400600000000000, 0x0240018000000000, 0x0090006000000002,
+        0x4001800000000900, 0x0180000000240001, 0x8000000090001800, 0x0002400018000000,
+        0x9000018000002400, 0x0060000024000060, 0x0000900001800002, 0x4000018000024000,
+        0x0060000240000180, 0x0024000006000090, 0x0000060000900000, 0x0060000900000000,
+        0x6000240000000180, 0x0240000000060009, 0x0000000000600090, 0x0000000000018002,
+        0x4000000000000000, 0x1800900000000000, 0x0000000001802400, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000900180000000,
+        0x0000000000000002, 0x4006000000000000, 0x0090006000000000, 0x0000900060000000,
+        0x0024000600000000, 0x0900018000000024, 0x0001800000024000, 0x1800000240000600,
+        0x0002400006000009, 0x0000060000240000, 0x0600009000000600, 0x0090000000600024,
+        0x0000000180009000, 0x0000000180024000, 0x0000000006002400, 0x0000000000000000,
+        0x0180240000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000002401,
+        0x8000000000000000, 0x0000090006000000, 0x0000024001800000, 0x0024000600000002,
+        0x4000180000024000, 0x1800002400001800, 0x0024000006000090, 0x0000018000900000,
+        0x0018002400000000, 0x0180024000000000, 0x0000000018024000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000090060, 0x0000000000000000, 0x0240018000000000,
+        0x0900018000000024, 0x0001800000090000, 0x1800000900000600, 0x0024000000600009,
+        0x0000000180009000, 0x0000000180024000, 0x0000000000000006, 0x0090000000000000,
+        0x0000000000000000, 0x0000002401800000, 0x0000000000000090, 0x0060000000024000,
+        0x6000000090000600, 0x0002400001800002, 0x4000001800090000, 0x0006000240000000,
+        0x0001800900000000, 0x0000000001802400, 0x0000000000000900, 0x6000000000000000,
+        0x0000000000240006, 0x0000000002400060, 0x0000024000180000, 0x0240000180000900,
+        0x0000180002400000, 0x0006000900000000, 0x0000600240000000, 0x0000000000000000,
+        0x0000000000000000, 0x0009001800000000, 0x0000090001800000, 0x0024000180000090,
+        0x0000600002400000, 0x0600024000000018, 0x0024000000000000, 0x0000018024000000,
+        0x0000000900600000, 0x0000000000000002, 0x4001800000000900, 0x0180000024000060,
+        0x0000900000180002, 0x4000000060009000, 0x0000000018009000, 0x0000000000000000,
+        0x0000000000000000, 0x0900180000000000, 0x0009000180000009, 0x0000600000900000,
+        0x1800024000000180, 0x0090000000000000, 0x6002400000000000, 0x0000000000000000,
+        0x0002401800000000, 0x0000090006000000, 0x0900006000002400, 0x0018000240000006,
+        0x0009000000000180, 0x0900000000000000, 0x0000000000000000, 0x0000000090018000,
+        0x0000009000180000, 0x0090000180000900, 0x0000600024000000, 0x0006000900000000,
+        0x0000000000000000, 0x0000000000000009, 0x0006000000000024, 0x0001800000240000,
+        0x1800009000000018, 0x0024000000000001, 0x8009000000000000, 0x0009006000000000,
+        0x0000000009000180, 0x0000090000180000, 0x9000000600024000, 0x0000000600240000,
+        0x0000000000000000, 0x0000000240060000, 0x0000000240006000, 0x0009000006000090,
+        0x0000018002400000, 0x0000000600900000, 0x0000000000024018, 0x0000000000000090,
+        0x0018000000240000, 0x1800009000000180, 0x0240000000000180, 0x2400000000000000,
+        0x0000009001800000, 0x0000000240006000, 0x0024000006000090, 0x0000001800240000,
+        0x0000000000000000, 0x0000000000000002, 0x4000600000000900, 0x0018000024000000,
+        0x6000240000000000, 0x0180240000000000, 0x0000002400600000, 0x0000000090001800,
+        0x0009000001800024, 0x0000000018002400, 0x0000000000000000, 0x0000000000240060,
+        0x0000000024000600, 0x0009000006000240, 0x0000001800900000, 0x0000000000000000,
+        0x0000000000240018, 0x0000000240001800, 0x0024000001800090, 0x0000000001800900,
+        0x0000000000000002, 0x4018000000000000, 0x2400060000009000, 0x0018000240000000,
+        0x0180090000000000, 0x0000000000000009, 0x0018000000002400, 0x0180000240000018,
+        0x0009000000000000, 0x0060090000000090, 0x0180000000000009, 0x0001800002400001,
+        0x8000240000000000, 0x6002400000000000, 0x0000024006000000, 0x0000009000060000,
+        0x2400000600024000, 0x0000000000018024, 0x0000002400600000, 0x0000002400018000,
+        0x0024000001800090, 0x0000000001800900, 0x0000000009006000, 0x0000000000090001,
+        0x8000009000001800, 0x0240000000000600, 0x2400000000000024, 0x0180000000000009,
+    },
+    { // sine 16/96
+        0x0000060618664000, 0x1990001900664199, 0x1990064646658646, 0x4646464196419641,
+        0x9644196590419410, 0x4119410465041110, 0x4651104651119444, 0x1111110595965659,
+        0x4444444459459444, 0x5944459595944445, 0x1111144451116544, 0x4445111654595959,
+        0x4459511111459510, 0x5111444451116544, 0x4445950595059459, 0x4459444444595944,
+        0x4656519594165944, 0x4411111944441044, 0x4411946504119410, 0x6504659046596419,
+        0x6465919191919191, 0x9065990191901906, 0x4006401900199001, 0x9990061866199240,
+        0x0249092649980000, 0x2660009980266098, 0x0098026999A66260, 0x982699A669826209,
+        0xA62698269A620826, 0x820820889A082268, 0x822688222088829A, 0x268888822229A0A6,
+        0x88A69A9A26A0A688, 0x8A6A6888A68A6A68, 0x8A0A6A222229A88A, 0x0A6A222229AA6A08,
+        0xA6A20A228288A222, 0x29A8A68A68A68A6A, 0x20A0A2229A9A9A22, 0x9A2222229A9A29A6,
+        0x8888888A69A22208, 0xA689A22088822220, 0x882220889A682082, 0x089A08269A698269,
+        0x89A6262020202098, 0x9826998260982600, 0x9826009980998026, 0x6660999999800000,
+        0x0002400000006640, 0x2419999019900640, 0x0641990641901919, 0x0641966440659065,
+        0x9065964196591065, 0x9659104119465041, 0x0444411044444651, 0x0444441651111119,
+        0x5944444444445950, 0x5944444505111116, 0x5445944594595111, 0x1114505111654445,
+        0x9595111165444595, 0x9511165165654414, 0x4444511144444451, 0x1111141416565111,
+        0x0595944465650459, 0x6511104465659411, 0x0441110441104410, 0x4419410410410419,
+        0x6465966441919101, 0x9191919019064190, 0x6641900190199001, 0x9990019990900000,
+        0x6006060000000266, 0x6600099800266099, 0x8266009898098260, 0x262699826982699A,
+        0x6082698826208226, 0x98820822269A09A0, 0x8822688222088882, 0x222226A682222222,
+        0x2222229A226A20A6, 0xA08A68A6888A6A6A, 0x68A688A6A6A6A6A6, 0x8A68A6A6A222229A,
+        0xA6A688A6A6A6A222, 0x229A8A6A688A6A6A, 0x0A6A6A688A6A688A, 0x688A6A68829A89A9,
+        0xA208A68A69A9A682, 0x229A0888882226A6, 0x9A69A68226822682, 0x089A69A6089A6989,
+        0xA62699A620202098, 0x9898269989809826, 0x0260266260009982, 0x6666009998600002,
+        0x4240909090000000, 0x6642419999006646, 0x6646641900641919, 0x9191919064101964,
+        0x4065906596465919, 0x6591046596446519, 0x6504110444651104, 0x4165045941111165,
+        0x9444444444459594, 0x4444445950595045, 0x9595944595959459, 0x5059510511654445,
+        0x9511111445051165, 0x4444505111654459, 0x5944594505951950, 0x5959444459594416,
+        0x5651659441656594, 0x4446511045965044, 0x4111194110441194, 0x1044104104419659,
+        0x1964106590419101, 0x0196646599019040, 0x1906406640664199, 0x0006640001999900,
+        0x0000090006009249, 0x9998026666099980, 0x260266099A498260, 0x9899A66262026262,
+        0x69820209A6989882, 0x0820822682089A68, 0x2268226822208888, 0x222226A69A220888,
+        0xA68829A229A20A6A, 0x6A689A9A9A229A22, 0x228888A2222288A0, 0xA22229A88A0A0A22,
+        0x29A8A6A6A688A6A2, 0x2229A8A68A68A6A2, 0x6A20A22228888A22, 0x2229A9A9A20A0A6A,
+        0x688A69A222226A20, 0x8A69A20888888222, 0x2088822088822269, 0xA69A6989A09A6989,
+        0xA626988262698082, 0x6980809898982602, 0x6026098266626600, 0x9980026600024999,
+        0x9998180006061999, 0x9990066664006640, 0x6640664199619064, 0x0659906410196419,
+        0x1966591964659041, 0x9410410411941046, 0x5196504111944650, 0x4444651105941165,
+        0x1195944116565105, 0x9459594444445950, 0x5050511111445959, 0x5105951111444505,
+        0x1144445956511654, 0x1654444511114445, 0x1116565416516516, 0x5651651111111654,
+        0x4465650594444444, 0x4444116510444465, 0x1044465194119410, 0x4411941196465965,
+        0x9191065919641964, 0x0419664659906419, 0x0641991900664199, 0x0199900199900181,
+        0x9866666664924999, 0x9800249998002660, 0x9998998026026098, 0x098980989A4809A6,
+        0x0209A6269826989A, 0x62269882682089A0, 0x82268222089A2268, 0x2222688889A22208,
+        0xA6888829A9A22222, 0x6A2222222288888A, 0x0A222228888A2222, 0x9A8A6888A0A229A8,
+        0x8888A22888A0A222, 0x8888A228888A6A22, 0x29A9A9A9A229A29A, 0x9A29A22222882828,
+        0x2829A229A26A69A9, 0xA0888889A9A08882, 0x2220888222269A26, 0x9A69882268209A09,
+        0xA6209A62698989A6, 0x0269898262626026, 0x2662609982600998, 0x0998099998099999,
+        0x9800000024009000, 0x0661999906199000, 0x6641990199190064, 0x0646406599065901,
+        0x0196465996410410, 0x4106596591041046, 0x5194119650441104, 0x4444411105946565,
+        0x0444444596565105, 0x9594444594459459, 0x4594445051111144, 0x5951111165444511,
+        0x1114595111111451, 0x1114444511144459, 0x5111165441444445, 0x1114416544654165,
+        0x1111651116504594, 0x4165111104444446, 0x5104444119446504, 0x6596506594196441,
+        0x9410659196410659, 0x0644040659919190, 0x6406406466466400, 0x6401990019990006,
+        0x1999999002409092, 0x4999998249999809, 0x9800980098026266, 0x2662609826262609,
+        0x8989A609A626209A, 0x6269889A62082268, 0x2089A269A0822208, 0x8829A688222226A6,
+        0x829A6A69A9A688A6, 0x89A9A9A2220A2228, 0x28288888A6A229A2, 0x29A9A9A9A9A9A222,
+        0x888A229A9A882888, 0xA229A88888A22288, 0x8A6A22229A9A9A9A, 0x2229A29A9A2229A2,
+        0x2229A222229A2226, 0xA6888222229A6822, 0x2226882220889A08, 0x822089A68209A09A,
+        0x6988269A669A6698, 0x809A669808080989, 0x809A498260266098, 0x0266009980009998,
+        0x0092424992666666, 0x6490000001990066, 0x6641990664019961, 0x9190190646406465,
+        0x9019640410659191, 0x0659646596441941, 0x1941946594104465, 0x1044465110444444,
+        0x1651059459651659, 0x4594465444444445, 0x1111654165656511, 0x6565651654141444,
+        0x4511444451114445, 0x9516516516565441, 0x4445951116565651, 0x1651165416511165,
+    },
+    { // hot 16/96
+        0x0064104444451514, 0x5454455145144451, 0x1044419191906406, 0x4065996411941165,
+        0x0505111114656441, 0x919902602082288A, 0x28A8A8A8A28AA8A2, 0xA288A8888A698809,
+        0x8266618006000000, 0x098099A66262699A, 0x6260099801999659, 0x1114445454515454,
+        0x5451545145451165, 0x1191990600266098, 0x9A66982026098266, 0x6600000240009998,
+        0x99A62688828A228A, 0xA2A28A8A8A8A2A2A, 0x2888882202606665, 0x9194110595111651,
+        0x1165965965901919, 0x0190641919196444, 0x4595951451454545, 0x4515956511964640,
+        0x6098988888A228A8, 0xA8A8A28A2A888A6A, 0x0882082620260262, 0x6009A609A68208A6,
+        0x8888A2222229A682, 0x6099990065965165, 0x5445151545145514, 0x5514459511941966,
+        0x4066640000000000, 0x1900190659919641, 0x96641990009989A6, 0x82228A6AA8A2A6AA,
+        0xA22A28AA28A28A68, 0x9A02609900001966, 0x5906441906466466, 0x6666400900000199,
+        0x1901194414445655, 0x5145145515151451, 0x5116565901992660, 0x82682229A229A9A2,
+        0x2222268208262009, 0x8260262609889A68, 0x88288A2A28A2A28A, 0xA28A2288A6826266,
+        0x1990410451114514, 0x5515145151445951, 0x1104106599664640, 0x6406465910411111,
+        0x1651651656594104, 0x1919860989A688A2, 0x9AAA288AA2A28AA2, 0x8A8A228888822698,
+        0x0099980000000000, 0x2600262609A66209, 0x8989800090919196, 0x5944515955451154,
+        0x5154551451451165, 0x6591992402660260, 0x82699A6098262660, 0x1802490242499982,
+        0x60269A0888A22A22, 0xA8A2A2A8A88AA28A, 0x28A6A08260999906, 0x4659411114654444,
+        0x4596519659190646, 0x4064064101965941, 0x1051145151451515, 0x4454451141104019,
+        0x9802698A68A22A6A, 0xA8A6AA28A9AA6A08, 0x8888269826260980, 0x26262620208829A2,
+        0x2222288A68888208, 0x2600900041059451, 0x4515145454545154, 0x5451444459446464,
+        0x0664000018018199, 0x9900646419196659, 0x0101900618009882, 0x222828A9AAA88A2A,
+        0x8A2A2A2A8A288888, 0xA620998018664641, 0x9106410101006400, 0x1999240990900019,
+        0x0196465111655955, 0x9551454515151515, 0x1144416440199826, 0x09A08829A88888A6,
+        0xA682220826989898, 0x0980980809A69A68, 0x2229AA6AA6A8A28A, 0xA29AA8889A209A40,
+        0x9006441116545145, 0x1514545454451111, 0x6510419640641901, 0x9191901041104444,
+        0x5945959444444119, 0x640180026988A6A2, 0x9AAA6AA22A28AA8A, 0x2A288A2222220809,
+        0x8099999800180000, 0x0998998989A48082, 0x6202660909064196, 0x5111165554454515,
+        0x1515451515165444, 0x4646466499982609, 0x8826080809898266, 0x6666000000002666,
+        0x2609A089A88A6A8A, 0x8A28A8AA2A2A22A2, 0xA229A20826000664, 0x1065110595059505,
+        0x9444110465919190, 0x0641906464659110, 0x4505144515451451, 0x5511445111196400,
+        0x6026089A9A288A9A, 0xAA2A6A8A28A29A88, 0x882269A662626026, 0x6260808269A08882,
+        0x9A9A9A9A2222089A, 0x6266666410444451, 0x1515151454545454, 0x5151655944119640,
+        0x6419999999999000, 0x0066586465996659, 0x064640661800989A, 0x20A6A9AA28A8A8A8,
+        0xA2A2A8A8A88A6A29, 0xA626926661900646, 0x5996419101901990, 0x1999999866640006,
+        0x4065965045956551, 0x1545151545145514, 0x5114411190666009, 0x88208888A6A0A68A,
+        0x688822089A608098, 0x09898098262089A2, 0x226A28A6AA28A2A2, 0xA28A228A26898998,
+        0x1999644445951451, 0x4545454514514459, 0x4650410646419019, 0x1900419119650444,
+        0x4594595959651964, 0x40666666988829AA, 0x288A8AA28A2A8A8A, 0x8A9AA6A26889A609,
+        0x8099980001800000, 0x098099A662626980, 0x8260980001864196, 0x5116545955511514,
+        0x5455151454514444, 0x1119619999802609, 0xA669898982626600, 0x2666666661800026,
+        0x626208822888A2A2, 0x8AA28A8A2A8A8A28, 0xA88889A269090006, 0x5911944141444595,
+        0x0444465964659919, 0x0664641919196444, 0x4595951451454545, 0x4514516546591906,
+        0x0009A6229A288A8A, 0x28A8AA28A29AA229, 0xA69A620989A49826, 0x02609882082226A6,
+        0x8828888A2222689A, 0x6009990641944451, 0x4514551455145454, 0x5151444505941966,
+        0x6466640090900901, 0x9990064646464406, 0x4659990018026269, 0xA22228A28AA8A28A,
+        0x8AA28AA28A9AA6A6, 0x989A660000199190, 0x6590644065864666, 0x4240181800198640,
+        0x1919659441445145, 0x5145451545454511, 0x5145965966664260, 0x9A69A088A6A6A688,
+        0x888889A09A626266, 0x2602609826988220, 0xA68A228A2A28A2A8, 0xA8A2288A2269A606,
+        0x0190659444451151, 0x5451514514544459, 0x4441191019190640, 0x6406590659659444,
+        0x4444451111651940, 0x400666626208888A, 0x8A8A2A28A8AA28A8, 0xA8A288A6A689A602,
+        0x6626660619806000, 0x0098098982699A60, 0x989A426661991964, 0x4444511545451515,
+        0x4514551515954465, 0x1041906600009826, 0x98082699A6626602, 0x6666666600600099,
+        0x826989A2229AA6A8, 0xA8A28A8AA8A28A2A, 0x28A0A69A66009019, 0x1065044459505959,
+        0x4591119659665990, 0x1919064065904651, 0x1111655445151454, 0x5451451165965866,
+        0x66609A088A6A88A2, 0x8AA2A22A88A9A888, 0x882269A609809826, 0x0269989A62268829,
+        0xA229A9A9A2208822, 0x6266019010465444, 0x5454515151455145, 0x5145956565965901,
+        0x9006640909090000, 0x0064664646410196, 0x4196199002666989, 0xA29A9AA6AA88A8A2,
+        0xA8A8A8A8A88A229A, 0x2202609900006410, 0x1964101919619006, 0x6649000009000664,
+        0x0646594656565511, 0x5151565551451514, 0x4544444191999982, 0x69A6222229A9A9A9,
+        0xA688822698826080, 0x260260989A609A08, 0xA68A6A88A2A28A8A, 0x8A88A28888898998,
+        0x0190104444514514, 0x5451545145145111, 0x9596591906464064, 0x0641010659659441,
+        0x6516565651104410, 0x419909982088288A, 0x28A8A8A8A2A2A2A8, 0xA288A888A6820809,
+        0x8266600018000000, 0x26609826020209A6, 0x6982660000019646, 0x5111145154515151,
+        0x5151454551451950, 0x4410190092666262, 0x6980808080989980, 0x0099926649998009,
+    },
+    { // silence 16/96
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0009018000000000,
+        0x0000000000000000, 0x0000000090018000, 0x0000000000000000, 0x0900180000000000,
+        0x0000000090018000, 0x0000000000002400, 0x6000000000000009, 0x0018000000000000,
+        0x2400180000000000, 0x0090006000000000, 0x0240018000000000, 0x9000600000000240,
+        0x0060000000009000, 0x1800000002400060, 0x0000009000060000, 0x0009000060000002,
+        0x4000180000024000, 0x0600000090000180, 0x0002400006000009, 0x0000060000090000,
+        0x0600002400000600, 0x0090000018000090, 0x0000018000240000, 0x0060000900000001,
+        0x8000240000000180, 0x0090000000060009, 0x0000000018000900, 0x0000000006000900,
+        0x0000000006000900, 0x0000000000018009, 0x0000000000000006, 0x0024000000000000,
+        0x0000000006002400, 0x0000000000000000, 0x0000000000000000, 0x0001802400000090,
+        0x0600000000000000, 0x0000000000000000, 0x0000002400600000, 0x0000000000000002,
+        0x4006000000000000, 0x0009001800000000, 0x0000900060000000, 0x0000090006000000,
+        0x0002400180000000, 0x0900018000000024, 0x0006000000024000, 0x1800000090000600,
+        0x0000900006000002, 0x4000018000009000, 0x0060000090000018, 0x0000900000060000,
+        0x9000000600009000, 0x0000180009000000, 0x0180024000000006, 0x0009000000000001,
+        0x8009000000000000, 0x0180090000000000, 0x0000000000000060, 0x0900000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000900600000000,
+        0x0000000000000900, 0x1800000000000240, 0x0180000000000900, 0x0600000000900018,
+        0x0000000240001800, 0x0000240001800000, 0x9000060000090000, 0x1800002400001800,
+        0x0090000006000024, 0x0000001800024000, 0x0000600024000000, 0x0018002400000000,
+        0x0180090000000000, 0x0006002400000000, 0x0000000000000000, 0x0600900000000000,
+        0x0000009018000000, 0x0000000000000000, 0x0000000000024001, 0x8000000000000009,
+        0x0006000000000002, 0x4001800000000900, 0x0180000000090000, 0x6000000090000600,
+        0x0000900006000009, 0x0000180000900000, 0x6000024000006000, 0x0900000018000240,
+        0x0000001800090000, 0x0000018002400000, 0x0000006002400000, 0x0000000000060090,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000002401800,
+        0x0000000000000009, 0x0018000000000002, 0x4001800000000024, 0x0006000000009000,
+        0x1800000090000600, 0x0002400006000009, 0x0000060000090000, 0x0060000900000018,
+        0x0009000000018000, 0x9000000000060009, 0x0000000000006002, 0x4000000000000000,
+        0x0006009000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0024018000000000, 0x0000000009001800, 0x0000000002400180, 0x0000000024000600,
+        0x0000009000060000, 0x0009000018000002, 0x4000018000090000, 0x0600002400000060,
+        0x0024000000600024, 0x0000000006000900, 0x0000000001800900, 0x0000000000000000,
+        0x0600900000000000, 0x0000000000000000, 0x0000000000000000, 0x0024018000000000,
+        0x0000000000002400, 0x1800000000024001, 0x8000000024000600, 0x0000090000600000,
+        0x0900006000009000, 0x0060000090000018, 0x0002400000060000, 0x9000000018002400,
+        0x0000006000900000, 0x0000000600240000, 0x0000000000000006, 0x0090000000000000,
+    },
+    { // sine 24/96
+        0x0000060618664000, 0x1990001900664666, 0x4664640640641019, 0x1906599665904041,
+        0x0659106446591941, 0x0650411941104110, 0x4444111044465111, 0x1044444414165111,
+        0x1110511111165651, 0x6505959595944444, 0x5111654444595111, 0x1114511111459595,
+        0x0505111144511165, 0x4444451114444595, 0x1165111141414444, 0x4595059444444444,
+        0x5945941111111105, 0x9465659650446511, 0x9411941194119419, 0x6596441965919646,
+        0x5906591919664659, 0x9664191901919006, 0x4066466646640001, 0x9901866199900090,
+        0x0000024249999980, 0x9999800998098009, 0x9898026098098982, 0x6260989A6620209A,
+        0x626209A6269A6209, 0xA68269A09A682088, 0x2226888226888222, 0x222088A6829A0A68,
+        0xA69A9A08A6A68888, 0x8A6A6888A6A68A68, 0xA68A6A68A6A0A6A0, 0xA222228A2222288A,
+        0x22229A8A0A6A6A6A, 0x6A6A6A688A6A0A20, 0xA2228888A26A2222, 0x22228888888A26A6,
+        0x8889A9A26A682222, 0x222688889A208822, 0x208888208222089A, 0x69A698226989A698,
+        0x9880826982020262, 0x0262626026026260, 0x2600260098009980, 0x2666600092666666,
+        0x6006186619990000, 0x1999000664066406, 0x6419006419064010, 0x1966440646464419,
+        0x1064419646596441, 0x0659419410411194, 0x1119411044446511, 0x0444465651059656,
+        0x5105944445944459, 0x4444451105116546, 0x5656565111654144, 0x4505116565444459,
+        0x5111165594594459, 0x5111656541414144, 0x4511111444595944, 0x5945944141444414,
+        0x4444444444594111, 0x1110594111119441, 0x1194111941044119, 0x4106504644104196,
+        0x5904041010659064, 0x1019100646419019, 0x0064199064000640, 0x0066400618666664,
+        0x0000909026499998, 0x0026660099980998, 0x0980998980260989, 0x899A660826269808,
+        0x2620826989A69826, 0x8208226820822688, 0x220822220889A222, 0x26882222222220A6,
+        0xA6889A9A226A0A6A, 0x688828888A22229A, 0x9A29A9A9A229A9A9, 0xA2828888A6A9A29A,
+        0x9A29A9A9A8828888, 0xA29A88888A0A2228, 0x88A6A6A6A688888A, 0x6A20A0A6A6A69A29,
+        0xA26A688889A9A20A, 0x69A9A68222088888, 0x9A26820889A08820, 0x822088269A6269A6,
+        0x26982698989A609A, 0x660809A662602609, 0x8266098026602660, 0x2666600999999800,
+        0x0900002400181866, 0x6664199990666401, 0x9006646419919919, 0x0641919664101010,
+        0x6591964196465964, 0x4104194659644650, 0x4410444411044444, 0x6511944465659444,
+        0x4656565944445944, 0x4444595059594594, 0x4444511654141444, 0x4451144594505111,
+        0x1445111144451111, 0x4451111654445959, 0x5059594594595959, 0x4141654416565111,
+        0x1111116511111195, 0x9651111944651044, 0x4651044119465196, 0x4465965964104104,
+        0x1191065904040419, 0x6406440641906464, 0x0190190664066406, 0x6400019900606619,
+        0x9999900909926666, 0x0024999980260009, 0x9899809989809809, 0x82626926269989A6,
+        0x6989A60226989A62, 0x09A08209A089A082, 0x2689A689A0882220, 0x88A69A26888829A2,
+        0x0A688A68229A9A26, 0xA6A68888888A2222, 0x9A8882888A222228, 0xA6A6A6A6A6888A6A,
+        0x29A829A9A9A9A882, 0x888A6A29A29A2829, 0xA88888A6A22229A9, 0xA29A222229A9A9A2,
+        0x6A6829A229A6A69A, 0x222088888829A088, 0x89A2689A08220882, 0x2269A62269882082,
+        0x0826988262698202, 0x6980809A66098989, 0x9899809826000980, 0x0998099999800266,
+        0x6666661818666666, 0x6406619990199901, 0x9901990640190641, 0x9019040646464646,
+        0x4406590419644106, 0x5910465964410446, 0x5046504651044111, 0x1104444411650594,
+        0x4116511111165059, 0x5944445959444459, 0x5959459445959505, 0x9595959595944511,
+        0x1165594595944511, 0x1165595944445111, 0x6544459594459459, 0x5045959444594444,
+        0x4594459416511119, 0x5944651104596504, 0x4465104465046504, 0x4104410411941065,
+        0x9106591964659966, 0x5919190646464199, 0x6191901991990666, 0x4064000066400019,
+        0x8666664249249999, 0x9800026666002660, 0x9998266026099898, 0x09826260269809A6,
+        0x0209A60826989A60, 0x89A6988268268226, 0x82689A6822088222, 0x220888829A0A689A,
+        0x9A68888829A8229A, 0x226A22222229A829, 0xA829A229A89A8888, 0x8A6A229A829A8282,
+        0x88A6A2229A88888A, 0x229A88A68A6A0A6A, 0x26A2229A29A829A9, 0xA9A222229A9A9A22,
+        0x6A6A6889A9A0A688, 0x8829A22208888882, 0x2226889A08822088, 0x22689A69A6089A69,
+        0x88209A608209A609, 0xA602020982026098, 0x2609809809800980, 0x9980099982499998,
+        0x0009024242409024, 0x0006199990199900, 0x0640199199066419, 0x0641906419191919,
+        0x1919196419641196, 0x4419644659119659, 0x6596444111044111, 0x1944441105946565,
+        0x1044444444594444, 0x4444595059444444, 0x5116565165111654, 0x4459594595111116,
+        0x5594595944511114, 0x4451114445951116, 0x5656565111654444, 0x4459511111116514,
+        0x1651110511110511, 0x0594444411111119, 0x4465104465194110, 0x4119441941065065,
+        0x9659965904196419, 0x6599191904064646, 0x4019199619019001, 0x9006640199990019,
+        0x9999900009000902, 0x4926666002666000, 0x9980998098026026, 0x0262602626098989,
+        0xA662626989A609A6, 0x208269A62089A622, 0x089A682208222268, 0x822268889A222088,
+        0x888A69A9A088A688, 0x88A68888888A2229, 0xA29A229A9A29A9A2, 0x29A9A889A88A6A20,
+        0xA22228A6A2229A9A, 0x9A288888A228888A, 0x2222888A0A22229A, 0x8288288888A6A0A6,
+        0x8A6829A229A20A68, 0x8A69A208A689A220, 0x888822208889A268, 0x2089A269889A09A6,
+        0x98226989A699A626, 0x99A60989A6699826, 0x2609809899809802, 0x6609980999980009,
+        0x9801800000900240, 0x0006186666419999, 0x0066406640640190, 0x6406406464646406,
+        0x4659064404196440, 0x4106596591965911, 0x9419411946594659, 0x4111044416510459,
+        0x6511110594444444, 0x5945941656511165, 0x1651165656511165, 0x6544414459511114,
+        0x4445116544459505, 0x9511656514144445, 0x1114444511165654, 0x1651114414444459,
+    },
+    { // hot 24/96
+        0x0064104444451514, 0x5454455145144595, 0x9441065996646466, 0x4190659041194465,
+        0x4165165656596506, 0x46400009889A2228, 0xA2A28A8A8A8A2A8A, 0x8A288A29A9A69809,
+        0x8999800000000249, 0x99989899A6698262, 0x6980998000190104, 0x1656545151451551,
+        0x4545451545144519, 0x4419619999982609, 0xA669826202609980, 0x2499999998180002,
+        0x626208229A9A8A28, 0xA8A2A8A8A8A28AA2, 0x2A22208808000199, 0x6411059445959594,
+        0x4411659644191919, 0x0064190659964416, 0x5111445151511545, 0x1514451446506580,
+        0x602608222888A88A, 0xA28A8A8A288A28A6, 0x889A62699A669260, 0x9826262622688222,
+        0x229A8829A8222082, 0x0260006419659511, 0x4515156555145145, 0x4551144459410406,
+        0x4666424000024019, 0x8640191906465996, 0x4640664018098269, 0xA22288A2A2A2A2A2,
+        0x8AA2A2A28A88A20A, 0x6898980019999664, 0x4040419191901900, 0x0019999999999019,
+        0x9191965059511451, 0x5451455151514515, 0x1595941919018026, 0x269A0888888A6A22,
+        0x9A0889A69A609826, 0x2660982699882268, 0x88A6A228A8A2A2A2, 0x8A8A29A888209A49,
+        0x9901965945951445, 0x5145154565511656, 0x5965041919064199, 0x1919010659411944,
+        0x4595945944444104, 0x191999898208A6A2, 0x2A2A28A2A8A8A8A2, 0xA88A288A6A620809,
+        0x8026600060060002, 0x66602602098989A6, 0x0980982490019196, 0x5195114545451515,
+        0x1545151515165446, 0x5196641980266098, 0x989A669826098026, 0x6006000000024998,
+        0x26082088A6A6A88A, 0x8A2A8A2A8A28AA28, 0xA28829A699980664, 0x6591111111144444,
+        0x5959659646599664, 0x6401919190659659, 0x4444514514551451, 0x5145445959659019,
+        0x800269A20A6A88A8, 0xA28AA28A8A288888, 0xA688209826926926, 0x09898269889A6888,
+        0x9A888A6A6889A269, 0x8998066659650595, 0x4515145151545454, 0x5145165594659190,
+        0x6400019999866664, 0x0199919190646590, 0x6464199024998826, 0x88888A8A2A2A28AA,
+        0x8A28A8A8AA229A89, 0xA080980240066465, 0x9910101064190199, 0x0000601801866640,
+        0x1964104459511451, 0x4551455445511544, 0x5459446590006026, 0x082208A68A6A688A,
+        0x6829A68209A60262, 0x6098026262022682, 0x29A288A9AA8A28A8, 0xA8A22A2226A62600,
+        0x0064104444454454, 0x5451544545144510, 0x5941196659961961, 0x9064196441944111,
+        0x6511654165110465, 0x919999989A69A29A, 0xA9AA28A8A8A2A2A8, 0xA2A228A68889A626,
+        0x0009980000600000, 0x098099A66262699A, 0x6098998061990119, 0x4414451514545514,
+        0x5451551451451446, 0x5196640018266098, 0x9A60209898260998, 0x0000249009249982,
+        0x60269A68888A28A2, 0x8AA8A28AA28A8A8A, 0x29AA682626024064, 0x1065194459594594,
+        0x4441164465919019, 0x0641901966446504, 0x4445114515655595, 0x5954459510441900,
+        0x000988882888A8A2, 0xA28A8A8A88A29A88, 0x89A2698980809809, 0x8269202082208888,
+        0x8A6A6A6888888208, 0x2026490191194451, 0x4515145514545454, 0x5459559444104106,
+        0x4066640090240000, 0x1990190641010644, 0x0658640060008269, 0xA26A29AA8A28A2AA,
+        0x2A28A8A8A88A9A9A, 0x2098998000019191, 0x9664659966464019, 0x9900000090006664,
+        0x0659044465595145, 0x1514554455145451, 0x5116564646402660, 0x9A69A6888A6A6888,
+        0xA68822269A6699A4, 0x98980982699A69A2, 0x6A68A6A8A28A8A8A, 0x2A28A6A822269980,
+        0x0199046565445955, 0x1514455159559444, 0x1659419664641901, 0x9019101041104416,
+        0x5444144445944419, 0x1919860989A6888A, 0x8A28AA28A2A8A8A8, 0xA88A28A6A69A6269,
+        0x2660924909249999, 0x8026626098269898, 0x9826266606640410, 0x4445165545151454,
+        0x5455151451516541, 0x1191901860026026, 0x99A6262626098002, 0x6660000600000998,
+        0x0988208888A22A22, 0xA8A8A2A8A2A28AA6, 0xAA08889A66249006, 0x4410445944595944,
+        0x5941119419641919, 0x0199664196419441, 0x1114451154514545, 0x4544514444119664,
+        0x09809A08A6A2288A, 0xA2A2A28A2A228888, 0xA688082699826260, 0x098989882682208A,
+        0x6A20A6A6A6882269, 0x8980019919650511, 0x5145151515451455, 0x1511451111104101,
+        0x9019992492490900, 0x0664064191966590, 0x6465819992662698, 0x8888A28A2A8A8A2A,
+        0x28AA8A2A28A28888, 0x8898260006664640, 0x4196659190664640, 0x2406186061866646,
+        0x6464411195144455, 0x1454515514545145, 0x1511650646666660, 0x9A69A20A68A6A6A6,
+        0x8822220898826260, 0x09A4989826208220, 0xA6A2228A2A2A28A2, 0xA8A22A6A26826261,
+        0x8640659445951145, 0x5145451514511444, 0x4446596401966419, 0x0191919646504416,
+        0x5656565111059410, 0x64666660826888A6, 0xAA28A2A2A28AA2A2, 0x8A88A9A882226980,
+        0x9802666499999860, 0x0999826262609A62, 0x6098998001990659, 0x1651445151545145,
+        0x5151455151444511, 0x1041901980026699, 0xA609A60989826602, 0x6666666001800026,
+        0x699A69A6A68A6A8A, 0x2A2A2A2A28A8A8A2, 0xA228222026240006, 0x5911044459595944,
+        0x4459644410659966, 0x4010190659964465, 0x1651444545451515, 0x1516551059464664,
+        0x026020888A229AAA, 0x6AA288A8A88A2888, 0x8222269809826260, 0x26026982082220A6,
+        0x8A6A6A6829A9A620, 0x9826619065941145, 0x1451514554455151, 0x4515116544119664,
+        0x6401999986199900, 0x0006464065996419, 0x101919999266269A, 0x629A88A8A2A2A2A2,
+        0xA2A2A2A28A9AA222, 0x69A6026664906646, 0x5906465991961990, 0x0018666661999006,
+        0x6599659444451451, 0x5145545145514515, 0x1159596599990998, 0x20882222228888A6,
+        0xA6889A6989A62609, 0x989809826982089A, 0x29A9A88A28AA28A8, 0xA8A6AA68889A6009,
+        0x9901965944451454, 0x5451514515145959, 0x6510419196658641, 0x9019196411941111,
+        0x1651656511110441, 0x01900266269A2228, 0x8AA28AA22A8A2A8A, 0x88A8A6A9A089A626,
+        0x0999980000000009, 0x9980262609A60269, 0x8980980090064196, 0x5111145154455151,
+        0x5145514545445110, 0x5964190009998982, 0x6982626269980266, 0x0249249092666602,
+    },
+    { // silence 24/96
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0009018000000000,
+        0x0000000000000000, 0x0000000090018000, 0x0000000000000000, 0x0900180000000000,
+        0x0000000090018000, 0x0000000000002400, 0x6000000000000009, 0x0018000000000000,
+        0x2400180000000000, 0x0090006000000000, 0x0240018000000000, 0x9000600000000240,
+        0x0060000000009000, 0x1800000002400060, 0x0000009000060000, 0x0009000060000002,
+        0x4000180000024000, 0x0600000090000180, 0x0002400006000009, 0x0000060000090000,
+        0x0600002400000600, 0x0090000018000090, 0x0000018000240000, 0x0060000900000001,
+        0x8000240000000180, 0x0090000000060009, 0x0000000018000900, 0x0000000006000900,
+        0x0000000006000900, 0x0000000000018009, 0x0000000000000006, 0x0024000000000000,
+        0x0000000006002400, 0x0000000000000000, 0x0000000000000000, 0x0001802400000090,
+        0x0600000000000000, 0x0000000000000000, 0x0000002400600000, 0x0000000000000002,
+        0x4006000000000000, 0x0009001800000000, 0x0000900060000000, 0x0000090006000000,
+        0x0002400180000000, 0x0900018000000024, 0x0006000000024000, 0x1800000090000600,
+        0x0000900006000002, 0x4000018000009000, 0x0060000090000018, 0x0000900000060000,
+        0x9000000600009000, 0x0000180009000000, 0x0180024000000006, 0x0009000000000001,
+        0x8009000000000000, 0x0180090000000000, 0x0000000000000060, 0x0900000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000900600000000,
+        0x0000000000000900, 0x1800000000000240, 0x0180000000000900, 0x0600000000900018,
+        0x0000000240001800, 0x0000240001800000, 0x9000060000090000, 0x1800002400001800,
+        0x0090000006000024, 0x0000001800024000, 0x0000600024000000, 0x0018002400000000,
+        0x0180090000000000, 0x0006002400000000, 0x0000000000000000, 0x0600900000000000,
+        0x0000009018000000, 0x0000000000000000, 0x0000000000024001, 0x8000000000000009,
+        0x0006000000000002, 0x4001800000000900, 0x0180000000090000, 0x6000000090000600,
+        0x0000900006000009, 0x0000180000900000, 0x6000024000006000, 0x0900000018000240,
+        0x0000001800090000, 0x0000018002400000, 0x0000006002400000, 0x0000000000060090,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000002401800,
+        0x0000000000000009, 0x0018000000000002, 0x4001800000000024, 0x0006000000009000,
+        0x1800000090000600, 0x0002400006000009, 0x0000060000090000, 0x0060000900000018,
+        0x0009000000018000, 0x9000000000060009, 0x0000000000006002, 0x4000000000000000,
+        0x0006009000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0024018000000000, 0x0000000009001800, 0x0000000002400180, 0x0000000024000600,
+        0x0000009000060000, 0x0009000018000002, 0x4000018000090000, 0x0600002400000060,
+        0x0024000000600024, 0x0000000006000900, 0x0000000001800900, 0x0000000000000000,
+        0x0600900000000000, 0x0000000000000000, 0x0000000000000000, 0x0024018000000000,
+        0x0000000000002400, 0x1800000000024001, 0x8000000024000600, 0x0000090000600000,
+        0x0900006000009000, 0x0060000090000018, 0x0002400000060000, 0x9000000018002400,
+        0x0000006000900000, 0x0000000600240000, 0x0000000000000006, 0x0090000000000000,
+    },
+    { // sine 16/48 o2
+        0x00001A5261999006, 0x06640619969425A5, 0x0019066586464191, 0x9064658652591919,
+        0x6410650104194646, 0x5191196506519650, 0x6564465646540596, 0x5644444465465119,
+        0x5195965659519594, 0x6559656511165416, 0x5656565659565956, 0x5951956511165596,
+        0x5444595195651116, 0x5444595959595944, 0x4595119564595195, 0x0459596546565959,
+        0x4656519594651195, 0x9651959195965065, 0x6441119411965065, 0x9659194196465961,
+        0x1964646599641919, 0x19065A56065A5696, 0x65A525A599006190, 0x0186664001A52186,
+        0x6186186000009266, 0x6009266969980266, 0x96A5A49A49A42098, 0x269269899A692680,
+        0x9A692269A4A6269A, 0x6989A2698829889A, 0x268220A629A69A98, 0x89A8226A089A8222,
+        0x22229A26A928888A, 0x6A689AA69A9A9A26, 0xA82229A89AA629AA, 0x69AA69A89AA6888A,
+        0x26A829A9A9A9A9A9, 0xA29A9A9A9A9A29A2, 0x9A9A9A2229A9A9A6, 0xA92A69A829A26A99,
+        0xAA6229A6A69A9888, 0x8889A9A69A99A9A6, 0x9A6822682269A09A, 0x262089A6209A0988,
+        0x2698989A609A4898, 0x2692699A49899A66, 0x69260266092625A0, 0x60090998600025A6,
+        0x642424025A460619, 0x9000666418640199, 0x6940066599064190, 0x6464196194964196,
+        0x4106591964659646, 0x5065965911941044, 0x6519656165959950, 0x6565946565946541,
+        0x1956655911651111, 0x6565111165656595, 0x6595959594594595, 0x9505951195465654,
+        0x1655914459519565, 0x9565951956595645, 0x9564595195195195, 0x1959596565645959,
+        0x4465411659591650, 0x5941659465646565, 0x9659651965965911, 0x9419419404119665,
+        0x1994196119196659, 0x9665996196641906, 0x65A5696190199969, 0x6649018199990969,
+        0x0000000096999999, 0x8002499A5A666092, 0x696A5899A6602692, 0x6920202699A669A4,
+        0x8269A669A66A5A80, 0x9A69A626A489A929, 0xA69A68220A629A69, 0xA9888889A9A26A62,
+        0x9A98A6A69A9A26A9, 0x288A6888A6A6A689, 0xAA689AA689AA69AA, 0x69A89AA69AA628A6,
+        0xA6A68A6A26A9A6A9, 0xA6A2229A9A829A89, 0xAA629A89AA629A9A, 0x9A26A9A6888A6888,
+        0x88A689A8222226A2, 0x689A988889A98889, 0xA989A99A989A9298, 0x9A92268268082269,
+        0x2989A4A66989A49A, 0x1A669989899A49A4, 0x9826696A58998026, 0x6002499A58092649,
+        0x9986186199999902, 0x5A598665A5866419, 0x9961901996191996, 0x6464191919065906,
+        0x5994065919658590, 0x4650659659119651, 0x9659659465958595, 0x8504591659596564,
+        0x4596541165950459, 0x4445944595946559, 0x4655914655944459, 0x5195659511165654,
+        0x6559655965444595, 0x0511165591444595, 0x1956595959596559, 0x1146544141654111,
+        0x6511956146565195, 0x9165959164596519, 0x4650441119465965, 0x9659104659665610,
+        0x4106596161065969, 0x5996196658406466, 0x5A56964006496199, 0x018665A5A5999924,
+        0x09699690025A1926, 0x6606969999A5A666, 0x9686099826692690, 0x8266982609A48989,
+        0x89A66809A699A022, 0x69882089A09A09A9, 0x29A69A69A0889A99, 0xA8226A69A6A69A26,
+        0xA689A9A26A6A629A, 0x9A26A98A6A6888A6, 0xA6A688A6A68A6A6A, 0x6A688A6A22229AA6,
+        0x9AA69A888A6A0A22, 0x29AA69A8888A6A98, 0xA26A9A2229A9A9A2, 0x6A9A6A08A68A69A8,
+        0x9A9A6A689A9A26A6, 0x9A26A69A26A6226A, 0x69A69A6A48882208, 0x9A26989A26208208,
+        0x2680826989A4A49A, 0x00809A6692026926, 0x0982669098266690, 0x998026661A5A4909,
+        0x9999861861866666, 0x400018664006665A, 0x5240664199695A59, 0x6940641961964196,
+        0x1191964106596166, 0x5619584650650411, 0x9584441644656446, 0x5659651059656596,
+        0x5419519591656595, 0x9596565111165656, 0x5111656565165165, 0x6565651656565656,
+        0x5656565165654146, 0x5595965594445951, 0x9565950595195195, 0x1951959594146546,
+        0x5650595941651195, 0x0465419506564591, 0x1119599596446519, 0x6596596656650659,
+        0x6411919659964646, 0x4658419619665865, 0x8658196064199019, 0x9006665A58199924,
+        0x001A598181801A58, 0x2424998009266092, 0x669681A426249A49, 0xA498982609A66922,
+        0x626922699A026808, 0x2082089A6989A922, 0x26820A6226A66A02, 0x98A69A26A6222222,
+        0x226A268889AA4A22, 0x2229A229A2229A9A, 0x9A6A226A9A26A9A2, 0x6A9A229A9A9A9A9A,
+        0x29A9A8289AA6A688, 0xA6A0A2229AA6289A, 0xA08A6A6A6A688A68, 0xA6A69AA629A9A6A2,
+        0x6A6889A89A98A6A6, 0x29A26A69A6A69A68, 0x9A26A4A68226A488, 0x9A922089A09A69A6,
+        0x689822699A026989, 0x8989A49A60982609, 0x899A5A9686026696, 0x99A5A42669624999,
+        0x801A5A5A5A5A5A58, 0x18066665A4619001, 0x9996064019019019, 0x0665996196658466,
+        0x5019196419659940, 0x6506596465065941, 0x9411941059111958, 0x5044656596564444,
+        0x4444446558511951, 0x9594465596511656, 0x5111656565659565, 0x9519565951111465,
+        0x5045956451114655, 0x1959595059519565, 0x9519565950595195, 0x1951950595946559,
+        0x1165659594656561, 0x4465419506565946, 0x5194656165046519, 0x6596596591041196,
+        0x5904659041065994, 0x0659966599665991, 0x9966419019960641, 0x86460665A5819990,
+        0x0018186198666186, 0x1800024266069686, 0x6092669098099A49, 0x8260982609A49A66,
+        0x9899A02699A0209A, 0x699A26268269A69A, 0x626A4A69A69A089A, 0x9889A988889A9A08,
+        0x88889AA4A6A689A9, 0xA98A6A6A629A89A9, 0xA9A26A9A0A222289, 0xAA6888A6A26A9A6A,
+        0x9A6A2229A82888A6, 0xA9A6A98A229A829A, 0xA62888A6A0A6A26A, 0x20A22229A9A9A6A6,
+        0xA69A9A2226A9289A, 0x8226A0889A826A69, 0xA689A99A9A69A69A, 0x69A09A26989A96A9,
+        0x6A62626809A69226, 0x92269209A482696A, 0x49826026249A5A96, 0x2660099802499800,
+        0x9099999861806061, 0x8666664001866400, 0x61918190619695A4, 0x6466581064665901,
+        0x0101065846590419, 0x6599464659659194, 0x6591194659410591, 0x6444416595995695,
+        0x5844444444445965, 0x4116511956595944, 0x4459505959594445, 0x9564595645111655,
+        0x9144595195651954, 0x6565656565656565, 0x1165465596565656, 0x5111656565951959,
+    },
+    { // hot 16/48 o2
+        0x0066584656451145, 0x4565546556595059, 0x6561641190640666, 0x4969401941959165,
+        0x5944595195965646, 0x561969699A69A9A8, 0xA9AAA88AA6AA8A2A, 0x6AA9A98A6989A499,
+        0x86001A5896990242, 0x4926026699A626A4, 0x889A486969665859, 0x1195645956559565,
+        0x5511459559654651, 0x94641900002669A6, 0x22682699A6696999, 0x9866181818006969,
+        0x692609A0829AA6A6, 0xAAA6AA6AA9AA8A2A, 0x9AA26A4826186419, 0x4650596565651165,
+        0x5944656599641992, 0x5A58196196465941, 0x1111165595954595, 0x5595944441065866,
+        0x661A4820A69A88A2, 0xA2A6AA98A29AA4A9, 0x889A92269269261A, 0x5892026989A988A6,
+        0xA9A9A9A26A929A92, 0x9A60096964656514, 0x5454565555951565, 0x550511651964665A,
+        0x5818061861999999, 0x9240199619658596, 0x5966592409269226, 0xA66A9A6A229AAA6A,
+        0x2A6AA9A9A9A9A9A6, 0x9A02690924019196, 0x5946411906406664, 0x0969969000696661,
+        0x8641994659459514, 0x5454545655559565, 0x55959659961A5A69, 0x89A9A0A69AA6288A,
+        0x6A9A6A4A66809980, 0x2426696A49A0226A, 0x6229A9A9AA6A9AA9, 0xAA9A8829A09A4981,
+        0xA599199599511159, 0x5565511445116565, 0x9585919496640666, 0x4001919196504595,
+        0x9511656511195046, 0x501969699A69A9A8, 0xA8A2A9AAA88A8A8A, 0x9AAA69A989A02600,
+        0x0909099266666618, 0x61A5A66266809A26, 0x9A69982424066506, 0x5195045954145655,
+        0x5954456559655911, 0x959961902426920A, 0x62269A6699A5A186, 0x0600696069696900,
+        0x2498269A69A9A8A6, 0xAAA6AA6AA88AA6AA, 0xA6A6A69226666584, 0x4656445965591445,
+        0x9565958590406406, 0x0666586465859119, 0x5941655944545955, 0x5945165616599694,
+        0x98026269A688A6AA, 0x22A9AA229AA6A629, 0xA268989A66998690, 0x2499A66989A98A6A,
+        0x6A9A6A9A68889A9A, 0x6202666404111165, 0x5565515955511515, 0x1595465659196640,
+        0x0018060619986666, 0x6425A50964646594, 0x6591901861A5A922, 0x0A689AA6A6A29AAA,
+        0x22A28A6AA4A9A9A6, 0x9A09809999906599, 0x5910419665864006, 0x0606186661999242,
+        0x4061965911116554, 0x4559555954565555, 0x9595616466424826, 0x8226A09AA4A9A29A,
+        0xA69A82089A669998, 0x1A5A6696A669A622, 0x226A9A6A9A9AA9AA, 0x9AA9A26A0209A499,
+        0x9996959965651655, 0x4455956559459591, 0x6519646590665A59, 0x9990665250465656,
+        0x5654655916519596, 0x441900099A09A8A6, 0xAA9AA8A2A2A2A6AA, 0xA9A29A89A69A421A,
+        0x5A5A400240924924, 0x999802609A489A09, 0xA99A600240199665, 0x6594655959511515,
+        0x9555965565111116, 0x44659901A5A49A69, 0xA69A626926999802, 0x5A64242492666666,
+        0x600982089A9A9AA6, 0xAA9AA9AAA9AA6AAA, 0x229AA66869000646, 0x5616564595944595,
+        0x6511645995A56961, 0x8664064191965965, 0x9596565596555951, 0x5165561650659900,
+        0x009202089A9A9A8A, 0x2A6AA89AA6A68A69, 0xA99A982699A499A5, 0x892609A4889A9A6A,
+        0x229AA629A9A26A62, 0x6A5A949906519511, 0x5151515955565455, 0x9551956441196199,
+        0x69001A5986186619, 0x9990019199406519, 0x65961969602669A6, 0x2222229AA6A22A6A,
+        0xAA6A288A29A89A9A, 0x69A4892619901065, 0x0465065865990181, 0x9866199999242409,
+        0x6961964416595445, 0x6555595151515955, 0x56595965A56A59A9, 0x22226A0888A6A222,
+        0x9AA69A6826920266, 0x61A5A1A49A699A98, 0x8A69AA69AA9A2A28, 0xA8A2289A98989800,
+        0x25A5019659445955, 0x1655595116559165, 0x1059196584064018, 0x6665A56659659594,
+        0x5956511116519596, 0x46590909A4888A6A, 0xA9AA9AAA29AAAA6A, 0x2A6A89A9A699A661,
+        0xA580002409092499, 0x2661A42699A62682, 0x2680980900066506, 0x5645945956565565,
+        0x5595145956565959, 0x659065A59A5A0269, 0xA08226269200999A, 0x59800000025A6649,
+        0x2669269A689AA6A2, 0x8AA28A8A8A8A8A8A, 0x9AA80A6686061961, 0x6594656595059511,
+        0x1444446519949061, 0x9990064665065965, 0x9594655959544565, 0x5564511119496642,
+        0x5A1809A682229AA9, 0xAA9AA228A6A9A6A6, 0x9A269A669A5A0000, 0x92669269A6226A98,
+        0xA29A889AA629A682, 0x2098902599650514, 0x5451545655544545, 0x456559656650665A,
+        0x5A59806186199999, 0x9990619695906594, 0x1041960618099A69, 0xA6889AA08A9AA6AA,
+        0x9AA6AA6A26A9A688, 0x9A02024986496465, 0x9650659966581990, 0x2400969006966181,
+        0x9991904111116556, 0x5545159555655145, 0x5956506590009226, 0x9A689A9A26A98A22,
+        0x888A6A4A66809980, 0x25A94A4826989A26, 0x889AA69AA6A28A2A, 0x6AA82222268099A5,
+        0xA599966564459544, 0x5595511159595944, 0x6566561964619696, 0x1864190650465656,
+        0x5654444459591659, 0x6599696926A4A22A, 0x6AAA22A2A2A2A2A6, 0xAAA69A89A69899A5,
+        0xA409024926499999, 0x981A5A00209A626A, 0x4A62609249066596, 0x5965465445955955,
+        0x9559546556595965, 0x1940665A5899A4A6, 0x226A5A8626626666, 0x0069669625A64242,
+        0x666266A5AA088A9A, 0xAA6AA28A8A8A9AAA, 0xA68A69A009999065, 0x9650596565651115,
+        0x9594465610406406, 0x0666586465859119, 0x5941655944545955, 0x4595656446591864,
+        0x9266922689A9A88A, 0x8A8A6AA98A29A29A, 0x6A4A699A02669099, 0x9869269299A826A9,
+        0xA29A89AA66A99A9A, 0x69809925A5405956, 0x5559556556555165, 0x556516519464191A,
+        0x5261866666649242, 0x4000665865995A55, 0x996599969099A668, 0x9A98A6A26AA6A29A,
+        0xAAA62A29AA6289A9, 0xA698266961865904, 0x6561616119969492, 0x492424096900001A,
+        0x5265865695591655, 0x5955145454565555, 0x9595646599092626, 0x9A26A6229A9A2288,
+        0xA6A99A809A696A58, 0x6968602626929A69, 0xA98A6A2228A28A9A, 0xAA0A29A6A6698249,
+        0x9901994195965595, 0x5955056559595965, 0x6596441966586400, 0x0199065859119565,
+        0x9565659564444465, 0x611925A609A69AA6, 0xAA9AA9AAA22A8A2A, 0x9AA89A9A2699A669,
+        0x6000240909264999, 0x999A5A6098988226, 0x89A6699266419041, 0x6459594451655655,
+        0x6554451655965465, 0x95A5666666669822, 0x689A626998998909, 0x249926666618601A,
+    },
+    { // silence 16/48 o2
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000969690000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x000025A5A4000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000096969000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000025A5A400, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x9696900000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000969, 0x6900000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0025A5A400000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000025A5A400,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000969690, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000002, 0x5A5A400000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000025,
+        0xA5A4000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000969690, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000969, 0x6900000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000969690000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000025,
+        0xA5A4000000000000, 0x0000000000000000, 0x0000000000000000, 0x025A5A4000000000,
+        0x0000000000000000, 0x0000000000000000, 0x00025A5A40000000, 0x0000000000000000,
+        0x0000000000000000, 0x25A5A40000000000, 0x0000000000000000, 0x0000000000025A5A,
+        0x4000000000000000, 0x0000000000000000, 0x0000000096969000, 0x0000000000000000,
+        0x0000000000000000, 0x0025A5A400000000, 0x0000000000000000, 0x0000000000009696,
+        0x9000000000000000, 0x0000000000000000, 0x0025A5A400000000, 0x0000000000000000,
+        0x00000000025A5A40, 0x0000000000000000, 0x0000000000000096, 0x9690000000000000,
+        0x0000000000000000, 0x025A5A4000000000, 0x0000000000000000, 0x0000969690000000,
+        0x0000000000000000, 0x0000000969690000, 0x0000000000000000, 0x0000000000969690,
+        0x0000000000000000, 0x0000000000009690, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000025, 0xA400000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000009690,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x000025A400000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000969, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x025A400000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x00025A4000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000969000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x000025A400000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x9690000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000969000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x00025A4000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000969000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000096, 0x9000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x025A400000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000096900000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000096900000, 0x0000000000000000, 0x0000000000000000, 0x00000000025A4000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000009690000, 0x0000000000000000,
+        0x0000000000000000, 0x000000025A400000, 0x0000000000000000, 0x0000000000000000,
+        0x0000009690000000, 0x0000000000000000, 0x0000000000000000, 0x00025A4000000000,
+        0x0000000000000000, 0x0000000000000000, 0x25A4000000000000, 0x0000000000000000,
+        0x0000000000000969, 0x0000000000000000, 0x0000000000000000, 0x00000000025A4000,
+        0x0000000000000000, 0x0000000000000000, 0x0000009690000000, 0x0000000000000000,
+        0x0000000000000000, 0x0096900000000000, 0x0000000000000000, 0x0000000000000969,
+        0x0000000000000000, 0x0000000000000000, 0x0000025A40000000, 0x0000000000000000,
+        0x0000000000000025, 0xA400000000000000, 0x0000000000000000, 0x0000009690000000,
+        0x0000000000000000, 0x0000000000000969, 0x0000000000000000, 0x0000000000000000,
+        0x0000969000000000, 0x0000000000000000, 0x0000000000096900, 0x0000000000000000,
+        0x0000000000000000, 0x0096900000000000, 0x0000000000000000, 0x00000000025A4000,
+        0x0000000000000000, 0x0000000000000000, 0x9690000000000000, 0x0000000000000000,
+    },
+    { // sine 24/96 o2
+        0x00001A5261999006, 0x06640619969425A5, 0x0019019184190641, 0x9619641966590659,
+        0x6119646596656956, 0x9596656651941959, 0x9591195911959659, 0x4465659465651959,
+        0x4656511956445945, 0x9465596541656565, 0x9565951956451116, 0x5591444511165591,
+        0x4459519565195411, 0x6544445951956595, 0x0595195059595946, 0x5591656595045946,
+        0x5416595965119594, 0x1111959659656656, 0x5911959958591196, 0x5964650659194940,
+        0x6596106596959961, 0x9640646659906406, 0x658665A5025A5249, 0x6960666640969696,
+        0x9696969699099998, 0x0909980926024869, 0x2602602609826698, 0x09A49A62609A609A,
+        0x69208209A09A6268, 0x269A69A6989A99A9, 0x89A989A9889A9A69, 0xA988889A822226A9,
+        0x29A9A988A6A68289, 0xA89A829A9A229A29, 0xA9A29A9A229A889A, 0xA08A6A26A9A6A9A6,
+        0xA98A29A29A89AA68, 0x9AA6A69AA69A889A, 0xA6888A6A68A6888A, 0x6A68888A68888A68,
+        0x9AA4A6A69A9A689A, 0x9A69A9889A9A69A0, 0x89A99A989A089A68, 0x089A09A6989A6269,
+        0xA489A66869898269, 0x9A49A60262662669, 0x2609982666909980, 0x0999869690249266,
+        0x6666666492400018, 0x6665A58664066658, 0x6658196065865864, 0x6466596959919196,
+        0x4196599659046596, 0x6561641644110441, 0x1194650446564654, 0x1959650594165119,
+        0x5044445944655916, 0x5651956459505959, 0x5944459564595195, 0x6519541165414445,
+        0x9565951116546559, 0x6559654655965591, 0x6544655946559165, 0x6565051951959446,
+        0x5585950465465195, 0x9651959111959645, 0x9111946594195844, 0x1194196596164659,
+        0x1964106599401064, 0x6419664665996190, 0x665A569619969490, 0x0061925A46186664,
+        0x9249092499999800, 0x02499A5A4261A499, 0x826696A5A4809899, 0xA669209898989A66,
+        0x98989A699A022698, 0x9A69A6989A269A69, 0xA69A269A6A4A689A, 0x99AA5AA96A9A69A9,
+        0xA68888888A68888A, 0x68A69AA629A9A29A, 0x229A9A9A9A229A9A, 0x9A9A9A9A9A229AA6,
+        0x288A6A26A9A6A9A6, 0xA98A22289AA6A69A, 0x8888A6A0A6A6A688, 0x8A6A69A89A9A98A6,
+        0xA6829A98A6889A9A, 0x26A62226A69A2682, 0x22689A269A682682, 0x089A09A69A66A5A8,
+        0x026809A692680209, 0x898982696A666266, 0x999A498026009980, 0x2498002499860000,
+        0x25A6496990001806, 0x6649696199006640, 0x1900640665865864, 0x6404065841919665,
+        0x9191964659946465, 0x9646506504119419, 0x5995919591959659, 0x4116459656459656,
+        0x5059465465659595, 0x9165411656511656, 0x5195411165446559, 0x4459595959595945,
+        0x9595195645116544, 0x4459565951956595, 0x1956451956595195, 0x0595965599565959,
+        0x4165659596564594, 0x6565946564465659, 0x6519651965065611, 0x1941941965966519,
+        0x1964659949496464, 0x1966584191996641, 0x9066466419901990, 0x0666418199909696,
+        0x9600696600000092, 0x4998000999A5A666, 0x9686099826692696, 0xA498262668699A62,
+        0x609A1A6929292989, 0xA6989A09A6826820, 0x88222689A6A4A689, 0xA26A62226A089A82,
+        0x226A929A9A988A6A, 0x6889AA69A9A6A98A, 0x6A26A0A6A26A98A6, 0xA9A6A26A9A6A98A2,
+        0x29A889AA26A0A6A9, 0xA6A22229AA69A89A, 0xA69A829A89A89A89, 0xA89A829A229A2222,
+        0x9A226A99AA66A929, 0xA98A69A9889A826A, 0x66A029889A929A69, 0xA62268269A699A96,
+        0xA02698209A609A62, 0x609A482692692692, 0x69080260921A499A, 0x5A66600926660000,
+        0x2424924992490969, 0x01819996969425A5, 0x999695A466586466, 0x5865991919065846,
+        0x4646590419646596, 0x6569569591965065, 0x0656656441645911, 0x1195965959956654,
+        0x1111111111165111, 0x1165116511651165, 0x6511656565111465, 0x5944459511114655,
+        0x0459511165654655, 0x9655914459595059, 0x5195645956459595, 0x9596546565659504,
+        0x5946558519504446, 0x5584594656444656, 0x5965046566564656, 0x1119419419404659,
+        0x6651994665966590, 0x6599640659961961, 0x9695806461918640, 0x6196960664000619,
+        0x999909025A664266, 0x6661A5A424980926, 0x69686092696A5A66, 0x92626098269209A6,
+        0x699A699A62699A96, 0xA1A6982268268988, 0x9A269A6820A62988, 0x889A988889A9A268,
+        0x89A82222222229A2, 0x2229A229A2229A9A, 0x2229A829A9A9A9A2, 0x29A9A829A889AA0A,
+        0x6A6A6A6A6A6A6A6A, 0x68A6A6A6A0A6A0A2, 0x6A9A2229A9A9A9A6, 0xA988A26A988A6A6A,
+        0x629A9A0A6A69A98A, 0x689A9A0A629A6A62, 0x6A69A09A98822268, 0x2269A09A69A69298,
+        0x9A0268262698989A, 0x6698269269826699, 0xA49A5A96998099A5, 0xA1800999A5A5A199,
+        0x9801A580025A4069, 0x666199096966665A, 0x5990066461961996, 0x6466586599665841,
+        0x9665961065966525, 0x1995A55A56465965, 0x9659119599591195, 0x9195965059651959,
+        0x6511950444459654, 0x1659561444595946, 0x5594146559654654, 0x4445951111655914,
+        0x4595051116559145, 0x9594595051954111, 0x4655959144595944, 0x5959445944594459,
+        0x4655911165119561, 0x6564594165959111, 0x0596504465194659, 0x6596596446596465,
+        0x0119641196161611, 0x9611919065991919, 0x961961906658665A, 0x5096966640606664,
+        0x001A599866198618, 0x0696090999A5A5A0, 0x696999A5A9626692, 0x696A5A0266982609,
+        0xA6698989A669A668, 0x26989A6989A0826A, 0x4A626A66A620A622, 0x26A62226A69A6A69,
+        0xA6A69A9A6889AA66, 0xA98A6888A68A689A, 0xA68289AA6289AA68, 0x88A6A6A6A6A6A6A6,
+        0x8A6A6A6A6A6A6A6A, 0x6A68A6A6A0A6A98A, 0x6A98A2229A89A889, 0xAA69A9A9A26A98A6,
+        0xA69A8229A26A2688, 0x9A822226A09A9A68, 0x9A26A4A689A089A2, 0x69A09A26989A9208,
+        0x9A0209A0989A6920, 0x8269209A60269202, 0x692696A5A1A5A182, 0x6669686002499800,
+        0x2426666618181818, 0x6199990001866400, 0x6665A52406646196, 0x1919969599966599,
+        0x6659065996599659, 0x9404659058596465, 0x1965964441119465, 0x1946519441659465,
+        0x6505965659444444, 0x5946559116565956, 0x4450519565950595, 0x1956459565951956,
+        0x5956595645116544, 0x6551950595645111, 0x4655944459505951, 0x9519505959596565,
+    },
+    { // hot 24/96 o2
+        0x0184194654655655, 0x9556554456556451, 0x9591941919966419, 0x0196196599590595,
+        0x9465591465585919, 0x49601A5A698888A2, 0x8A2A2A28AA6AAA6A, 0xA6AA688A6A699A96,
+        0x9980909249249266, 0x0026609A49A62608, 0x2626690249019941, 0x1951955955955655,
+        0x4515151515954656, 0x59665999999A4269, 0x9A69269899A66690, 0x2666661861869692,
+        0x609A698A68A6A88A, 0xA6AA8A6AAA9A9AAA, 0x9A6A9A6681A40184, 0x1065614655965656,
+        0x5195964650646419, 0x0665990646590591, 0x6516544545151595, 0x559511655859065A,
+        0x5A66268229AA6A28, 0xAA6AA9AA288A9A9A, 0x2268268699A49A42, 0x692699A6989A9288,
+        0x9AA69A9A9A26A668, 0x2669696659195951, 0x1514545655559515, 0x159550459591965A,
+        0x5690619986666664, 0x0061006599665906, 0x5901900181A5A920, 0xA688A6AA9AA9AAA6,
+        0xAA9AA9AAA228A6A6, 0x9A69980000199199, 0x4964641966586400, 0x666649092425A5A5,
+        0x6965919595945145, 0x6555595151514545, 0x6559465019000099, 0xA09A689A889AA69A,
+        0x9A6A6989A0982699, 0x809899A49A1A09A9, 0x2A68A6AA6A9AAA22, 0xA9AA9A29A989A660,
+        0x0184644444516555, 0x9565556545165594, 0x1659641065810665, 0x8646464650164459,
+        0x4655965465650650, 0x641866099A0888A2, 0x8A2A9AAA6AA6AAA6, 0xA9AA829A9A089A48,
+        0x0998025A64024249, 0x9802602692686982, 0x699A426606196956, 0x9565115955451455,
+        0x1595551151459565, 0x9119199924982669, 0x9A1A62669A5A0024, 0x9980696696696999,
+        0x899A09A9A6A9A2A6, 0xAAA6AA6AA9AA9AA8, 0x8A29A269A5A19906, 0x4659411165656519,
+        0x5644656161665996, 0x1919961966596444, 0x6559655655955445, 0x4565565956956966,
+        0x182669A26A229AAA, 0x6A8A2A2A6AA6A6A6, 0x89A0826982602696, 0xA5A69268089A26A6,
+        0x9A829A9A9A6A6209, 0xA600001904111165, 0x5445456555445454, 0x5459559465646590,
+        0x1990060606060666, 0x65A5901919040419, 0x665865A5A5A49A62, 0x26A229AA8A2A2A2A,
+        0x6AAA9AA6AA89AA62, 0x22699A5A41864065, 0x9965865906461258, 0x0666666664924061,
+        0x9610411111655115, 0x9555654545451515, 0x95585194966199A4, 0x9A09A98A6A6A6888,
+        0xA689A92989A66980, 0x99A49A49A609A268, 0x29A9A8A6AA9AA28A, 0x8A2A6A82298899A4,
+        0x0066596595651451, 0x5151455955951116, 0x5194646599619695, 0x8065996465065659,
+        0x4459594445946506, 0x586402662682229A, 0xA9AA88AA6AAA6AA6, 0xAA9A9AA629A09A60,
+        0x999A5A4025A49026, 0x6609269989A48269, 0xA5A9099986665919, 0x4654159551454545,
+        0x6555595655594594, 0x6501969660249A49, 0xA1A6266869982660, 0x0249264999266009,
+        0x9A489A26A68A22A2, 0x8AA6AAA26AAA9A8A, 0x288A0A6082499906, 0x4119465656595615,
+        0x9465644104196646, 0x6586586584194659, 0x4444565595565595, 0x5595956511941925,
+        0xA5A9689A9A9A9AA8, 0x8AA28A2A9AA229A9, 0xA689A69209826099, 0xA6609A6089A689A9,
+        0xA6A0A6A6A689A082, 0x6999866464465445, 0x9555951595556545, 0x5955959594659665,
+        0x8640018181818619, 0x9696196196466501, 0x9619619992669208, 0x8888A28A9AAA8A6A,
+        0xAA6A8A9AAA9A29A2, 0x269A49860619695A, 0x5619641961961901, 0x8199992499240061,
+        0x9611965959595165, 0x5544559554595559, 0x4565119406642660, 0x9A69A08A68A6A688,
+        0x8A69A269A669A420, 0x26099A669208226A, 0x69A888A8A6AAA26A, 0xAA26AA6282982690,
+        0x9696585959595655, 0x6554514545165596, 0x5659958659961919, 0x9695991965911195,
+        0x0595944595965940, 0x65866602699A89AA, 0x22A2A6AAA6AA6AA9, 0xAA9AA68A689A0989,
+        0x9A5A199999999860, 0x0266699898989A48, 0x9899A49266658650, 0x4655959551454565,
+        0x5559545151451165, 0x1949664909980982, 0x6982699A6099A5A0, 0x6069609690090986,
+        0x9989A69A9A6A88A2, 0xA9AAA9AA28AA6AA9, 0xA88A682266924066, 0x5966541165165165,
+        0x1111059196599610, 0x1996646659196444, 0x6559445655595595, 0x5165565111958196,
+        0x926699A9A2288A9A, 0xAA9AA29AAA98A222, 0x9A68269A5A926699, 0x9A6699A699A98889,
+        0xAA69A89A9A9A6989, 0xA600001904111165, 0x5445456555445454, 0x5655591656591064,
+        0x6196969600001818, 0x6496190646465846, 0x4646640606969A66, 0xA69AA6A28AA6AAA6,
+        0xAA6AA9AA8A6AA69A, 0x089A49A598664665, 0x9191961949619018, 0x649025A425A41864,
+        0x1996596519541456, 0x5554454565555945, 0x65566564665A4099, 0xA09A6882888A6A68,
+        0x88889A92209A4826, 0x026099A60989A089, 0xA89A8A6AA6A8A9AA, 0xA9A9AA26A0826999,
+        0x8665904459595445, 0x4545156556559596, 0x5659665019199619, 0x1996119194104445,
+        0x9655916558519419, 0x6406182489A688A2, 0x9AAA9A8A8A9AAAA6, 0xA9AA9A29A26A4826,
+        0x0999A58025A40909, 0x99A5A1A482692262, 0x6926926661996119, 0x4654459555956555,
+        0x4595559545165504, 0x1665001806968692, 0x09A669A5A999A5A1, 0x8600000000009260,
+        0x2609A269A89AA22A, 0x28AA2A6AAA6AA6A8, 0xA6A89A699A492419, 0x9419465656595644,
+        0x5959659106525996, 0x1906406584644111, 0x1956565595565595, 0x5595956511941996,
+        0x968699A9A6A9A8A6, 0xAAA9A9AAA98A9A89, 0xA99A982692699899, 0x899A668682682222,
+        0x29A29A29A9A68226, 0x920025A506594459, 0x5565595545955565, 0x4565564519591961,
+        0x9696664926492400, 0x0199184196194964, 0x6419061992602698, 0x8888A9AA9AA8A9AA,
+        0xA9AA2A28AA6A9A9A, 0x69A6690909696461, 0x1961191919966406, 0x0666424249096966,
+        0x6599410595951159, 0x5559559554454515, 0x1445958464060692, 0x6808829A9A9A6A98,
+        0x8A689A2699A02609, 0x826692699A6689A6, 0xA69AA6A29AAA9AA2, 0x8A9AA9A2226A5A96,
+        0x0199665651144545, 0x1515955595954654, 0x1195996466599606, 0x5865841065196564,
+        0x5959594445941194, 0x06400249A620A26A, 0xA9A8A9AAA88A8A8A, 0x9AAA26A0A6826809,
+        0x9A5A199999999860, 0x09260262609A609A, 0x6699824999906465, 0x9596551655565565,
+        0x5595565565565165, 0x9466599926602609, 0xA489A48269269099, 0x8009699240909989,
+    },
+    { // silence 24/96 o2
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x25A5A40000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0025A5A400000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000096969, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000025A5A400, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000096, 0x9690000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x9696900000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x9696900000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x000000025A5A4000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000009,
+        0x6969000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000096, 0x9690000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000969, 0x6900000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x00025A5A40000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0025A5A400000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x00000000025A5A40, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000025A5A400, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x00000000025A5A40, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000969690000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x25A5A40000000000, 0x0000000000000000, 0x0000000000000000,
+        0x000000000000025A, 0x5A40000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x00000025A5A40000, 0x0000000000000000, 0x0000000000000000, 0x0000000000025A5A,
+        0x4000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0969690000000000,
+        0x0000000000000000, 0x0000000000000000, 0x00000000025A5A40, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x00025A5A40000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000096969000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000969690, 0x0000000000000000, 0x0000000000000000, 0x00000000000025A5,
+        0xA400000000000000, 0x0000000000000000, 0x0000000000000096, 0x9690000000000000,
+        0x0000000000000000, 0x0000000000000096, 0x9690000000000000, 0x0000000000000000,
+        0x0000000000000009, 0x6969000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0969690000000000, 0x0000000000000000, 0x0000000000000000, 0x000025A5A4000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000969690000, 0x0000000000000000,
+        0x0000000000000000, 0x0000096969000000, 0x0000000000000000, 0x0000000000000000,
+        0x025A5A4000000000, 0x0000000000000000, 0x000000000000025A, 0x5A40000000000000,
+        0x0000000000000000, 0x0000000096969000, 0x0000000000000000, 0x0000000000000000,
+        0x0025A5A400000000, 0x0000000000000000, 0x0000000000000025, 0xA5A4000000000000,
+        0x0000000000000000, 0x0000000000009696, 0x9000000000000000, 0x0000000000000000,
+        0x00000000025A5A40, 0x0000000000000000, 0x0000000000000000, 0x000025A5A4000000,
+    },
+    { // sine 16/48 o3
+        0x0000060199999000, 0x1990006641990019, 0x0640190641901966, 0x4101964040419646,
+        0x4659106591965964, 0x6596596596446504, 0x4411044441659411, 0x6594441165105944,
+        0x4459416565111111, 0x6565165116516516, 0x5651656516565656, 0x5165654165444451,
+        0x1114595050511144, 0x4595111656565165, 0x6516516516516511, 0x1141656511111111,
+        0x6511110595965119, 0x4444111104444411, 0x9441194659419659, 0x6591065965906596,
+        0x4196465996659040, 0x6419191900646658, 0x6646400664199900, 0x1999000061999999,
+        0x9990999999800099, 0x9980026609980099, 0x8980998980989809, 0x8989898269808202,
+        0x0826989A6209A69A, 0x6269A09A682089A2, 0x689A089A20888882, 0x2222220A68889A9A,
+        0x222222222229A9A9, 0xA0A6A688A6A68A68, 0x88A22229A888A6A6, 0xA6A6A6A68A6A6A0A,
+        0x0A229A8888A6A29A, 0x29A29A888888A228, 0x88888A229A29A9A2, 0x2222282829A9A220,
+        0xA68A68829A26A682, 0x2222268882220888, 0x8220889A269A69A6, 0x2682089A6089A698,
+        0x2698208262699A66, 0x2026260982609802, 0x6099826002660099, 0x9809999998009024,
+        0x0924090000000199, 0x9001999000640190, 0x0190664665864646, 0x6599196646590106,
+        0x5919641065964419, 0x4196596591044110, 0x4441104444111194, 0x4444111111110505,
+        0x9459651650595944, 0x4459459445959445, 0x9459505950595105, 0x1165444451111445,
+        0x9511165654444451, 0x1144451111654459, 0x5944459595959444, 0x4459594459444414,
+        0x4444444444596565, 0x9411111045965944, 0x1194411941194119, 0x6596441065065910,
+        0x6591910106599641, 0x9191906464019190, 0x6646640190066406, 0x6664186666400000,
+        0x0181800180024266, 0x6600266600998026, 0x0099898026098260, 0x98269982020209A6,
+        0x698826209A6209A0, 0x9A698822682089A0, 0x8822268822088882, 0x29A0888829A22222,
+        0x0A68A68889A89A9A, 0x29A0A6A26A0A68A6, 0xA6A688A68A0A2222, 0x888A6A229A9A9A29,
+        0xA9A88888A22288A6, 0xA22222888A6A229A, 0x22829A888888A222, 0x228289A8829A29A2,
+        0x2226A20A68829A22, 0x26A69A26889A2088, 0x9A2088222689A698, 0x89A09A09A6982269,
+        0x89A62699A6262026, 0x26998202609A4982, 0x6009899802600098, 0x0026600002666660,
+        0x0600006006186666, 0x6406666646664019, 0x9199019006466586, 0x5990659919664404,
+        0x1910659191041965, 0x9641194194104650, 0x4411044111119441, 0x1110459651111195,
+        0x9465651195959416, 0x5165111651656511, 0x1144444511144445, 0x9511165444445956,
+        0x5651114445951114, 0x4445951165656511, 0x4144444511656511, 0x1656511651111111,
+        0x6565110594444416, 0x5111119446511044, 0x6511946594104411, 0x9410411965964659,
+        0x0464419646465901, 0x9665906419064191, 0x9919906646640064, 0x0019990619999900,
+        0x0000060000602426, 0x6666002666026660, 0x9980260998980262, 0x60980809A6620202,
+        0x09882698269A6209, 0xA620822682682089, 0xA268208882220888, 0x89A2226888829A20,
+        0xA6888A69A29A226A, 0x20A6A6A6888888A6, 0xA2229A29A29A9A9A, 0x9A29A282888A6A22,
+        0x9A9A9A9A282888A6, 0xA229A9A29A888288, 0xA22229A88888A0A0, 0xA222229A9A9A0A68,
+        0xA68889A8229A26A6, 0x9A22268888222226, 0x889A0889A0882268, 0x2268269A69A609A0,
+        0x9A6209A609A60808, 0x2626998269982626, 0x0260266260099809, 0x9800266002499999,
+        0x8000000000018019, 0x9999901999000664, 0x0664199064019064, 0x1901966464641010,
+        0x1010419641965966, 0x5964410465965965, 0x9110441119441110, 0x4444165044459651,
+        0x0594444444459444, 0x4445959445944445, 0x9511111165444505, 0x9511111445951111,
+        0x4144595111654444, 0x4511444459511656, 0x5165651651656516, 0x5111656511651111,
+        0x1165116505944441, 0x6511110596511944, 0x4119444119465046, 0x5941941965965904,
+        0x1965966591964041, 0x9640406599664190, 0x6419019019906640, 0x6640066400001990,
+        0x9000000000000090, 0x2666660099980026, 0x6099826600989989, 0x80989809A6626202,
+        0x699A60820208269A, 0x6209A62089A08208, 0x822689A088220888, 0x89A220888829A222,
+        0x0A68882829A29A20, 0xA6A6888A688A68A6, 0x88A6A6A6888A6A22, 0x222888A2222888A2,
+        0x229A88A68A222228, 0x8A22282888A22228, 0x888A229A9A9A229A, 0x229A9A9A226A2222,
+        0x22222829A2222222, 0x6A68882222222688, 0x9A20888220888220, 0x8820882088208208,
+        0x208208202082699A, 0x6269982026998982, 0x6099898266099809, 0x9809998249998000,
+        0x9266499998619999, 0x9900001999901999, 0x0666419906646401, 0x9064640646464191,
+        0x0101964659065910, 0x6591196465041046, 0x5044104441104441, 0x6594111110596511,
+        0x1110594459656510, 0x5959459416565651, 0x1651114144445951, 0x1651165444459511,
+        0x1144595951111144, 0x5951111654459594, 0x5959450595105111, 0x1654414146544414,
+        0x1654111651195944, 0x4441165104444446, 0x5119465194659410, 0x4411046596596465,
+        0x9641041041964196, 0x4646599040659919, 0x0191901900640190, 0x1990066640666664,
+        0x0006186619986618, 0x6006024999800266, 0x0026002600980980, 0x2699809898982626,
+        0x9989A66988262022, 0x6989A6989A082682, 0x08822689A0822208, 0x8882222268888222,
+        0x9A08A688829A229A, 0x222222229A829A29, 0xA229A228288888A2, 0x228888A222288A6A,
+        0x2222288A6A2229A9, 0xA88888A22288A6A6, 0xA6A6A688A6A68A6A, 0x68A688A688A688A6,
+        0x88A6889A829A2220, 0xA68A69A20A69A222, 0x08829A68822689A0, 0x89A0822682082269,
+        0xA62698826989A608, 0x09A6262609A66080, 0x9826098098026099, 0x8266602660000999,
+        0x8000909099249249, 0x2400000066640666, 0x6401900664064064, 0x0641901919190196,
+        0x4040419665966596, 0x4194196465041041, 0x1946596504104444, 0x6519441111045965,
+        0x1111195946565119, 0x5045944459445944, 0x5945945945959459, 0x4595959459519511,
+        0x1165459459451111, 0x4445951656511656, 0x5441444595111114, 0x1444459510594595,
+    },
+    { // hot 16/48 o3
+        0x0066465965051145, 0x4515144514459594, 0x6519659064640666, 0x6401906596444445,
+        0x1654444459444441, 0x19664009826888A2, 0xA28AA28AA2A28A2A, 0x8A88A6A69A699809,
+        0x2666666060060018, 0x0026662609A6089A, 0x269A666006190410, 0x4444459511451451,
+        0x5151445145959446, 0x5191919998009889, 0xA089A60809826601, 0x8000000002490926,
+        0x66626209A22228A2, 0xA2A2A2A28AA2A28A, 0x8A29A9A660240646, 0x5044446544144451,
+        0x1444416596659990, 0x0066658404104111, 0x1959595111445455, 0x1151116510646406,
+        0x00098209A2229AA2, 0x8A9AA88A6A29A222, 0x22689A6080998999, 0x8002609888222222,
+        0x88A2228289A9A689, 0xA699861901195951, 0x4551154545451545, 0x1514445941040664,
+        0x0006006060661999, 0x9990064065906504, 0x4119064024980820, 0x888A68A6A228A2A2,
+        0x8A8A28A229A88888, 0x2269826666406441, 0x1046596659900199, 0x9242409009000006,
+        0x1999106504595115, 0x1454551514515455, 0x1654446599999826, 0x8222226A6A68A6A6,
+        0xA22226A626998266, 0x1802662609A69888, 0x89A82888A22A28A8, 0xA2A6A22268260980,
+        0x6064065941114451, 0x5445451655959441, 0x6504659191901999, 0x2419919641195959,
+        0x5951111165165941, 0x196400999A68888A, 0x8A8A8AA22A8A8A8A, 0x2A22A68889A66266,
+        0x0000000000092499, 0x0998026026989A08, 0x2269826664006441, 0x1111111445145151,
+        0x4515145116546565, 0x04196664009809A0, 0x89A69A6026099800, 0x0900909099266666,
+        0x662609889A9A28A2, 0x8AA28A8A8A8AA22A, 0x8A229A0989924196, 0x4465111651051144,
+        0x5111659659064066, 0x6400191906446504, 0x4444451165514514, 0x5451165659640664,
+        0x92662698829A88A2, 0xA2A6AA2228888A20, 0xA69A09A609809980, 0x099989A668222222,
+        0x88A229A9A2222688, 0x2260924019651115, 0x1454545514545451, 0x5459565046590640,
+        0x0001806066186666, 0x6640064040659659, 0x6441919999826082, 0x220A22228A29AA8A,
+        0x28A9AA9A88888888, 0x89A0260060640650, 0x4110410641901999, 0x9090900900000000,
+        0x6664644110595655, 0x1454545154545451, 0x5144596419099808, 0x89A22220A6A22228,
+        0x8A2220889A669266, 0x0002600808208222, 0x0A6A6A6A222A6AA8, 0x8A9A8A69A0989824,
+        0x2419910651111451, 0x5145445145959594, 0x4104410659919900, 0x0019010119411165,
+        0x4459595944444651, 0x0419900262268A6A, 0xA28A2A2A2A8A2A2A, 0x2A29A88222698099,
+        0x9860060000000000, 0x9266609826209A68, 0x2082626666406591, 0x0459459505145151,
+        0x4515145114444445, 0x964646664260269A, 0x69A6982699826600, 0x0180000902424926,
+        0x6669988220A229AA, 0xA28A2A28AA8A2A28, 0xA8A2226980900196, 0x5941111111144451,
+        0x1444656590659990, 0x0006406419659119, 0x4444451115114545, 0x1514444444191900,
+        0x2499A66822229AA2, 0xA22A288A9A8A689A, 0x9A69889898980099, 0x998260208220A6A6,
+        0xA229A9A9A26A69A0, 0x8989819901119514, 0x5451515151515151, 0x5144511194419006,
+        0x6199999009024000, 0x9019900646591965, 0x0419664002660826, 0x8888828A6A88A2A2,
+        0x8A2A288A288A689A, 0x2262626666419196, 0x5964410646400664, 0x9090090000240606,
+        0x1990106519595954, 0x5655514545151515, 0x4511110659998262, 0x2689A22229A29A88,
+        0x8A6A688269809899, 0x999802699A620822, 0x2222288A2288AA28, 0xA28A29A988262600,
+        0x1866465965111445, 0x5145145144595059, 0x4110411919199000, 0x6664191964441654,
+        0x4511111444444165, 0x96466499A620A6A8, 0xA28A8AA2A28A8A8A, 0x8A28A208889A6660,
+        0x9092499926666601, 0x81809989826989A0, 0x8826999800640410, 0x4459444451451595,
+        0x5655114451165411, 0x19646401800989A6, 0x9888269826099800, 0x0000090924266499,
+        0x98098268222288A2, 0xA8A2A8A28AA8A28A, 0xA22889A099866410, 0x4651111111114459,
+        0x5651104659664199, 0x9001990644196594, 0x6516511655114545, 0x1595444110419199,
+        0x9802609A68A68A28, 0xA8A28A28A2222888, 0x222209A609899800, 0x0266260826882288,
+        0x8A229A8829A22208, 0x8202666646510514, 0x5154515451515154, 0x4545111119419066,
+        0x6666664009000000, 0x0006401906591941, 0x19659900092609A6, 0x9A22229A88A28A2A,
+        0x28A8A28A6A222220, 0x8882626649019196, 0x5065064646419999, 0x0900240000018061,
+        0x8640644111116551, 0x5145154545451545, 0x1511111919266698, 0x82222222222888A6,
+        0xA9A9A69889898099, 0x998099A482698888, 0x229A29A88A29AA8A, 0x2A2228889A098266,
+        0x6641901105945165, 0x5511451445111656, 0x5046596406586400, 0x0199065904651165,
+        0x4444511165111044, 0x464666662622222A, 0x2A2A28AA28AA28A8, 0xA8A228822209A499,
+        0x9800600000090090, 0x9266626026208208, 0x89A6098061991011, 0x9444594595655115,
+        0x1454514451165659, 0x465900664998209A, 0x089A020989800998, 0x6018018000000090,
+        0x99989A62688A228A, 0x2A2A2A2A8A2A28AA, 0x28A2208982664196, 0x4465111651051144,
+        0x5111164464406641, 0x8666419065919411, 0x9594594511451454, 0x5151116510659990,
+        0x0266020888288A28, 0xA2A8A228A2229A82, 0x2226988262602666, 0x00266262089A2222,
+        0x88A2229A82222208, 0x8209986646504514, 0x5151515451515151, 0x4545111059646400,
+        0x1866199999999009, 0x0000190101964465, 0x0419664002660826, 0x88829A88A6A88A2A,
+        0x2A28A288A22829A2, 0x2698980000664104, 0x4110410641906666, 0x6642400900000001,
+        0x8664659044451145, 0x4545154545151515, 0x151110440666609A, 0x682226A68A688A22,
+        0x2888882988098999, 0x86026609A609A088, 0x29A29A888A6AA28A, 0x2A22888889A60266,
+        0x6664196596516551, 0x4514544565444444, 0x4165964646419990, 0x0199019644116511,
+        0x1445111651165965, 0x041900098208A6A2, 0x8A8AA28A2A8A8A8A, 0x2A288A6889A66260,
+        0x0600000009092424, 0x999989989A669888, 0x2209826061996419, 0x4444444511595511,
+        0x4559559595059596, 0x5040641998026268, 0x2089A62026099980, 0x0240009090926666,
+    },
+    { // silence 16/48 o3
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    },
+    { // sine 24/96 o3
+        0x0000060199999000, 0x1990006641990019, 0x0640190641901919, 0x6641910101010659,
+        0x1964644196596465, 0x9110410446519659, 0x4119441104596510, 0x4444444165111105,
+        0x0595944416565651, 0x1111114444595105, 0x1111654444511116, 0x5459445951111654,
+        0x4595059511114144, 0x5111144445111654, 0x4444451111144445, 0x9459444459444444,
+        0x4594441651111959, 0x6510444411110444, 0x1110465044119659, 0x6591965910659106,
+        0x5906591966440644, 0x0641919064199190, 0x0640664199000664, 0x0199999000601861,
+        0x8606181800002666, 0x6009998026602660, 0x9982609989826026, 0x2699820202098808,
+        0x20988208269889A6, 0x2089A69A69A62208, 0x89A2089A20888882, 0x9A6889A9A088A682,
+        0x29A29A08A6A68888, 0x8A68A68A68A688A6, 0xA68A6A6A68A68A6A, 0x0A22229A8A6A68A6,
+        0xA6A6A6A0A6A22222, 0x88A0A2228888A6A2, 0x2229A9A9A29A2222, 0x829A9A29A0A68A68,
+        0x8829A9A0A689A222, 0x220888889A22689A, 0x26822689A69A69A6, 0x989A09A6989A6209,
+        0xA62699A626269989, 0xA660809826098260, 0x0980260999826600, 0x0266600924999999,
+        0x9801866199990000, 0x0664000664199906, 0x4006406466464190, 0x1919664646599641,
+        0x9646590410410650, 0x4194104110411104, 0x6510465104441111, 0x1104596511111059,
+        0x4444594416565650, 0x5959444595944595, 0x9459459450511116, 0x5445950595051116,
+        0x5444511116545959, 0x4459511116544444, 0x5111144445959595, 0x9656511651111111,
+        0x1656519444444656, 0x5044444651059659, 0x4111046504411965, 0x0410410411965904,
+        0x1064410106599641, 0x9191906419064190, 0x1900640664199000, 0x1990186666402401,
+        0x8060018000009266, 0x6600266602666099, 0x8266099898098080, 0x9826262626262699,
+        0xA609A698208269A6, 0x989A69A62089A268, 0x20889A2682222088, 0x829A2688888829A2,
+        0x20A0A6A6829A29A2, 0x222229A829A9A29A, 0x2229A882888A6A22, 0x29A9A829A88288A2,
+        0x229A888A6A22229A, 0x888A6A22229A8288, 0x88A6A22229A29A9A, 0x29A2222229A9A9A6,
+        0xA69A29A6A69A2222, 0x6A69A20888829A68, 0x222689A089A089A6, 0x9A69A6269A6269A6,
+        0x08209A609A626262, 0x6260989898266260, 0x9802602662666099, 0x8000266000242666,
+        0x6666181986666400, 0x0006640006640664, 0x0190064199190190, 0x6419196101910646,
+        0x4419106590465919, 0x6591046596591104, 0x1110441111044116, 0x5944111111059444,
+        0x4414165116510595, 0x9459444444511111, 0x4444505111144459, 0x5111114459511111,
+        0x4450511654444451, 0x1444459511656516, 0x5651141441445959, 0x4594444450595944,
+        0x4165411111116594, 0x4465659465119441, 0x1044441104411044, 0x1046504104104119,
+        0x1041910419101010, 0x1064101919064190, 0x1906646641990066, 0x4019990006666640,
+        0x0090006000090926, 0x6666099998009982, 0x6602660998982662, 0x6260260809A60989,
+        0x880826989A608208, 0x9A62082088226820, 0x88220889A2268222, 0x088888829A0A689A,
+        0x9A26A69A9A20A6A6, 0x88888A6A68A68888, 0x8A2229A829A82828, 0x888A229A88888A22,
+        0x9A8888A6A229A829, 0xA8888A6A2229A888, 0x888A2228888A6A6A, 0x688A688888A6A6A6,
+        0x9A2229A0A6888882, 0x9A22220888889A22, 0x688220889A268208, 0x9A082269A6989A62,
+        0x09A6209A609A6260, 0x809A602626260980, 0x2626026002602660, 0x0998002666000249,
+        0x9266666618666664, 0x0000199900199906, 0x6401991991991991, 0x9064190406464646,
+        0x5996464419104106, 0x5964410411941046, 0x5046519411044116, 0x5941111195965119,
+        0x5941651195059444, 0x4444519510595059, 0x5944595959459445, 0x1111654459451051,
+        0x1444451165444451, 0x1114459511111444, 0x5111114459594594, 0x5944445050595944,
+        0x4445946541116595, 0x9651059411111194, 0x4651941119411046, 0x5041194104104104,
+        0x1196410659101964, 0x1910191919190065, 0x9901906401900664, 0x0664019999000666,
+        0x6664090009090926, 0x6666009266600998, 0x0266099809809826, 0x026098989809A602,
+        0x09882626989A6269, 0x89A62269A6268226, 0x82089A2689A089A2, 0x2688222222088A68,
+        0x29A26A68889A9A9A, 0x0A688A68A68888A6, 0xA0A6A6A6888A0A22, 0x29A88888A229A888,
+        0x8A0A229A8888A222, 0x8288A222228A6A6A, 0x6A688A6A6A688A6A, 0x688A6A6888888A0A,
+        0x6A68888882829A9A, 0x688882229A688222, 0x22688226889A0822, 0x089A269A6268269A,
+        0x620988209A62699A, 0x609A6699A6626260, 0x9989826626609980, 0x9980099800999998,
+        0x0002490924909024, 0x0000666640019990, 0x6640199066419066, 0x4640646464065996,
+        0x4191964101041065, 0x9104194196596591, 0x1965941044651044, 0x1111119446511110,
+        0x4594444165651059, 0x5944444445105111, 0x1654165656511656, 0x5651656541656544,
+        0x4445956516516544, 0x4445111444511165, 0x4444459511165165, 0x6516511116565659,
+        0x5944444444459444, 0x4165110594165044, 0x4651194650441104, 0x4110465041041196,
+        0x5910659041065919, 0x1910191966464191, 0x9019064064019006, 0x4019900066400019,
+        0x9990009000000009, 0x0924999802649800, 0x2660998026026009, 0x8262669269989A66,
+        0x2699A609A6269820, 0x8269A62082089A69, 0xA69A69A69A682088, 0x8822220888888882,
+        0x29A26A689A9A0A68, 0x8A68888888A20A22, 0x2282828888A6A222, 0x229A88A6A68A6A6A,
+        0x6A6A6A6A68A6A6A2, 0x2222888A2228888A, 0x2229A8888A6A6A68, 0xA688A68A68A68888,
+        0x88A0A6A6829A2220, 0xA6A68822226A6822, 0x226889A0889A2082, 0x22682089A0826820,
+        0x8209A6989A626269, 0x9A62026260809898, 0x2626626026626626, 0x6002660999800026,
+        0x6600180240240090, 0x0000199999000664, 0x0066400641990664, 0x6658646419190641,
+        0x9641919641010659, 0x6465904659644659, 0x6591194119465044, 0x6504444651104444,
+        0x4444441651650594, 0x4444594459444594, 0x4595945944595959, 0x4594595050511165,
+        0x4459451111654459, 0x5195111144450511, 0x6544144450511165, 0x4165656511111165,
+    },
+    { // hot 24/96 o3
+        0x0064104444454454, 0x5454514545145959, 0x4411964406419019, 0x0646419646519444,
+        0x4444451165111964, 0x40666600988888A2, 0x8A88AA28AA28A8A8, 0xA8A29AA688826989,
+        0x9826666618606000, 0x00980982699A6698, 0x2699802666406465, 0x0594514514551515,
+        0x1514551454511444, 0x4119199249980202, 0x0989A60202609800, 0x9999999860180026,
+        0x0262089A9A9A8A6A, 0xA88AA28A8A2A8A8A, 0x6A88882698000019, 0x1965944654444445,
+        0x9504411965906419, 0x0641901919104119, 0x5959595459551514, 0x5145459519419192,
+        0x49988208A6A288A2, 0xA2A8A28A2A288A6A, 0x69A0826980982626, 0x6260209A62088882,
+        0x88888A6A22208820, 0x9A66490191944451, 0x4514551454545595, 0x5445114144111966,
+        0x6466640909090000, 0x1990064646464646, 0x5991990180026268, 0x222288A8A8A2A2A8,
+        0xA2A2A2A2A28A6A22, 0x0820980001864065, 0x9964646464190066, 0x4000180180066640,
+        0x1910659445951151, 0x4515514545154514, 0x5144444191992662, 0x0226829A22282828,
+        0x829A2089A6262626, 0x6260260982082268, 0x888A2288AA2A6AA8, 0xA22A229A88826026,
+        0x6665919445951451, 0x4551451565516565, 0x9446591919190064, 0x6406465904411111,
+        0x1111444451959106, 0x59900009A6222228, 0xA2A2A28A2AA28A8A, 0x2A28A29A9A682626,
+        0x2666000000000992, 0x6600980808080826, 0x2026026666641911, 0x0595956554514551,
+        0x4551455145145111, 0x0440646060098026, 0x9898209820260266, 0x0000009090266660,
+        0x98209A68A68A228A, 0xA28A8A8A8A8A2A2A, 0x2288888269264906, 0x5904656511651651,
+        0x6510441196440641, 0x9019064191964441, 0x1656544545151454, 0x5451459510410640,
+        0x0026208888A22A6A, 0xA8A28A2A28A28888, 0x888820989A660260, 0x9826262698882222,
+        0x29A29A9A9A088826, 0x9826640196444451, 0x4515151514545454, 0x5456544459659641,
+        0x9000066666666640, 0x0019019190659010, 0x6599066666660820, 0x8A6A6A28A8A8A2A8,
+        0xA2A8A2A2A2A6A222, 0x0820980900066599, 0x1010646465864066, 0x6400000001806664,
+        0x6659194444451451, 0x5151514554454545, 0x1159596419000008, 0x269A088888A22229,
+        0xA29A68269A609898, 0x0980989826208220, 0xA6A2228A9AAA22A2, 0x8A8A29A8889A6099,
+        0x9901965944511454, 0x5151515115144595, 0x9651910101919006, 0x4641919641104594,
+        0x1414414459591106, 0x4640602609A22222, 0xA2A28A8A8A8A2A8A, 0x2A28A6A29A69A602,
+        0x6099998060600600, 0x9998098989898209, 0x8989802490006446, 0x5111145151515655,
+        0x5145151515114504, 0x4410064009998982, 0x699A609A66260999, 0x9800240090099998,
+        0x98269A6829A8A22A, 0x2A2A2A2A28AA22A8, 0x8A28298826600019, 0x6465944459445945,
+        0x9444650419659906, 0x4064665991011944, 0x1656545145145514, 0x5456559596501906,
+        0x6009A6220A28A22A, 0x2A8A28A8A28A6A9A, 0x2082269826260998, 0x982609A620822222,
+        0x229A829A9A226820, 0x9826664191944445, 0x4515145454545451, 0x5451145959659664,
+        0x6640198186199999, 0x9019006464659919, 0x6419006666002698, 0x88A6A28A28A8AA2A,
+        0x2A28A8A8A8A22882, 0x9A69980000064064, 0x4041919191906640, 0x0066666199999066,
+        0x6599650445951451, 0x5145454551454515, 0x1145941190066026, 0x09A68829A9A29A29,
+        0xA20A69A6989A6609, 0x8998982609A62688, 0x82888A2A28A2A2A2, 0xA28A2288A6826926,
+        0x6401911111145145, 0x4515451451456565, 0x1196596646586419, 0x0665906591194411,
+        0x6565651111650465, 0x901999809A6829AA, 0x6AA6AA28A28AA8A8, 0xA28A29AA69A09A66,
+        0x2660000909024266, 0x60026026202699A6, 0x0809989264006441, 0x1111151451515451,
+        0x5151515151445116, 0x5964064026660262, 0x098989A662609980, 0x2666666666660099,
+        0x808269A22229AA9A, 0xA8A28AA28A8A8A8A, 0x228A688260992406, 0x5904165116541651,
+        0x1165041106599640, 0x6406419065904111, 0x1114445451455145, 0x4514511444419190,
+        0x26602268A6A6A2A6, 0xAA9AA88A2A2888A6, 0x8A62082626260260, 0x2609A669A6208888,
+        0xA68A6A688A69A082, 0x6999999910444445, 0x4514551454545451, 0x5451145945911919,
+        0x0066400900000001, 0x9900190659910101, 0x0646400186026089, 0xA22228A2A2A8A2A2,
+        0x8AA2A28AA22A6A20, 0x89A6266019900646, 0x5991010101919000, 0x1999992424090066,
+        0x4196465111414545, 0x1455151455145151, 0x5116510659990980, 0x9A68226A6A0A688A,
+        0x688889A698209826, 0x2600989826209A20, 0x8A6A2288A8AA6AA8, 0x8A2A6A9A9A698266,
+        0x6190659444451511, 0x5154455115165459, 0x4110410646464199, 0x0641964196504444,
+        0x1444459511194659, 0x664000260822229A, 0xA88A8A2A8A2A2A2A, 0x28A8A22222226982,
+        0x6009999999999800, 0x0099898262626269, 0x8098260006190104, 0x6544451454545454,
+        0x5454545151456565, 0x96590199818099A6, 0x0209A60202692660, 0x2499999926660026,
+        0x609A69A68A6A228A, 0x8AA22A8A8A8A2A28, 0xA288888262666646, 0x4119411656516511,
+        0x6519446591966599, 0x0640641966591944, 0x1654445445514515, 0x4514511441119619,
+        0x980269A688A228A8, 0xA2A8A28A8A29AA68, 0x89A6826262609809, 0x80989A609A08829A,
+        0x2229A9A9A2226820, 0x9899999191944145, 0x1514545151515451, 0x5145114459465996,
+        0x6646666199999990, 0x0199019065996410, 0x196640666600269A, 0x68888A9AAA88A2A2,
+        0xA8A2A2A8A288A29A, 0x2260980240199065, 0x9964191966464001, 0x9990000900901999,
+        0x1901194444451451, 0x5151515151454545, 0x1444504101924980, 0x82689A2229A229A9,
+        0xA9A69A6826269989, 0x826626098989A088, 0x9A888A28A2A2A2A2, 0x8A2A228888898980,
+        0x0199644165445145, 0x1545445511595651, 0x1946596659906466, 0x4641919641104594,
+        0x6544444451059659, 0x06418009A6268A22, 0x8A8A28AA2A2A28A8, 0xA8A28A6A08882620,
+        0x0998000900240926, 0x660998269989A669, 0x8980980000019194, 0x1116545151454545,
+        0x5145454545144510, 0x4465999002660269, 0x9A66989898260099, 0x8000000240266660,
+    },
+    { // silence 24/96 o3
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    },
+    { // sine 16/48 o5
+        0x0000180186664000, 0x6190006640664199, 0x1990190191906464, 0x0659919640419646,
+        0x4659665964659644, 0x1046504119411946, 0x5194105965959111, 0x1059441651059444,
+        0x6559116511956594, 0x5944444511116559, 0x1654654165465594, 0x4595959595959594,
+        0x4595116546559656, 0x5656541654444459, 0x5195659595965441, 0x6546565111111651,
+        0x9519596510594656, 0x5044656444656441, 0x6596594194659646, 0x5196441065010419,
+        0x6465996465996646, 0x4658646406586419, 0x9606401996019900, 0x1999000186186666,
+        0x6499249998000024, 0x986969999A409826, 0x602602609809A498, 0x269809A669826982,
+        0x098826808269A020, 0x82089A269A69A69A, 0x69A69A22689A2088, 0x89A9A6A622222222,
+        0x9A220A26A08A6888, 0x8A6A0A6A689AA689, 0xAA69A9A9A9A29A89, 0xA888A68A6A222288,
+        0xA6A9A6A6A6A6A0A6, 0xA22229AA69A829A8, 0x8888A6A26A220A22, 0x29A229A9A6A6A629,
+        0xA2222229A688829A, 0x98A629A689A9829A, 0x69A20822089A269A, 0x62082269A6089A62,
+        0x0209882699A60809, 0xA662626026026260, 0x098999A409802498, 0x0249980000926499,
+        0x2666619999009696, 0x6199258019001900, 0x6658640640658101, 0x9610101010106465,
+        0x9041964659104194, 0x1965965904465194, 0x1044411194465104, 0x4446565194446565,
+        0x1059444594446559, 0x4654116511146559, 0x5965651651654465, 0x5959444595659511,
+        0x1165505945959505, 0x9511116559654444, 0x4595119565111165, 0x1116565651950459,
+        0x4165659594116595, 0x9659591950656591, 0x1194411946596446, 0x5196441041941964,
+        0x1041965996659190, 0x1964190646406406, 0x4664019066400664, 0x0619900018619990,
+        0x9024024924999818, 0x9092660099989998, 0x998099A498998989, 0x989A49A6020209A6,
+        0x6809A60826826988, 0x2682082268208298, 0x829A69A2689A0882, 0x29A6889A9A208888,
+        0x8888A69A8229A29A, 0x6A26A6A69A29A829, 0xA89A89A888888A22, 0x288A26A9A229A229,
+        0xA88A6A22229AA69A, 0x89AA69A88A68A6A6, 0xA6A688A68A6A6888, 0xA6A6A69A829A0A6A,
+        0x0888A689A822226A, 0x089A9A68222226A6, 0x26A6268822682268, 0x2689A6089A09A626,
+        0x98826209A60989A6, 0x699A662692692626, 0x6266266026002660, 0x9266000992660189,
+        0x0002402400180186, 0x6640006640066401, 0x9006401996641906, 0x4191996419619658,
+        0x4101041965906506, 0x5910411946591194, 0x6596504651944111, 0x1959651944656594,
+        0x4444444594444444, 0x4451111165656511, 0x1165416546559144, 0x4451165414655045,
+        0x9511954165654655, 0x9656544445951111, 0x1444595111116516, 0x5651116565119511,
+        0x0595965651959656, 0x4596510596564465, 0x6446510465046519, 0x4196591041196591,
+        0x9641065919665904, 0x0659019190196196, 0x6659991991864019, 0x9006199060199999,
+        0x2400002400249266, 0x6602409986902660, 0x998926249899A498, 0x99A60269989A4826,
+        0x209A66808269A609, 0xA08268209A269A69, 0xA69A69A0822226A6, 0x22220A69A220A689,
+        0xA82229A6A6829A9A, 0x20A222229A89A829, 0xA2229AA69A9A829A, 0x9A9A829A9A289AA2,
+        0x6A6A6A6A68A68A26, 0xA89A829A89A888A6, 0xA68A6A2222229A89, 0xA882829A829A2222,
+        0x29A229A6A68829A6, 0x88889A8226A69A69, 0xA26822268820889A, 0x68269A69A6269A60,
+        0x8208209A62699A66, 0x9826269982026098, 0x098998099A498026, 0x6000998009266660,
+        0x0000024000000006, 0x1866400619901866, 0x5806419919919919, 0x9619665996196464,
+        0x6465996465919644, 0x1941965904651065, 0x1965041195919596, 0x5941111110594165,
+        0x9504446544656511, 0x1111165656505111, 0x1141444595119565, 0x9511116544459511,
+        0x6511654459594595, 0x1165165656516544, 0x4445951111656565, 0x6595059459459414,
+        0x1656511059596511, 0x1951941659411111, 0x9591104411195994, 0x6506506594041196,
+        0x4419644191965865, 0x9619665901961019, 0x0196190064199019, 0x9019990006192418,
+        0x0606066186618180, 0x6024249869699869, 0x6998099809809826, 0x2669262609A66269,
+        0x9A6262698269A609, 0xA09A6989A082689A, 0x09A689A6822689A9, 0x89A9A69A98888829,
+        0xA9A0A69A9A0A6A68, 0x29A9A9A6A6A69A82, 0x9A29A89A89A88888, 0x8A22288A6A22229A,
+        0x9A889AA0A6A6A26A, 0x2229A82828A6A68A, 0x6A2226A9A2229A9A, 0x29A9A222229A89A9,
+        0xA6A68882829A9A68, 0x88889A9A689A226A, 0x620A682268822689, 0xA69889A689882682,
+        0x69A6698826989880, 0x826260809A49A669, 0x2626026009826669, 0x0998266600099998,
+        0x6002400902409000, 0x0001866400619906, 0x1990666586466419, 0x9664190658659064,
+        0x1064659041964644, 0x1041941065191046, 0x5196596594119446, 0x5044411659446565,
+        0x0444444446559651, 0x1111165165111165, 0x6541651116544444, 0x5111654444595659,
+        0x5111165445959511, 0x1116559444595111, 0x1654459445945959, 0x5959465446544414,
+        0x1416541116595965, 0x6594465650444656, 0x4465659410441119, 0x4659659659046594,
+        0x0410419659964644, 0x1919665841919190, 0x1906419919006658, 0x1996966640618664,
+        0x0000606619866181, 0x8000024999800999, 0xA40998999A426098, 0x2669202609A48080,
+        0x8262699A699A6082, 0x082082269889A622, 0x6820882226822268, 0x9A99A9A089A9A688,
+        0x29A2220A6A69A222, 0x9A222229A9A22222, 0x289AA68888A68A6A, 0x0A0A2229AA69A888,
+        0xA6A68A6A229A9A9A, 0x9A9A9A229A88A68A, 0x6A0A6A226A9A6A22, 0x22229A889AA629A2,
+        0x29A26A226A088888, 0x88888889A8220A69, 0xA20889A9889A2082, 0x22682089A0820822,
+        0x69A608209A0269A4, 0x82699A60989A4989, 0xA420266998266099, 0x8099809998092666,
+        0x6090090926649992, 0x4240906066640019, 0x9960199606658191, 0x9006586464191906,
+        0x5996659610419641, 0x1964104650659644, 0x1044650465194105, 0x9659465644416510,
+        0x5946565104596541, 0x6511956459594146, 0x5444594459595045, 0x9511956511165444,
+        0x5951956511165414, 0x4595111165594465, 0x5059594459564519, 0x5111651111414655,
+    },
+    { // hot 16/48 o5
+        0x0066465965951145, 0x1595559655965441, 0x6596596419619900, 0x0619064419465656,
+        0x5465444655965944, 0x11906062668229AA, 0x28A8A9AAAA9A88AA, 0x28A2888A68260980,
+        0x6001800900249999, 0x9998266698209A68, 0x22699A4240019646, 0x5659444595595165,
+        0x5559445114459519, 0x4659919860026089, 0xA09A0809A49A4266, 0x6661981860601800,
+        0x24982698888A6A9A, 0xA8A9AAA28A2A2A2A, 0x2A229A0980900644, 0x1194441656516541,
+        0x4595941940658664, 0x0186406464659659, 0x4416546551145145, 0x1544595065019006,
+        0x6002609A0A688A9A, 0xAA29AA2229AA0888, 0x8882269A66699981, 0x8926098826829A22,
+        0x28A6A0A26A0889A9, 0x89A4999919645956, 0x5551655545955655, 0x5956565104106580,
+        0x1861866666664090, 0x0000664641964411, 0x1965999000262622, 0x68882888A22A28A2,
+        0xA88A8A229AA6889A, 0x209A600249064196, 0x5046596658664661, 0x9999902402400091,
+        0x8064196444459545, 0x1456555544456555, 0x5419506464000989, 0xA208888A68888A22,
+        0x8A6A69A699A60999, 0x800098262699A268, 0x29A2229AA229AAA2, 0x28A29A82209A6690,
+        0x1819965911111456, 0x5556565465564595, 0x9164410659901999, 0x0186419646564595,
+        0x9511165416595965, 0x964199989822222A, 0x9AAAA6A28A8A2A8A, 0xA22A6A208989A499,
+        0x9800002492492492, 0x492609989A669A02, 0x2269200264019046, 0x5119565956544545,
+        0x1565565445959656, 0x5966599092669220, 0x882269A660260909, 0x9266666606018000,
+        0x0099A668829A88A2, 0xA2A2A28A8AA28A8A, 0xA6A89A6999861919, 0x6504165165116545,
+        0x9595964465841900, 0x0199961966596446, 0x5651165655114455, 0x1451654419406400,
+        0x09098208229A28A2, 0x8AA6AA6A2229A9A2, 0x6A6989A692609980, 0x00098989A69A68A6,
+        0xA29A29A9A0A689A9, 0x89A4999906511165, 0x5511514551515159, 0x5556416594641960,
+        0x1866664992499926, 0x4906190641065965, 0x964641992499A622, 0x689A8828A6A9AA9A,
+        0xA88A28A6AA69A9A6, 0x9A02690924019196, 0x5941965864640061, 0x8666664924090900,
+        0x0066599591114454, 0x5151545159555511, 0x1595941190180082, 0x0A6889A889A829A8,
+        0x888A6A6209A60092, 0x666026692089A682, 0x22229A2888A8A2A6, 0xAAA0829A2699A660,
+        0x0606465965111595, 0x5115955959594594, 0x6565906591990186, 0x6646658465195965,
+        0x6559444445959410, 0x4659998008226A9A, 0xA9AAA22A2A28AA8A, 0x28A9A889A2626009,
+        0x9999800090182418, 0x90266699A669A626, 0x89A6026619996659, 0x4651651144514565,
+        0x5559655959511110, 0x5964664609262620, 0x889A626998998249, 0x9266661861818601,
+        0x82660826A69A88A2, 0x8AA6AAAA68A8A2A2, 0xA2A6A69826619065, 0x1941105959655944,
+        0x5116519419665801, 0x8664664646596416, 0x5945959516559551, 0x6556565946465999,
+        0x998098226A68A6AA, 0x6A8A6AA222228A68, 0x29A6989A60266900, 0x2666920820888288,
+        0xA222888A6A682222, 0x6982666659959445, 0x4559555954515145, 0x5159511104641918,
+        0x1866666640900009, 0x0006190646441944, 0x1041901861899A62, 0x6A682888A28A6AA8,
+        0x8A2A6AA6A6A68889, 0xA982602664006591, 0x0591941901918666, 0x4240090000060006,
+        0x0640644111954145, 0x6555459554595556, 0x5459446599002626, 0x9A088A69A9A9A228,
+        0x8A6A689A62692602, 0x424982609A6089A9, 0x8A6888A229AAA6A2, 0xA6AA08882209A426,
+        0x6664646594445115, 0x1511514451144444, 0x4446596659901909, 0x6966464106564595,
+        0x1116559446565946, 0x5961909982088A28, 0xA9AAAA9A88A8A8A8, 0xA8A9AA08209A6600,
+        0x0099266018009696, 0x9624982609A02269, 0xA09A660060190659, 0x6595959451145151,
+        0x5165550595959591, 0x119640199869269A, 0x6826826260266969, 0x9024264926666666,
+        0x0026698829A222A2, 0xA2A2A6AAA888AA6A, 0xAA26882699861910, 0x4656595916565414,
+        0x4459594196581900, 0x0066406599659119, 0x4444445165565595, 0x5165446565906401,
+        0x80099A0222229AA2, 0x8A9AA88A6A229A29, 0xA69A09A609899980, 0x09260989A08229A9,
+        0xA888A6A6A69A2268, 0x8269090065911145, 0x6555595145454545, 0x5165564465966400,
+        0x6666400969060090, 0x0606665906591965, 0x94190664909809A0, 0x889A8888A22A6AA8,
+        0x8A2A228A229A8882, 0x2269989090019196, 0x5941964646646199, 0x9924090240000000,
+        0x0664659044595955, 0x1151515655559516, 0x5556465996618262, 0x6889A29A6A0A0A22,
+        0x9AA698A62699A498, 0x6000980982269A69, 0xA9A6A26A9A88A2A2, 0x8A8A2222269A6660,
+        0x1864191944654595, 0x5144545955946565, 0x1941041964190018, 0x6665865994411651,
+        0x6559444459444165, 0x065866669226A6A9, 0xAA8A2A28AA28AA28, 0xAA6A89A208269989,
+        0x0924999998606181, 0x801A426262698226, 0xA609A42664960411, 0x9444594511655595,
+        0x4595516565444446, 0x565864618626699A, 0x268269A660998992, 0x6666606181806000,
+        0x009808226A688A28, 0xA8A2AA28A9AAAA9A, 0x288A26A660909610, 0x4444444459444595,
+        0x6565044659191999, 0x0018641906594194, 0x6565651165514514, 0x5451144656658640,
+        0x0009A668222229AA, 0xA9AA6A9A89AA2688, 0x89A2098826699989, 0x009989A4889A9A0A,
+        0x29A9A888882829A6, 0x9A69001841946551, 0x4515151455451515, 0x1451144446590664,
+        0x0000006001818661, 0x9990199010644650, 0x465919909098269A, 0x69A2229A88A28A2A,
+        0x28AA6A888A6A0A69, 0xA682669024664104, 0x4651919619619901, 0x8000606186619999,
+        0x9006410416516551, 0x4545451545151545, 0x15956410640009A6, 0x98889A8229A9A29A,
+        0xA6889A99A2602600, 0x00266266989A6226, 0xA69A9A9A88A28A8A, 0x28A888889A926249,
+        0x9901906519594514, 0x5156556565444465, 0x4119419641906192, 0x4006406596504459,
+        0x5111444459444656, 0x4646426669A688A2, 0x8A2AA28A8A2AA6AA, 0xA6A6A0A69A69A409,
+        0x9981818061806000, 0x00266099A609A622, 0x269A666241865994, 0x1659595951165551,
+        0x6554451144511659, 0x590646666660989A, 0x0822698982626666, 0x1806060600000090,
+    },
+    { // silence 16/48 o5
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000096918000906, 0x0906090182418246,
+        0x2418240609018901, 0x8900624018900062, 0x4000018900000000, 0x0696024000018240,
+        0x6240189000062400, 0x0000069600900018, 0x9060900609000624, 0x0018900000189000,
+        0x0000000069609000, 0x0062401890069600, 0x2401891824180901, 0x8241890189006240,
+        0x0624006240000189, 0x0000000000696090, 0x0006240062406960, 0x0240609018091824,
+        0x0609062406240189, 0x006240006240001A, 0x5802400609060901, 0x8240182400189000,
+        0x6240000069600900, 0x6240609018240189, 0x0018900006240000, 0x0006960240006240,
+        0x6240624006960024, 0x0182460906090609, 0x0182400624062400, 0x0624000696009018,
+        0x9018090182406240, 0x6240062400006240, 0x00001A5809000182, 0x4018906240006240,
+        0x0000696009000189, 0x0609018900624000, 0x0189000000006960, 0x9000189006240062,
+        0x4000018900000000, 0x0000000000000000, 0x0009180025A40180, 0x240189000001A580,
+        0x0900609060906090, 0x6240624006240018, 0x9000006960090018, 0x9062418240062400,
+        0x62400001A5802400, 0x6241890609006240, 0x0189000006960090, 0x0189018240624062,
+        0x40001A5800900182, 0x4182418901890189, 0x0000189000000696, 0x0240006240624018,
+        0x9000696009001824, 0x0609060900189001, 0x8900000189000000, 0x0000000000000000,
+        0x0024600969001802, 0x4000696009000602, 0x4060240609006240, 0x0189000006240000,
+        0x0000000000000000, 0x0002418000246000, 0x0241802418090609, 0x0609018240624062,
+        0x4001890000696009, 0x0018906241890062, 0x4001890000000000, 0x6960900000624001,
+        0x8900000000069624, 0x0000062400062400, 0x0000000000000000, 0x0000906000002460,
+        0x0024602418024182, 0x4180901890624062, 0x406240001A580090, 0x0609018240609001,
+        0x8900018900000000, 0x0006962400000062, 0x400001A580900000, 0x1890062400001A58,
+        0x2400018901890001, 0x8900000000000000, 0x0000000009060009, 0x6900060900069602,
+        0x4000060901824006, 0x2400001A58090006, 0x2401824001890000, 0x01A5809000006090,
+        0x0189000069602400, 0x0060900624006960, 0x0900189062418900, 0x6240001A58024001,
+        0x8240182401890000, 0x1890000000000000, 0x0000000000906000, 0x2460000918241809,
+        0x0609062418901890, 0x0189000696009006, 0x2406090189018900, 0x001A580240018906,
+        0x0900189001A58024, 0x0060901890624062, 0x400001A580240018, 0x9018901890001A58,
+        0x0240006090060900, 0x1A58009001824060, 0x9006090000624000, 0x0000000000000000,
+        0x0002406002460002, 0x4180906241890062, 0x4001890000069602, 0x4000624018900018,
+        0x9000000000000000, 0x0000091800918000, 0x2460241824182418, 0x9018900189000696,
+        0x0090018901824018, 0x90001A5802400189, 0x018901890001A580, 0x9001890189006240,
+        0x0069600900006090, 0x062401A580240189, 0x0182401890062400, 0x000001A582400001,
+        0x8900018900000000, 0x0000000000246002, 0x4600002418090609, 0x0609006090018900,
+    },
+    { // sine 24/96 o5
+        0x0000180198664000, 0x1999696640199919, 0x9199619064190196, 0x6584191966590419,
+        0x6419404104194646, 0x5041046519659410, 0x4656444111105965, 0x6444465411111195,
+        0x1195941656564595, 0x9594654444459519, 0x5111116544445956, 0x5951165111444511,
+        0x6559654655965444, 0x4451654654445944, 0x5959459595945941, 0x4165656595044459,
+        0x4654651119596511, 0x0596511959059411, 0x9465194194659195, 0x9965065919659065,
+        0x9665961191919191, 0x9064640658646641, 0x9019918640619001, 0x9990000661999024,
+        0x0909099999980000, 0x9998026662666099, 0xA42669980989899A, 0x49A609898209A669,
+        0xA669A66826982268, 0x2682682089A6826A, 0x626A626A62220888, 0x89A9A268829A220A,
+        0x0A6A69A9A26A26A6, 0x8888A6A688A6A68A, 0x688A6A226A9A6A22, 0x229AA6888A6A2222,
+        0x9AA6828A6A6A6A6A, 0x0A6A6A6A6A6A6888, 0xA6A2222228888A6A, 0x0A688888A6A689A8,
+        0x9A9A6889A8220A6A, 0x69A6A62226889A26, 0x89A689A682082268, 0x2689A6089A020826,
+        0x9826826262699880, 0x989A49899A600982, 0x6690980998099800, 0x2666090266666601,
+        0x8000180619999900, 0x0666640666419900, 0x6406406658646419, 0x0658659064646599,
+        0x6599659065965994, 0x1065046596596506, 0x5946519651044165, 0x0459650594465650,
+        0x5944654416565951, 0x9594414445950595, 0x1959594459595195, 0x1111654459594595,
+        0x9511116544445111, 0x4445051116559146, 0x5594444459565945, 0x9445944444595944,
+        0x6546565965650596, 0x5659465119441194, 0x4651946596506506, 0x5065941965904106,
+        0x5010659965841966, 0x5901966406599064, 0x0196019199901999, 0x1866496960061999,
+        0x9999249266660624, 0x2499800926002669, 0x0980980262669260, 0x9A4809A609A48269,
+        0x9A699A6989A6089A, 0x69882089A6826882, 0x6882088829888888, 0x29A6889A9A689A9A,
+        0x26A68829A9A20A0A, 0x6A6A688888A6A6A6, 0x88A6A6A6A6888A6A, 0x6A2229A9A829A888,
+        0x8A0A22828A6A6A6A, 0x6A6A6A69AA69A8A6, 0x8888A2229A9A9A22, 0x2229A829A2229A22,
+        0x2222229A0A688888, 0x29A0A69A9889A988, 0x89A2089A08822682, 0x088268209A09A699,
+        0xA698989A609A6080, 0x989A49A6609A4982, 0x6266026690260026, 0x0009998000992666,
+        0x6180601861866640, 0x0001999018640066, 0x4199606419961919, 0x0196646464646584,
+        0x1964194196650419, 0x6441196591104111, 0x9465965196519465, 0x1959659444656595,
+        0x9165119511059594, 0x4444445951105111, 0x6565656519565111, 0x4144595195659511,
+        0x1656541444595651, 0x1116559654445950, 0x5950595195195119, 0x5119564594459459,
+        0x6541111195119594, 0x1119594651944164, 0x4441644411194659, 0x6441196596591966,
+        0x5065919101040419, 0x1919190641919966, 0x4664190019019900, 0x6640019990001818,
+        0x6666666649999980, 0x0909999809998099, 0x8099A426009A4982, 0x6260982626920209,
+        0xA669A609A626989A, 0x69A608220822089A, 0x269A082226882220, 0xA69A20A69A9A689A,
+        0x9A68888888A6A69A, 0x9A98A6A68888A222, 0x22888A6A6A6888A6, 0xA222288A6A26A222,
+        0x29A88A6A6A0A26A9, 0xA9A26A9A9A222828, 0x8A6A226A9A6A6888, 0xA0A22222289A889A,
+        0x9A0A688A69A9A20A, 0x69A9A69A226A6222, 0x08889A2682268226, 0x82689A6208226989,
+        0xA6989882620209A6, 0x69826262609809A4, 0x9899A42609980998, 0x9266609266600909,
+        0x0926664999999924, 0x0006199918199006, 0x6401900646641901, 0x9010191919190646,
+        0x5906590419646596, 0x6519119646519659, 0x6596596504111195, 0x9111959411959411,
+        0x1165059445965651, 0x1195659445959444, 0x5959595944444511, 0x1444511656565116,
+        0x5444451165444459, 0x5165111655965444, 0x5959459595944459, 0x5959444459444595,
+        0x9654165944596511, 0x1111959465104465, 0x1104465646564119, 0x4650659659106506,
+        0x5964106590659665, 0x9010641019619619, 0x6191901990664199, 0x0066400199991806,
+        0x1998666490999266, 0x0000009998026660, 0x0980266266026266, 0x2669202699A66269,
+        0x9A6080826989A626, 0x9A699A09A69A6208, 0x89A08822689A2689, 0xA08889A9A08829A9,
+        0xA6829A222222229A, 0x29A6A0A68888A6A2, 0x6A20A6A26A222229, 0xAA68288A6A6A20A2,
+        0x229A8A68A6A226A9, 0xA9A26A8228288A6A, 0x22222288A6A6A688, 0xA6888A6A6A68889A,
+        0x8889A829A26A0888, 0x888889A9A08829A6, 0xA698888220889A20, 0x9A269A62689A6209,
+        0xA6989A62626989A6, 0x699A6260989809A4, 0x9A49898026692660, 0x9998999989099986,
+        0x0009024090909024, 0x0006186640619900, 0x1990199199019066, 0x5864640406599196,
+        0x1065919041965906, 0x5965994644104651, 0x9659659650656416, 0x5946565965105965,
+        0x1059594656510594, 0x4444595959416546, 0x5656595111165444, 0x4451111655945944,
+        0x5951956511141459, 0x5951951111654655, 0x9596544444595111, 0x1165416565659596,
+        0x5465651195059656, 0x5044444465410596, 0x5104465104411044, 0x4119419465919659,
+        0x6584659665019658, 0x6591919190646419, 0x0641906658190064, 0x1864061990618664,
+        0x9060018186186181, 0x8000092666002666, 0x2499826669262660, 0x26098982669809A6,
+        0x6982699A699A699A, 0x6982269889A69882, 0x2089A08222688226, 0xA6988889A9A68822,
+        0x229A688888888888, 0xA6A6A629A22229A8, 0x8289AA69A829A29A, 0x9A9A829A89A88A68,
+        0x8A6A2229AA68888A, 0x6A229A9A882888A6, 0xA22228888A6A2222, 0x9A29A9A222229A88,
+        0x829A9A26A68829A9, 0xA26A69A226889A22, 0x0A69A2689A269A08, 0x22689A68269A699A,
+        0x92269A6680826982, 0x09A6699A609A4989, 0x8260982602660980, 0x0980266624999800,
+        0x9249998601806018, 0x1999999001986400, 0x0649606658190665, 0x8191906659066591,
+        0x9010644041964659, 0x1964104659644119, 0x4104110446504465, 0x1944110594165944,
+        0x1651195944656519, 0x5044594594444445, 0x1111141444459511, 0x1165656565651654,
+        0x1414459595195651, 0x1165414459519565, 0x9511956511651651, 0x6546565651105111,
+    },
+    { // hot 24/96 o5
+        0x0064104655945115, 0x4545955541656565, 0x6596501010065819, 0x0646419644651045,
+        0x9445944595965196, 0x4666649A489A29A8, 0x8AA6AA9AA8A28AA2, 0x8A8A6AA622209A60,
+        0x9980249264926661, 0x89266098989A6620, 0x9898266606665904, 0x4655945655544515,
+        0x1515655556459595, 0x9196581866009826, 0x2698989898099A40, 0x9998600000002499,
+        0x8989A69A29A9AA22, 0xA9AAA28A9AAA9AA2, 0x888A208826624619, 0x6441195959444594,
+        0x4444416465966586, 0x4064191996599599, 0x5195111514545451, 0x5655465411106419,
+        0x86009A08A6A29AA8, 0xA6AAA0A28A9AA6A0, 0x89A98209899A6609, 0x9A6699A6989A2088,
+        0xA6A6A688888A6226, 0x9802400659059459, 0x5514514551455151, 0x4545116565641965,
+        0x8066640024000600, 0x6640190659910101, 0x0658664018926209, 0xA9A229AAA9AA22AA,
+        0x6AA8A2A6AAA68888, 0x2209898601999665, 0x9191966599064019, 0x9900006001806664,
+        0x6659044444511514, 0x5154515655544454, 0x5655911966490098, 0x9A6220A6A26A26A0,
+        0x888882989A699898, 0x2669260202082226, 0xA6A68A6AA22A28AA, 0x6AAA6889A8989A40,
+        0x0906465059565595, 0x5145145451511146, 0x5410419610196196, 0x1919191964164594,
+        0x4594594594446506, 0x58640926089A229A, 0xA88A8A2A2A9AAA88, 0xA28A288A0A689826,
+        0x0266618006000909, 0x9980980989A66209, 0xA662662400019106, 0x5651145955565595,
+        0x5655511565544654, 0x659064000009989A, 0x4826989826926626, 0x6666001800000266,
+        0x0989A6829A288A28, 0xAA9AAA28A2A6AAA2, 0x2288A69898264919, 0x0650446559465465,
+        0x4111959946465864, 0x6658101919641195, 0x9444595451595550, 0x5459559441659919,
+        0x980269A6A6A228A6, 0xAAA89AA88A9AA688, 0xA69A698260989989, 0x9A6626989A69A0A6,
+        0x9A889AA69A82689A, 0x4802490665044451, 0x6555595145156555, 0x5651654654104106,
+        0x4019909092490900, 0x1864199640404041, 0x9664199090098988, 0x8888A28A2A8A2A2A,
+        0x2A2A28AA2A6A8829, 0xA699A66066665841, 0x9101010646659990, 0x1819866666664006,
+        0x4065965944451451, 0x5655559514545955, 0x56519465865A5A49, 0xA6989A8229A9A29A,
+        0x2298889A09898982, 0x6099A6609A6089A2, 0x0A6A9A9AA8A6AA88, 0xA8A22A2222226099,
+        0x9919965959459551, 0x4514551655565944, 0x1650650196641906, 0x4064196411944165,
+        0x9564594595941041, 0x06400009A66A6A6A, 0x28A9AAA28A28AA9A, 0xAA829A8889A99A62,
+        0x6624999999926666, 0x092602609A669826, 0x98099A4090006441, 0x1165145151455145,
+        0x5955516555959594, 0x46591999999899A6, 0x6989898269980998, 0x0249999926666690,
+        0x2699A268888A288A, 0xA8A28AA9AAA228A8, 0xA22889A926090066, 0x5965941651165165,
+        0x1659590465906586, 0x4190641919196594, 0x6565654565551145, 0x4545954441641006,
+        0x662669A688A6AA29, 0xAAA228A9AAA20A26, 0xA68209A609826098, 0x09826202269A2688,
+        0x8888A6A22226A699, 0xA662418659110511, 0x5145454515154515, 0x1454451165196586,
+        0x5806649002400000, 0x6664190101964646, 0x4640640600026089, 0xA9A6A9AA28A8A8A2,
+        0xA8A8A2A8A2A6A9A0, 0x8226266001990196, 0x6599658419064006, 0x6490000000018199,
+        0x1906504444595451, 0x4565555591514515, 0x1595659190060099, 0xA022689A9A8229A9,
+        0xA9A69A2698989826, 0x692626262609A268, 0x29A9A9AA8A6AA8A6, 0xAA9A88A6A69A0099,
+        0x9901964450565595, 0x5165556545165445, 0x9651964640658196, 0x1919191965965944,
+        0x6544655946541965, 0x901861A4208888A6, 0xAA88A2A2A2A2A2A2, 0xA6AA89A222689A66,
+        0x2662492490902499, 0x99A49826920989A6, 0x699A499801999659, 0x1116559551451515,
+        0x6555445451511146, 0x5665990602666262, 0x699A6699A6626024, 0x998180601801A5A6,
+        0x098269A98A229AAA, 0x6AA28A2A2A2A2A6A, 0xAA62208269999925, 0x9941045959505959,
+        0x4465641194065900, 0x6581961966446504, 0x4459565451514565, 0x5550444519591990,
+        0x1A42682229AA6A9A, 0xA9AA8A6AA828A6A6, 0x889A09A602609809, 0x899A626269A69A20,
+        0xA6A20A222229A69A, 0x6624925865946545, 0x1151595556559554, 0x4544514444441064,
+        0x6190096906001866, 0x4960191906465996, 0x58646640002669A6, 0x226A88A28A8A8AA6,
+        0xAAA9A8A2A28A6A9A, 0x2698266619991906, 0x5996659964190066, 0x4246000600019990,
+        0x1919659654144515, 0x1514551515159556, 0x5444444106640998, 0x9A69A6A6888A6888,
+        0x8A689A20209A6099, 0xA42699826982089A, 0x9A229AA22A28A8A2, 0xAA6A8888A69A6626,
+        0x6641964445114515, 0x1515165556511146, 0x5465010658641906, 0x6586596650651959,
+        0x6565650511111046, 0x46400099A69A6A6A, 0x28A8A6AAAA6A28A9, 0xAAA8828889A9A602,
+        0x6609266666661800, 0x026602609A62609A, 0x6098026606190419, 0x5916551445565551,
+        0x4515156555656595, 0x96419199998009A4, 0x89A66989809A4099, 0x8090249092499800,
+        0x98988220A2228A9A, 0xAA88A2A2A2A28A8A, 0x2A22226809999991, 0x9641111165651111,
+        0x6541959940659019, 0x1991901966591959, 0x1165445151154565, 0x5565656565940640,
+        0x00262689A88A6AA6, 0xAA6AA9A8A28A29A8, 0x22269A6098260262, 0x602626989A698A68,
+        0x888A6A22226A09A0, 0x2602400196444595, 0x5954514545455145, 0x4544565650591966,
+        0x5819900902409018, 0x1864664658404196, 0x40658664242609A0, 0x9A8288A8A2A2A2A9,
+        0xAAAA6A28A9AA8222, 0x989A609000199610, 0x6465906419199606, 0x6640006009060666,
+        0x5991194414159544, 0x5514545454545655, 0x5644441065818609, 0x8268829A9A9A9A26,
+        0xA2689A69A609A626, 0x60980982626989A9, 0xA26A9A8A6AA9AA6A, 0xAA0A29A888208266,
+        0x1999659416559544, 0x5451515145459595, 0x9659646464196191, 0x9019610659645941,
+        0x4655965656444419, 0x65800626698888A2, 0xA28A2A8A6AAAA68A, 0x2A6AA829A6A609A6,
+        0x6624999981860000, 0x0266098269988082, 0x6269099980190119, 0x4414451514551454,
+        0x5155955511445959, 0x411919002499A482, 0x6202020269980998, 0x0249266666666009,
+    },
+    { // silence 24/96 o5
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    },
+};
+
+static const uint64_t dsmGoldenHashes[DSM_GOLDEN_VECTOR_COUNT] = 
+{
+    0xF691FCEBA04E18F5ULL, // sine 16/48
+    0x4CE604B3193B5FADULL, // hot 16/48
+    0x5B8D963431BCE759ULL, // silence 16/48
+    0x0A96AE0A60187599ULL, // sine 24/48
+    0xD87C4E48D98B2091ULL, // hot 24/48
+    0x5B8D963431BCE759ULL, // silence 24/48
+    0xE8192E2D3FBB2919ULL, // sine 16/96
+    0xC4529C21E48E3472ULL, // hot 16/96
+    0x42D7E8BB61A20676ULL, // silence 16/96
+    0xC5DD0643063D6D0BULL, // sine 24/96
+    0x6EC8C55E6FCB1142ULL, // hot 24/96
+    0x42D7E8BB61A20676ULL, // silence 24/96
+    0x01DC90A86C8A74B5ULL, // sine 16/48 o2
+    0x6F8382E9564320A0ULL, // hot 16/48 o2
+    0x87283FE66266D52BULL, // silence 16/48 o2
+    0x54651ACEEE70A61AULL, // sine 24/96 o2
+    0xDA2944F069EAE1C5ULL, // hot 24/96 o2
+    0x9A76E5A017EDDCDDULL, // silence 24/96 o2
+    0x1853DD7000696863ULL, // sine 16/48 o3
+    0xE3FAB5F7AB03F0BCULL, // hot 16/48 o3
+    0x937F6D6C3A57087BULL, // silence 16/48 o3
+    0xBDC7816D91AFCFACULL, // sine 24/96 o3
+    0x396EBFF1C63CB139ULL, // hot 24/96 o3
+    0x088DAEF096B8ABAEULL, // silence 24/96 o3
+    0x782E0A74A5C40904ULL, // sine 16/48 o5
+    0x9E2252FBA2E52722ULL, // hot 16/48 o5
+    0xD39997DC19DDC37AULL, // silence 16/48 o5
+    0xBF65A1261DEBE83EULL, // sine 24/96 o5
+    0xFA1F7EC611C55FE1ULL, // hot 24/96 o5
+    0xC81308D4CB39A212ULL, // silence 24/96 o5
+};
+
+#define DSM_GOLDEN_PIPELINE_COUNT 4
+
+static const uint64_t dsmGoldenPipelineWords[DSM_GOLDEN_PIPELINE_COUNT][DSM_GOLDEN_EXPLICIT_WORDS] = 
+{
+    { // pipeline 16/48
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000090060000, 0x0000000000000000,
+        0x0000001802400000, 0x0000000000000000, 0x9000180000000000, 0x0000000000000000,
+        0x0000000018002400, 0x0000000090018000, 0x2400000060000000, 0x0000180090000002,
+        0x0060000000000024, 0x4000001800009001, 0x2402400006001806, 0x8018000009000009,
+        0x0180006002492424, 0x0000024001801800, 0x2490090006199986, 0x6000180009024242,
+        0x6666600266660242, 0x4240240061866666, 0x4006464411165451, 0x6666009826202088,
+        0x5145514545451651, 0x22688222689A6262, 0x1106599066400001, 0x0098999800240924,
+        0x9999010644651059, 0x9266609980982698, 0x5654511451451105, 0x9A62082089A69898,
+        0x9640660020888A6A, 0x0260000199065910, 0xA8A2A2AAAA2A8A8A, 0x4411111111059596,
+        0xA288A22208826099, 0x4465966464664000, 0x8199900190199909, 0x6060000099980000,
+        0x2498080822682208, 0x0066664665864646, 0x8226998266400650, 0x4019066666666009,
+        0x4441451145454515, 0x8809A62089A08226, 0x1454515159546511, 0x889A68268209A602,
+        0x1064640026626209, 0x0980249924019901, 0xA226822698989800, 0x9196191991990006,
+        0x0000066464000066, 0x0060002666660000, 0x00098208829A8A28, 0x9066641906441941,
+        0xA2A8AA8AAA8AA8A2, 0x0441651105959659, 0xA288A68202664191, 0x6591964019998000,
+        0x9444445451451445, 0x989A6269A69A6269, 0x1416519641919990, 0x8808098980002666,
+        0x0186666466599650, 0x6060000992600989, 0x4445954454515151, 0x8989A62088226882,
+        0x5145114459646466, 0x2089A62699A49980, 0x6002698A688A28A2, 0x0019906464659119,
+        0x8AA2A22A8A6A8888, 0x4659411965965901, 0x82209A6626660000, 0x9664066418619866,
+        0x2666026202268888, 0x6664066641901964, 0xA228A2A288A22882, 0x6591041194106599,
+        0x2080000041105114, 0x19000000260209A0, 0x5515455455545454, 0x88222226A08889A2,
+        0x5451444441191900, 0x269A626260998092, 0x0180099826600024, 0x4242400019990900,
+        0x9001919194104411, 0x0266660980982626, 0x0441066418009A62, 0x0980266001819901,
+        0x68A68A228A2A88AA, 0x9041065964441044, 0x2A22A8A22A29A882, 0x4651965910465906,
+        0x2080980906646596, 0x41901860600999A6, 0x5965965964658666, 0x609A660260998000,
+        0x4092660266099999, 0x0090018664000000, 0x8641919651051145, 0x00909802698269A6,
+        0x5145545551554551, 0x82208888888889A2, 0x4454416464618989, 0x2082626099999000,
+        0xA6A688A28A2A2288, 0x6465919659119644, 0xA229A08269982600, 0x1065990190666664,
+        0x6009266026026820, 0x0024019999901919, 0xA68A6A9AA88A2A8A, 0x1906596591104651,
+        0x2A288A29A989A666, 0x0441964419066400, 0x6664659651445115, 0x0002600826208226,
+        0x1515445454595165, 0x89A0822269A02098, 0x0465964006640001, 0x9898099980002492,
+        0x8664190196596511, 0x4999800998989808, 0x4451151451451059, 0x2269889A69A62626,
+        0x6590060989A0A6A8, 0x0998000664191965, 0xA2A2AA2AAA8AA28A, 0x9651944416511944,
+        0xA288A229A09A6600, 0x4104196406464090, 0x0024006401900006, 0x0009099266024900,
+        0x00099A6269A69A08, 0x9000066464190191, 0x9A69899800006591, 0x9019006666666098,
+        0x0459511451451545, 0x260826988822689A, 0x1515145159544441, 0x682269A082080826,
+        0x110641860098269A, 0x9980999990001996, 0x69A269A698982660, 0x6410190191990000,
+        0x0006199199006199, 0x0000024999800000, 0x800080889A9A82A6, 0x0000640646599659,
+        0xAAA28AA2AAAA8A2A, 0x6504441656594465, 0x22A222089A401904, 0x0410659900018009,
+        0x6511114515144514, 0x8989882082208208, 0x5959650406464006, 0x9882602609998000,
+    },
+    { // pipeline 24/48
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000090060000, 0x0000000000000000,
+        0x0000001802400000, 0x0000000000000000, 0x9000180000000000, 0x0000000000000000,
+        0x0000000018002400, 0x0000000090018000, 0x2400000060000000, 0x0000180090000000,
+        0x0060000000000024, 0x9000000060000000, 0x2402400006001806, 0x0000000180009009,
+        0x0180006002492409, 0x0000024001801800, 0x9090090006199986, 0x1800600009024242,
+        0x6666600099800000, 0x4240240061866666, 0x0906410411165451, 0x6666009826202088,
+        0x5151451551595111, 0x22688222689A6262, 0x1196464199900000, 0x0098998180090924,
+        0x6664064659104595, 0x9266000980202698, 0x1114515114511651, 0x9A69820882262098,
+        0x04199266082222A2, 0x2602424066464419, 0x8A2AA8AAA2AA8A8A, 0x4111059444446511,
+        0x8A288A6A09A60998, 0x0465910190664666, 0x0606664064000666, 0x1860600000999800,
+        0x6660982082268222, 0x6199991901906406, 0x6826980099900419, 0x5990066640099989,
+        0x4414445151451514, 0x898989A09A082208, 0x5514515145954446, 0x8822682269A699A6,
+        0x5064640249826268, 0x6098026400199919, 0x222682269A662600, 0x0641919019000199,
+        0x1806666464006666, 0x9999999826666666, 0x6002620822288A28, 0x6664006464659041,
+        0xA8AA2AA8AA8AAA28, 0x1105944116511044, 0xA88A208809801904, 0x1196590199999982,
+        0x1165165511454451, 0x60269889A69A6209, 0x1444165919190006, 0xA626999898002666,
+        0x1999001990646596, 0x666660009999A498, 0x5116544515451455, 0x809A62089A082226,
+        0x1451595044410199, 0x88209A6980982666, 0x02602088888A9AA8, 0x6649064041964651,
+        0x8A8A8A2A28A29A88, 0x0465044119419641, 0x8226980982666600, 0x9666586664001860,
+        0x0266609A66822229, 0x6066641990065901, 0xA88A9AA28A2229A2, 0x1965910411965906,
+        0x2260001906510515, 0x4019992662602088, 0x1455455155545514, 0x2208888A689A2268,
+        0x5151444165064199, 0x8209A02026099980, 0x9909998998266666, 0x0240199999000018,
+        0x6666599419410441, 0x6000266266260980, 0x110646466180989A, 0x9898009998664006,
+        0x688888A9AAA29AA9, 0x5906441946596596, 0xAA8A9AA88A6A829A, 0x5046594104106590,
+        0x0826999900019659, 0x6419024026666260, 0x4659659104641990, 0x9826266266266600,
+        0x0000998998002664, 0x0060199990000618, 0x9000659650451145, 0x6000266998808226,
+        0x4545545551551545, 0x8222208A68889A22, 0x4514165906400988, 0x6826998980000664,
+        0x2229A88A22A9AA29, 0x0644196596591964, 0xA29A268262626618, 0x4101019019901981,
+        0x009266602609A622, 0x8666664006664191, 0x20A6A88A28AA28A8, 0x9041911041119465,
+        0xA88A888A20898980, 0x1965906596640019, 0x0004104654445145, 0x986026699A6269A0,
+        0x1545156555959444, 0x882089A2089A6269, 0x4441964019000066, 0x9898099818092492,
+        0x6664640659044451, 0x6666609980980826, 0x1144545145654165, 0x9A6269A69A608269,
+        0x9641999A669A9A9A, 0x9809992406419104, 0xAA6AAA8A2AAAA28A, 0x4111045959651044,
+        0x2A28A22268989809, 0x6594041906419902, 0x2400001900640006, 0x4090992660026490,
+        0x0026699A69888222, 0x9024066464019190, 0x6820989998664644, 0x6466406660600026,
+        0x4656544515955145, 0x0826982208208889, 0x4515145151459594, 0xA268209A269A6698,
+        0x1065990026626208, 0x2600999999901991, 0x9A20822082098099, 0x9190640190640001,
+        0x9924000640199000, 0x8060002666606000, 0x0260269A68288A6A, 0x9019901906599650,
+        0xAA28AA2AA8AAA2A8, 0x4111110594444465, 0xA29A889A66000196, 0x0410406419999809,
+        0x5944445451655450, 0x809A6269A09A6988, 0x5945965906599906, 0x2699A66266009926,
+    },
+    { // pipeline 16/96
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0199104654595159, 0x0909982698208220, 0x5565544514544459, 0x88222682269A6082,
+        0x5965964064641919, 0x6260980998009998, 0x9190196465046511, 0x099982600980809A,
+        0x6511116541650410, 0x6080826982699898, 0x406642609A62288A, 0x0009990001919641,
+        0x22A8A8A2A28AA2A9, 0x1041110441119441, 0xAA8A6A20A6882098, 0x1041041065990640,
+        0x2660000240924266, 0x0001999999866642, 0x6609809808262698, 0x4000066401990640,
+        0x2026002666646411, 0x0664000186000262, 0x9594511514551455, 0x609A62088226889A,
+        0x1454545516556511, 0x089A2689A69A6269, 0x9419190092660262, 0x2626600006066664,
+        0x6982626998982666, 0x6400664666401999, 0x0024924909999989, 0x9990240024090006,
+        0x989A6226A6A6A2A2, 0x6641991019646504, 0x2A8A2A2A2A2A88A8, 0x6504411044411196,
+        0xA6A89A09A4999901, 0x5064646401860180, 0x9119651651111165, 0x998989826209A609,
+        0x4441119644101006, 0xA609826098026600, 0x4640640659065944, 0x9980002600980989,
+        0x1651445151451515, 0x8989A69882088882, 0x4514451146506466, 0x268209A699899800,
+        0x600988222288A28A, 0x0001996659196444, 0xA28A2A28AA6A29A2, 0x1194650411965919,
+        0x226820989A660982, 0x0658641990199900, 0x6626269826822222, 0x0664064006464646,
+        0x22229A888A69A69A, 0x4646440419640646, 0x6009990641044451, 0x66400026662699A6,
+        0x5145145515451451, 0x9A62226822688226, 0x5516559596596419, 0x89A09A6262609982,
+        0x6666401800000606, 0x6666660006006000, 0x6641900659064644, 0x0009980099809989,
+        0x190640066600209A, 0x9980999999990019, 0x0A68A28A2A2A2A2A, 0x1964194104465194,
+        0x2A28A8AA28A28882, 0x4104411119659665, 0x9A69802400019064, 0x9901990024926602,
+        0x6440406590064664, 0x6602600260000998, 0x0000000060666640, 0x1800006000000009,
+        0x6419659654445145, 0x98026098989A69A6, 0x1515511545151451, 0x98889A088822689A,
+        0x5654410406400098, 0x69A6699802666424, 0x269A0888A6A6A688, 0x1991906590419196,
+        0x889A9A09A6260802, 0x4641919006406640, 0x6260260989882088, 0x0666406640190040,
+        0x888A288A88AA28A8, 0x4191046596444650, 0xA8A288A220A62600, 0x4411964659919900,
+        0x2419196516565514, 0x09266260209A09A0, 0x5151455144544451, 0x89A2682082268080,
+        0x9591191919190190, 0x8098260999809998, 0x1906599644650444, 0x0026626609826098,
+        0x5945945959465065, 0x9A609A6269989826, 0x961998009A6829A8, 0x6099090006464659,
+        0xA8A6AAA6AA22A28A, 0x1046510465104651, 0xA2A29A8888220809, 0x9410410106599919,
+        0x8998006000000009, 0x9900000900060060, 0x998098260989A609, 0x6186646664019001,
+        0x89A6660024019641, 0x9019999002666626, 0x1051145451455151, 0x0809A69A69A69A08,
+        0x5145514545445951, 0x8222689A08226980, 0x9404019999980989, 0x8098002490000190,
+        0xA602020989809809, 0x0190066419900000, 0x9999998060006266, 0x1999999926492400,
+        0x02622689A9A88A28, 0x0064040644196591, 0xA8A8AA28A8A8A2A2, 0x1044111194119465,
+        0x88A29A69A4990006, 0x9659919066642666, 0x4650441654654441, 0x0260989A66982020,
+        0x4165104659191919, 0x9A60262602660266, 0x9199191906441044, 0x6009980026009898,
+        0x4459565595595514, 0x9898820822688220, 0x5145145110441918, 0x882089A609898000,
+        0x60260829A29A8A9A, 0x0001991019644119, 0xAA6AA6A8A28A6A22, 0x6519410465065966,
+        0x2268208080982602, 0x4646406641999901, 0x609898808226889A, 0x9990664064064646,
+        0x829A9A229A22269A, 0x5906465904040640, 0x6024924196441445, 0x6640002660262698,
+        0x1514545451545451, 0x822268208889A088, 0x5159544656506590, 0x22089A609A600980,
+    },
+    { // pipeline 24/96
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0199104654595159, 0x0909982698208220, 0x5565544514544450, 0x88222682269A6082,
+        0x5965065991919006, 0x6262660998009998, 0x4191919641044594, 0x0998009802699898,
+        0x1656565651044410, 0x9A60988262026260, 0x406642609888888A, 0x2666664000101046,
+        0x8A2A28A8AA28A2A8, 0x5941046510465194, 0xA2A2888A6A698809, 0x6506591064191990,
+        0x9826660060606000, 0x0061999999926424, 0x2666260989826982, 0x2400199919991990,
+        0x6998260000664659, 0x1990000618602660, 0x6511145151515151, 0x209889A69A089A08,
+        0x5151454545655110, 0x822088889A698202, 0x46590664999809A6, 0x0998999999900019,
+        0x6202698269980098, 0x0019006641999000, 0x0099090924999800, 0x0006181861819999,
+        0x989A6208A0A29AA8, 0x0066464641964465, 0xA2A28A8A8AA28A28, 0x1941044651044104,
+        0xA9AA682626006199, 0x4106599619999999, 0x1041111111144459, 0x898260209A609A62,
+        0x5941104419646419, 0x6269980200980998, 0x0191991919196596, 0x0002660266099898,
+        0x5651145145151544, 0x989A6269A69A089A, 0x5511451116591000, 0x689A626209898001,
+        0x6026269A2228A22A, 0x8019991010659110, 0x8A88AA28A88A229A, 0x4411044110410419,
+        0x29A6982699898980, 0x1966658664199900, 0x26026988269A6888, 0x1999064019019101,
+        0x8888A222229A2682, 0x0101065910190196, 0x6099999065965144, 0x1999009980989882,
+        0x5151454545514515, 0x689A089A689A089A, 0x4514511656596464, 0x2682698809898099,
+        0x0064000000000619, 0x9800090900909092, 0x9901991919196646, 0x6666009980098026,
+        0x4406406666009882, 0x0099980001819901, 0x220A28A28AA2A28A, 0x9665965910444111,
+        0xA28AA22A8A88A6A6, 0x0441110441104041, 0x8209826666641904, 0x9064001806002666,
+        0x0419191966466401, 0x2660099826600009, 0x9992400240900666, 0x2666666666660000,
+        0x4659941111445145, 0x009899A66982269A, 0x1545454515445514, 0x089A088222688208,
+        0x4544441065818009, 0x9A69809826664909, 0xA62088888A6A226A, 0x1991904040410644,
+        0x20A69A6826202626, 0x1919064664666419, 0x0980262626269888, 0x9900066419906659,
+        0xA688A6AA228A8A8A, 0x9106591104119441, 0x8A28A29A82269800, 0x1946590659066400,
+        0x0006591116545955, 0x06099898269A6088, 0x1454514545144511, 0x2220882208226982,
+        0x1959196419199619, 0x6998260998000998, 0x0641964196504465, 0x0099809802626080,
+        0x4165656511119465, 0x9A609A6262699809, 0x901998009A689A8A, 0x8099240019910104,
+        0x22A2A2A28A8AA28A, 0x6594119465941194, 0x8A2A222829A20269, 0x4104104106419001,
+        0x2600026649249998, 0x9900240006000001, 0x0009826098989882, 0x8666640664199919,
+        0x6260266000064659, 0x9001999009266626, 0x4111445451515454, 0x09A6082208882208,
+        0x5151515145451651, 0x8222208822082698, 0x0419664002660269, 0x2609998181866401,
+        0x9A609A6620260099, 0x9001900190019992, 0x8000000902499998, 0x4000009000060199,
+        0x2699A0889A8A29AA, 0x9900406465919659, 0x8A2A2A28A8AA28A2, 0x1119465194104651,
+        0xA6A9A26200999901, 0x9659064066642499, 0x9104441656541651, 0x8260202698202080,
+        0x1650446596419664, 0x8262609899800998, 0x0640406464659105, 0x2666609998098980,
+        0x9445114515145154, 0x9A6082269A082208, 0x5459545946506419, 0x8222698989899800,
+        0x860989A26A29AA6A, 0x0006646464419659, 0xA28A8A22A8A29A82, 0x6504650411941910,
+        0x9A69889898262600, 0x1966658640066400, 0x262626209A682220, 0x0640066464064196,
+        0xA22222888A688209, 0x4041010419191901, 0xA660061906511114, 0x9900000998080820,
+        0x5451454545454545, 0x882268222689A689, 0x4514451444119646, 0xA09A6989A6626000,
+    },
+};
+
+static const uint64_t dsmGoldenPipelineHashes[DSM_GOLDEN_PIPELINE_COUNT] = 
+{
+    0xCB0FEA1AAF25193BULL, // pipeline 16/48
+    0x81E2FB3A84AA5627ULL, // pipeline 24/48
+    0xB87AF0787594CADAULL, // pipeline 16/96
+    0x7EB940872DB843D5ULL, // pipeline 24/96
+};
@@ -0,0 +1,82 @@
+//  runs src/dsm_m0.S in m0_model: linked into host builds of dsm.h with DSM_ASM_KERNEL defined,
+// so every block the firmware would give to the assembly kernel goes through the cortex-m0+ model instead.
+// DSM_M0_BIN_PATH is the raw binary CMakeLists.txt assembles from dsm_m0.S. dsm_golden_m0 checks the output,
+// dsm_bench takes the cycle count of dsm_m0_glue_cycles_per_block
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "dsm.h"
+#include "m0_model.h"
+
+#define _MEM_SIZE       0x10000
+#define _CODE_ADDRESS   0x0000
+#define _STATE_ADDRESS  0x8000
+
+static m0_model_t model;
+static bool loaded;
+static uint64_t calls;
+
+static void report(void)
+{
+    if (calls)
+        printf("dsm_m0.S: %llu blocks, %.2f cycles per 16 symbols, %.2f per symbol\n", (unsigned long long)calls,
+            (double)model.cycles / calls, (double)model.cycles / calls / 16);
+}
+
+static void load(void)
+{
+    if (!m0_model_init(&model, _MEM_SIZE) || !m0_model_load(&model, DSM_M0_BIN_PATH, _CODE_ADDRESS))
+        exit(2);
+
+    atexit(report);
+    loaded = true;
+}
+
+uint32_t _dsm_calculate_block16_m0(dsm_t* ptr, int32_t sample, int32_t step)
+{
+    if (!loaded)
+        load();
+
+    for (int i = 0; i < 4; ++i)
+        m0_model_write32(&model, _STATE_ADDRESS + offsetof(dsm_t, integrator) + 4 * i, (uint32_t)ptr->integrator[i]);
+
+    m0_model_write32(&model, _STATE_ADDRESS + offsetof(dsm_t, prevSample), (uint32_t)ptr->prevSample);
+    m0_model_write32(&model, _STATE_ADDRESS + offsetof(dsm_t, prevOutput), ptr->prevOutput);
+
+    uint32_t args[3] = { _STATE_ADDRESS, (uint32_t)sample, (uint32_t)step };
+    uint32_t ret = m0_model_call(&model, _CODE_ADDRESS | 1, args, 3);
+
+    if (model.fault)
+        exit(2);
+
+    for (int i = 0; i < 4; ++i)
+        ptr->integrator[i] = (int32_t)m0_model_read32(&model, _STATE_ADDRESS + offsetof(dsm_t, integrator) + 4 * i);
+
+    ptr->prevSample = (int32_t)m0_model_read32(&model, _STATE_ADDRESS + offsetof(dsm_t, prevSample));
+    ptr->prevOutput = m0_model_read32(&model, _STATE_ADDRESS + offsetof(dsm_t, prevOutput));
+
+    ++calls;
+
+    return ret;
+}
+
+//  order 4 x32 over dsmPcm without dither, the firmware path with dsm_m0.S. returns the model cycles per 16 symbol
+// block the kernel took, the C around it is not in there
+double dsm_m0_glue_cycles_per_block(const int32_t* dsmPcm, int frames)
+{
+    if (!loaded)
+        load();
+
+    dsm_t dsm;
+    dsm_init(&dsm);
+
+    uint64_t startCycles = model.cycles;
+    uint64_t startCalls = calls;
+
+    for (int i = 0; i < frames; ++i)
+        dsm_process_sample_x32_o4(&dsm, dsmPcm[i], 0);
+
+    return calls > startCalls ? (double)(model.cycles - startCycles) / (calls - startCalls) : 0;
+}
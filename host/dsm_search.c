@@ -0,0 +1,528 @@
+//power-of-two coefficient search for the dsm.h modulator family, writes dsmCoefficients.h
+//
+//  dsm_search [-o order] [-r 16|32] [-s dBFS] [-t percent] [-n best] [-g] [-c]
+//
+//  -o      search only this order, 2..DSM_MAX_ORDER. without it 2, 3 and 5 are searched and order 4 is kept as is,
+//          dsm_m0.S is written for exactly that set
+//  -r      modulator path the candidates run through: x16 at 96 kHz or x32 at 48 kHz (default), same symbol rate
+//  -s      level of the stress signals, the maximum stable input a set must take: 0 dBFS (PCM full scale) by default,
+//          up to +3 dBFS (_DSM_INT_MAX) for a lower input scaling than DSM_INT24_TO_INT32
+//  -t      run with dsm_set_transition_penalty in percent of _DSM_INT_MAX, sets have to be stable with it too
+//  -n      how many of the best sets to list per order, 8 by default
+//  -g      print a complete dsmCoefficients.h instead of the list:  dsm_search -g > ../src/dsmCoefficients.h
+//  -c      only check the sets of the current dsmCoefficients.h against the constraints, fails if one breaks them
+//
+//  every candidate runs through the same dsm.h templates the firmware functions are generated from, so the integer
+// arithmetic is exactly what the firmware runs. A set is stable when the quantizer input stays within
+// SEARCH_QUANTIZER_LIMIT and every integrator within SEARCH_INTEGRATOR_LIMIT on a clipped two-tone and full-scale
+// sines from 100 Hz to 10 kHz, each with its own dither. Stable sets are ranked by the 1 kHz SNR at -6 dBFS.
+//  reported per set: SNR at -6 and 0 dBFS, the highest sine level that is still stable (above 0 dBFS is the
+// margin DSM_INT24_TO_INT32 leaves, up to _DSM_INT_MAX) and the integrator headroom below 2^31 in bits
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "dsm.h" //built with DSM_INTEGRATOR_METRICS, see CMakeLists.txt
+
+#include "analysis.h"
+
+#define SEARCH_OUTPUT_RATE      1536000.0
+#define SEARCH_SYMBOLS          (1 << 17)   //11.7 Hz bins
+#define SEARCH_WARMUP_WORDS     4096
+#define SEARCH_BAND_HIGH        20000.0
+
+#define SEARCH_QUANTIZER_LIMIT  (1 << 26)   //~8x _DSM_INT_MAX, a stable loop stays within ~4x
+#define SEARCH_INTEGRATOR_LIMIT 0x70000000  //7/8 of int32, what is left is the margin against wrapping
+
+#define SEARCH_HEADROOM_STEP_DB 0.5
+#define SEARCH_MAX_BEST         32
+
+//mirrors hbridge.pio like dsm_bench: a changed output state loses its dead time
+#define SEARCH_T_PULSE_CLOCKS   25
+#define SEARCH_T_DEAD_CLOCKS    4
+
+typedef struct search_signal
+{
+    double amplitude;   //relative to PCM full scale
+    double freq;        //0 is the clipped 5 kHz + 13 kHz two-tone
+    uint32_t seed;      //dither
+} search_signal_t;
+
+//the stability gate, every set has to get through all of them
+static const search_signal_t stressSignals[] =
+{
+    { 1.0, 0,       1 },
+    { 1.0, 10031,   1 },
+    { 1.0, 996,     0xBEEF },
+    { 1.0, 101,     7 },
+    { 1.0, 3001,    99 },
+};
+
+typedef struct search_result
+{
+    dsm_coefficients_t k;
+    double snrDb[2];        //1 kHz at -6 and 0 dBFS
+    double stableDbfs;      //highest stable sine level
+    double headroomBits;    //log2(2^31 / max |integrator|) over the stress signals
+} search_result_t;
+
+//one searched coefficient, DSM_NO_COEFFICIENT first if allowNone
+typedef struct search_slot
+{
+    int8_t* value;
+    int8_t min, max;
+    bool allowNone;
+} search_slot_t;
+
+static int pathOversampling = 32;
+static double stressAmplitude = 1;
+static int32_t transitionPenalty = 0;
+
+static double levels[SEARCH_SYMBOLS], power[SEARCH_SYMBOLS / 2 + 1];
+
+static inline double symbol_level(uint32_t symbol, uint32_t prevSymbol)
+{
+    double level = symbol == 0b01 ? 1 : symbol == 0b10 || symbol == 0b11 ? -1 : 0;
+
+    if (symbol != prevSymbol)
+        level *= (double)(SEARCH_T_PULSE_CLOCKS - SEARCH_T_DEAD_CLOCKS) / SEARCH_T_PULSE_CLOCKS;
+
+    return level;
+}
+
+static int32_t signal_sample(const search_signal_t* signal, int n, double inputRate)
+{
+    double v;
+
+    if (signal->freq == 0)
+    {
+        v = sin(2 * ANALYSIS_PI * 5000 * n / inputRate) + sin(2 * ANALYSIS_PI * 13000 * n / inputRate);
+        v = v > 1 ? 1 : v < -1 ? -1 : v;
+    }
+    else
+        v = sin(2 * ANALYSIS_PI * signal->freq * n / inputRate);
+
+    //full scale is DSM_INT24_TO_INT32 of the largest 24 bit sample, above it up to _DSM_INT_MAX
+    double sample = signal->amplitude * v * DSM_INT24_TO_INT32(0x7FFFFF);
+
+    return (int32_t)lrint(sample > _DSM_INT_MAX ? _DSM_INT_MAX : sample < -_DSM_INT_MAX ? -_DSM_INT_MAX : sample);
+}
+
+//  runs the signal, false as soon as the loop leaves the limits.
+// snrDb gets the 1 kHz SNR if not NULL, peakIntegrator the largest |integrator| seen
+static bool run_signal(const dsm_coefficients_t* k, const search_signal_t* signal, double* snrDb, double* peakIntegrator)
+{
+    int symbolsPerWord = pathOversampling;
+    double inputRate = SEARCH_OUTPUT_RATE / symbolsPerWord;
+    int words = SEARCH_WARMUP_WORDS + SEARCH_SYMBOLS / 32;
+
+    dsm_t dsm;
+    dsm_init(&dsm);
+    dsm_set_transition_penalty(&dsm, transitionPenalty);
+
+    uint32_t random = signal->seed;
+    uint32_t prevSymbol = 0b00;
+    int level = 0, n = 0;
+
+    for (int w = 0; w < words; ++w)
+    {
+        random ^= random << 13;
+        random ^= random >> 17;
+        random ^= random << 5;
+
+        uint64_t word;
+
+        if (symbolsPerWord == 16)
+        {
+            //two 16 symbol halves per word like dsm_process_block_x16 and dsm_bench
+            int32_t first = signal_sample(signal, n++, inputRate);
+            int32_t second = signal_sample(signal, n++, inputRate);
+
+            word = _dsm_process_sample_x16(&dsm, first, second, random, k);
+        }
+        else
+            word = _dsm_process_sample_x32(&dsm, signal_sample(signal, n++, inputRate), random, k);
+
+        if (dsm.quantizerMax > SEARCH_QUANTIZER_LIMIT || dsm.quantizerMin < -SEARCH_QUANTIZER_LIMIT)
+            return false;
+
+        for (int i = 0; i < k->order; ++i)
+            if (dsm.integratorMax[i] > SEARCH_INTEGRATOR_LIMIT || dsm.integratorMin[i] < -SEARCH_INTEGRATOR_LIMIT)
+                return false;
+
+        if (w < SEARCH_WARMUP_WORDS)
+            continue;
+
+        for (int s = 0; s < 32; ++s)
+        {
+            uint32_t symbol = (uint32_t)(word >> (62 - 2 * s)) & 0b11;
+
+            levels[level++] = symbol_level(symbol, prevSymbol);
+            prevSymbol = symbol;
+        }
+    }
+
+    if (peakIntegrator)
+        for (int i = 0; i < k->order; ++i)
+        {
+            *peakIntegrator = fmax(*peakIntegrator, dsm.integratorMax[i]);
+            *peakIntegrator = fmax(*peakIntegrator, -(double)dsm.integratorMin[i]);
+        }
+
+    if (snrDb)
+    {
+        analysis_result_t result;
+
+        analysis_power_spectrum(levels, SEARCH_SYMBOLS, power);
+        analysis_evaluate(power, SEARCH_SYMBOLS, SEARCH_OUTPUT_RATE, SEARCH_BAND_HIGH,
+            &signal->freq, 1, NULL, 0, &result);
+
+        *snrDb = result.snrDb;
+    }
+
+    return true;
+}
+
+//stress signals, then the two SNR runs, false if unstable
+static bool evaluate(const dsm_coefficients_t* k, search_result_t* result)
+{
+    double peak = 1;
+
+    for (size_t i = 0; i < sizeof(stressSignals) / sizeof(stressSignals[0]); ++i)
+    {
+        search_signal_t signal = stressSignals[i];
+        signal.amplitude *= stressAmplitude;
+
+        if (!run_signal(k, &signal, NULL, &peak))
+            return false;
+    }
+
+    const search_signal_t half = { 0.5, 996, 1 }, full = { 1.0, 996, 1 };
+
+    if (!run_signal(k, &half, &result->snrDb[0], NULL) || !run_signal(k, &full, &result->snrDb[1], NULL))
+        return false;
+
+    result->k = *k;
+    result->headroomBits = 31 - log2(peak);
+    result->stableDbfs = NAN;
+
+    return true;
+}
+
+//only for the sets that get reported, 1 kHz sine from 0 dBFS up to _DSM_INT_MAX
+static void measure_stable_level(search_result_t* result)
+{
+    double maxDbfs = 20 * log10((double)_DSM_INT_MAX / DSM_INT24_TO_INT32(0x7FFFFF));
+
+    result->stableDbfs = 0;
+
+    for (double db = SEARCH_HEADROOM_STEP_DB; db <= maxDbfs + 1e-9; db += SEARCH_HEADROOM_STEP_DB)
+    {
+        const search_signal_t signal = { pow(10, db / 20), 996, 1 };
+
+        if (!run_signal(&result->k, &signal, NULL, NULL))
+            break;
+
+        result->stableDbfs = db;
+    }
+}
+
+//keeps best[] sorted by the -6 dBFS SNR, the first set wins a tie
+static void insert_best(search_result_t* best, int* count, int capacity, const search_result_t* result)
+{
+    int pos = *count;
+
+    while (pos > 0 && best[pos - 1].snrDb[0] < result->snrDb[0])
+        --pos;
+
+    if (pos >= capacity)
+        return;
+
+    int moved = (*count < capacity ? *count : capacity - 1) - pos;
+    memmove(&best[pos + 1], &best[pos], moved * sizeof(search_result_t));
+
+    best[pos] = *result;
+
+    if (*count < capacity)
+        ++*count;
+}
+
+//  the search space per order, wide enough around the hand-made order 4 and the last results to find them again.
+// a[0] and c of the early integrators are fixed: the first stage takes the full input, the chain only needs
+// scaling where the integrators would outgrow 32 bits
+static int search_slots(dsm_coefficients_t* k, int order, search_slot_t* slots)
+{
+    memset(k, DSM_NO_COEFFICIENT, sizeof(*k));
+    memset(k->c, 0, sizeof(k->c));
+    k->order = order;
+
+    int count = 0;
+
+#define _SLOT(field, lo, hi, none) slots[count++] = (search_slot_t){ &k->field, lo, hi, none }
+
+    switch (order)
+    {
+    case 2:
+        _SLOT(a[0], 0, 2, false);
+        _SLOT(a[1], 0, 6, false);
+        break;
+
+    case 3:
+        _SLOT(a[0], 0, 1, false);
+        _SLOT(a[1], 1, 5, false);
+        _SLOT(a[2], 2, 9, false);
+        _SLOT(g[0], 8, 13, true);
+        _SLOT(leak[2], 6, 9, true);
+        break;
+
+    case 4:
+        _SLOT(a[0], 0, 1, false);
+        _SLOT(a[1], 1, 3, false);
+        _SLOT(a[2], 3, 5, false);
+        _SLOT(a[3], 6, 9, false);
+        _SLOT(g[0], 9, 11, true);
+        _SLOT(leak[2], 6, 8, true);
+        break;
+
+    case 5:
+        _SLOT(a[0], 0, 0, false);
+        _SLOT(a[1], 1, 1, false);
+        _SLOT(a[2], 3, 5, false);
+        _SLOT(a[3], 5, 9, false);
+        _SLOT(a[4], 3, 8, false);
+        _SLOT(c[4], 2, 5, false);
+        _SLOT(g[0], 9, 12, true);
+        _SLOT(g[2], 6, 10, true);
+        break;
+    }
+
+#undef _SLOT
+
+    return count;
+}
+
+static int search_order(int order, search_result_t* best, int capacity)
+{
+    dsm_coefficients_t k;
+    search_slot_t slots[3 * DSM_MAX_ORDER];
+    int slotCount = search_slots(&k, order, slots);
+
+    long candidates = 1;
+
+    for (int i = 0; i < slotCount; ++i)
+    {
+        *slots[i].value = slots[i].allowNone ? DSM_NO_COEFFICIENT : slots[i].min;
+        candidates *= slots[i].max - slots[i].min + 1 + slots[i].allowNone;
+    }
+
+    int count = 0;
+    long stable = 0;
+
+    fprintf(stderr, "order %d: %ld candidates\n", order, candidates);
+
+    for (long n = 0; n < candidates; ++n)
+    {
+        search_result_t result;
+
+        if (evaluate(&k, &result))
+        {
+            insert_best(best, &count, capacity, &result);
+            ++stable;
+        }
+
+        //odometer over the slots, DSM_NO_COEFFICIENT then min..max
+        for (int i = slotCount - 1; i >= 0; --i)
+        {
+            int8_t* value = slots[i].value;
+
+            if (*value == DSM_NO_COEFFICIENT)
+                *value = slots[i].min;
+            else if (*value < slots[i].max)
+                ++*value;
+            else
+            {
+                *value = slots[i].allowNone ? DSM_NO_COEFFICIENT : slots[i].min;
+                continue;
+            }
+
+            break;
+        }
+    }
+
+    fprintf(stderr, "order %d: %ld stable\n", order, stable);
+
+    for (int i = 0; i < count; ++i)
+        measure_stable_level(&best[i]);
+
+    return count;
+}
+
+static void print_shifts(FILE* f, const char* name, const int8_t* values, int order)
+{
+    fprintf(f, "%s", name);
+
+    for (int i = 0; i < order; ++i)
+        fprintf(f, i ? ", %d" : " %d", values[i]);
+}
+
+static void print_result(const search_result_t* result)
+{
+    printf("SNR %6.2f / %6.2f dB  stable to %+4.1f dBFS  headroom %4.2f bits  ",
+        result->snrDb[0], result->snrDb[1], result->stableDbfs, result->headroomBits);
+
+    print_shifts(stdout, "a", result->k.a, result->k.order);
+    print_shifts(stdout, "  c", result->k.c, result->k.order);
+    print_shifts(stdout, "  g", result->k.g, result->k.order);
+    print_shifts(stdout, "  leak", result->k.leak, result->k.order);
+    printf("\n");
+}
+
+static void print_initializer(const char* field, const int8_t* values, int order)
+{
+    printf("    .%s = {", field);
+
+    for (int i = 0; i < order; ++i)
+    {
+        if (values[i] == DSM_NO_COEFFICIENT)
+            printf(i ? ", DSM_NO_COEFFICIENT" : " DSM_NO_COEFFICIENT");
+        else
+            printf(i ? ", %d" : " %d", values[i]);
+    }
+
+    printf(" },\n");
+}
+
+static void print_header(const search_result_t* sets, const bool* searched)
+{
+    printf("#pragma once\n\n");
+    printf("//  coefficient sets of the dsm.h modulator family, shifts: a = 2^-a[i], DSM_NO_COEFFICIENT is 0.\n");
+    printf("// written by host/dsm_search -g, %s path: the sets with the best 1 kHz -6 dBFS SNR that stay stable with\n",
+        pathOversampling == 16 ? "x16" : "x32");
+    printf("// every integrator below 2^31 on clipped two-tone and %+.1f dBFS sines. order 4 is kept by hand for dsm_m0.S\n",
+        20 * log10(stressAmplitude));
+
+    for (int order = 2; order <= DSM_MAX_ORDER; ++order)
+    {
+        const search_result_t* set = &sets[order - 2];
+        const dsm_coefficients_t* k = &set->k;
+
+        printf("\n//%s SNR %.1f dB at -6 dBFS, %.1f dB at 0 dBFS, stable to %+.1f dBFS, integrator headroom %.2f bits\n",
+            searched[order - 2] ? "searched," : "kept,", set->snrDb[0], set->snrDb[1], set->stableDbfs, set->headroomBits);
+
+        printf("static const dsm_coefficients_t dsmCoefficients%d =\n{\n", order);
+        printf("    .order = %d,\n", order);
+        print_initializer("a", k->a, order);
+
+        for (int i = 0; i < order; ++i)
+            if (k->c[i])
+            {
+                print_initializer("c", k->c, order);
+                break;
+            }
+
+        print_initializer("g", k->g, order);
+        print_initializer("leak", k->leak, order);
+        printf("};\n");
+    }
+}
+
+int main(int argc, char** argv)
+{
+    int onlyOrder = 0, bestCount = 8;
+    bool generate = false, checkOnly = false;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (!strcmp(argv[i], "-o") && i + 1 < argc)
+            onlyOrder = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-r") && i + 1 < argc)
+            pathOversampling = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-s") && i + 1 < argc)
+            stressAmplitude = pow(10, atof(argv[++i]) / 20);
+        else if (!strcmp(argv[i], "-t") && i + 1 < argc)
+            transitionPenalty = (int32_t)(atof(argv[++i]) / 100 * _DSM_INT_MAX);
+        else if (!strcmp(argv[i], "-n") && i + 1 < argc)
+            bestCount = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-g"))
+            generate = true;
+        else if (!strcmp(argv[i], "-c"))
+            checkOnly = true;
+        else
+            onlyOrder = -1;
+    }
+
+    if (onlyOrder < 0 || onlyOrder == 1 || onlyOrder > DSM_MAX_ORDER ||
+        (pathOversampling != 16 && pathOversampling != 32) || bestCount < 1 || bestCount > SEARCH_MAX_BEST ||
+        stressAmplitude < 0.1 || stressAmplitude * DSM_INT24_TO_INT32(0x7FFFFF) > _DSM_INT_MAX || transitionPenalty < 0)
+    {
+        printf("usage: %s [-o 2..%d] [-r 16|32] [-s -20..3 dBFS] [-t percent] [-n 1..%d] [-g] [-c]\n", argv[0], DSM_MAX_ORDER, SEARCH_MAX_BEST);
+        return 1;
+    }
+
+    //what dsmCoefficients.h has now, -c checks these and -g keeps the ones not searched
+    search_result_t current[DSM_MAX_ORDER - 1];
+    bool searched[DSM_MAX_ORDER - 1] = { false };
+    bool ok = true;
+
+    for (int order = 2; order <= DSM_MAX_ORDER; ++order)
+    {
+        search_result_t* set = &current[order - 2];
+
+        if (!evaluate(dsm_kernel(order)->coefficients, set))
+        {
+            printf("FAIL order %d of dsmCoefficients.h is not stable\n", order);
+            ok = false;
+            continue;
+        }
+
+        measure_stable_level(set);
+
+        if (checkOnly)
+        {
+            printf("ok   order %d: ", order);
+            print_result(set);
+        }
+    }
+
+    if (checkOnly || !ok)
+        return ok ? 0 : 1;
+
+    for (int order = 2; order <= DSM_MAX_ORDER; ++order)
+    {
+        if (onlyOrder ? order != onlyOrder : order == 4)
+            continue;
+
+        search_result_t best[SEARCH_MAX_BEST];
+        int count = search_order(order, best, generate ? 1 : bestCount);
+
+        if (!count)
+        {
+            fprintf(stderr, "order %d: no stable set, keeping dsmCoefficients%d\n", order, order);
+            continue;
+        }
+
+        if (generate)
+        {
+            current[order - 2] = best[0];
+            searched[order - 2] = true;
+            continue;
+        }
+
+        printf("order %d, now:  ", order);
+        print_result(&current[order - 2]);
+
+        for (int i = 0; i < count; ++i)
+        {
+            printf("order %d, #%-3d ", order, i + 1);
+            print_result(&best[i]);
+        }
+    }
+
+    if (generate)
+        print_header(current, searched);
+
+    return 0;
+}
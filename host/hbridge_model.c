@@ -0,0 +1,698 @@
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hbridge_model.h"
+
+enum
+{
+    HBRIDGE_OP_JMP,
+    HBRIDGE_OP_OUT,
+    HBRIDGE_OP_MOV,
+    HBRIDGE_OP_SET,
+};
+
+enum
+{
+    HBRIDGE_REG_PINS,
+    HBRIDGE_REG_X,
+    HBRIDGE_REG_Y,
+    HBRIDGE_REG_NULL,
+    HBRIDGE_REG_ISR,
+    HBRIDGE_REG_OSR,
+};
+
+enum
+{
+    HBRIDGE_JMP_ALWAYS,
+    HBRIDGE_JMP_NOT_X,
+    HBRIDGE_JMP_X_DEC,
+    HBRIDGE_JMP_NOT_Y,
+    HBRIDGE_JMP_Y_DEC,
+    HBRIDGE_JMP_X_NOT_Y,
+};
+
+//--------------------------------------------------------------------+
+// assembler for the subset of pioasm syntax hbridge.pio uses
+//--------------------------------------------------------------------+
+
+#define _MAX_LABELS 32
+
+typedef struct asm_ctx
+{
+    hbridge_program_model_t* program;
+    const char* path;
+    int line;
+
+    int labelCount;
+    char labelName[_MAX_LABELS][32];
+    int labelAddr[_MAX_LABELS];
+
+    //jmp targets are resolved after the whole file is read
+    int fixupCount;
+    int fixupInstr[HBRIDGE_MODEL_MAX_INSTRUCTIONS];
+    int fixupLine[HBRIDGE_MODEL_MAX_INSTRUCTIONS];
+    char fixupLabel[HBRIDGE_MODEL_MAX_INSTRUCTIONS][32];
+
+    bool failed;
+} asm_ctx_t;
+
+static void asm_error(asm_ctx_t* ctx, const char* msg, const char* token)
+{
+    if (!ctx->failed)
+        fprintf(stderr, "%s:%d: %s '%s'\n", ctx->path, ctx->line, msg, token);
+
+    ctx->failed = true;
+}
+
+static const char* skip_spaces(const char* s)
+{
+    while (*s && isspace((unsigned char)*s))
+        ++s;
+
+    return s;
+}
+
+static const char* read_ident(const char* s, char* out, int size)
+{
+    int n = 0;
+
+    while (*s && (isalnum((unsigned char)*s) || *s == '_') && n < size - 1)
+        out[n++] = *s++;
+
+    out[n] = 0;
+
+    return s;
+}
+
+static int32_t expr_sum(asm_ctx_t* ctx, const char** s);
+
+static int32_t expr_atom(asm_ctx_t* ctx, const char** s)
+{
+    *s = skip_spaces(*s);
+
+    if (**s == '(')
+    {
+        ++*s;
+        int32_t value = expr_sum(ctx, s);
+        *s = skip_spaces(*s);
+
+        if (**s == ')')
+            ++*s;
+        else
+            asm_error(ctx, "missing ')' in", *s);
+
+        return value;
+    }
+
+    if (**s == '-')
+    {
+        ++*s;
+        return -expr_atom(ctx, s);
+    }
+
+    if (isdigit((unsigned char)**s))
+    {
+        char* end;
+        int32_t value = (*s)[0] == '0' && ((*s)[1] == 'b' || (*s)[1] == 'B')
+            ? (int32_t)strtol(*s + 2, &end, 2)
+            : (int32_t)strtol(*s, &end, 0);
+
+        *s = end;
+        return value;
+    }
+
+    char name[32];
+    const char* after = read_ident(*s, name, sizeof(name));
+
+    if (!name[0])
+    {
+        asm_error(ctx, "bad expression", *s);
+        return 0;
+    }
+
+    *s = after;
+
+    hbridge_program_model_t* program = ctx->program;
+
+    for (int i = 0; i < program->defineCount; ++i)
+        if (!strcmp(program->defineName[i], name))
+            return program->defineValue[i];
+
+    asm_error(ctx, "unknown symbol", name);
+    return 0;
+}
+
+static int32_t expr_product(asm_ctx_t* ctx, const char** s)
+{
+    int32_t value = expr_atom(ctx, s);
+
+    while (1)
+    {
+        *s = skip_spaces(*s);
+
+        if (**s == '*')
+        {
+            ++*s;
+            value *= expr_atom(ctx, s);
+        }
+        else if (**s == '/')
+        {
+            ++*s;
+            int32_t div = expr_atom(ctx, s);
+            value = div ? value / div : 0;
+        }
+        else
+            return value;
+    }
+}
+
+static int32_t expr_sum(asm_ctx_t* ctx, const char** s)
+{
+    int32_t value = expr_product(ctx, s);
+
+    while (1)
+    {
+        *s = skip_spaces(*s);
+
+        if (**s == '+')
+        {
+            ++*s;
+            value += expr_product(ctx, s);
+        }
+        else if (**s == '-')
+        {
+            ++*s;
+            value -= expr_product(ctx, s);
+        }
+        else
+            return value;
+    }
+}
+
+static int parse_reg(asm_ctx_t* ctx, const char* name)
+{
+    static const char* names[] = { "pins", "x", "y", "null", "isr", "osr" };
+
+    for (int i = 0; i < (int)(sizeof(names) / sizeof(names[0])); ++i)
+        if (!strcmp(names[i], name))
+            return i;
+
+    asm_error(ctx, "unsupported operand", name);
+    return 0;
+}
+
+//splits "a, b" into trimmed tokens, returns the count
+static int split_args(char* args, char** out, int max)
+{
+    int n = 0;
+    char* token = strtok(args, ",");
+
+    while (token && n < max)
+    {
+        while (isspace((unsigned char)*token))
+            ++token;
+
+        char* end = token + strlen(token);
+
+        while (end > token && isspace((unsigned char)end[-1]))
+            *--end = 0;
+
+        out[n++] = token;
+        token = strtok(NULL, ",");
+    }
+
+    return n;
+}
+
+static void asm_instruction(asm_ctx_t* ctx, char* text)
+{
+    hbridge_program_model_t* program = ctx->program;
+
+    if (program->length == HBRIDGE_MODEL_MAX_INSTRUCTIONS)
+    {
+        asm_error(ctx, "program too long at", text);
+        return;
+    }
+
+    hbridge_instr_t* instr = &program->instr[program->length];
+    memset(instr, 0, sizeof(*instr));
+
+    //[delay]
+    char* delay = strchr(text, '[');
+
+    if (delay)
+    {
+        *delay++ = 0;
+        char* close = strchr(delay, ']');
+
+        if (close)
+            *close = 0;
+
+        const char* s = delay;
+        instr->delay = (uint8_t)expr_sum(ctx, &s);
+    }
+
+    char op[8];
+    char* args = (char*)read_ident(text, op, sizeof(op));
+
+    //the jmp condition is separated by a space: jmp x!=y label
+    if (!strcmp(op, "jmp"))
+    {
+        char* space = strpbrk((char*)skip_spaces(args), " \t");
+
+        if (space && *skip_spaces(space))
+            *space = ',';
+    }
+
+    char* argv[3];
+    int argc = split_args(args, argv, 3);
+
+    if (!strcmp(op, "out") && argc == 2)
+    {
+        const char* s = argv[1];
+
+        instr->op = HBRIDGE_OP_OUT;
+        instr->dest = (uint8_t)parse_reg(ctx, argv[0]);
+        instr->value = (uint32_t)expr_sum(ctx, &s);
+    }
+    else if (!strcmp(op, "set") && argc == 2)
+    {
+        const char* s = argv[1];
+
+        instr->op = HBRIDGE_OP_SET;
+        instr->dest = (uint8_t)parse_reg(ctx, argv[0]);
+        instr->value = (uint32_t)expr_sum(ctx, &s) & 0x1F;
+    }
+    else if (!strcmp(op, "mov") && argc == 2)
+    {
+        char* src = argv[1];
+
+        instr->op = HBRIDGE_OP_MOV;
+        instr->dest = (uint8_t)parse_reg(ctx, argv[0]);
+
+        if (*src == '~' || *src == '!')
+        {
+            instr->srcOp = 1;
+            ++src;
+        }
+        else if (src[0] == ':' && src[1] == ':')
+        {
+            instr->srcOp = 2;
+            src += 2;
+        }
+
+        instr->src = (uint8_t)parse_reg(ctx, skip_spaces(src));
+    }
+    else if (!strcmp(op, "jmp") && (argc == 1 || argc == 2))
+    {
+        static const char* conditions[] = { "", "!x", "x--", "!y", "y--", "x!=y" };
+
+        instr->op = HBRIDGE_OP_JMP;
+        instr->src = HBRIDGE_JMP_ALWAYS;
+
+        if (argc == 2)
+        {
+            bool known = false;
+
+            for (int i = 1; i < (int)(sizeof(conditions) / sizeof(conditions[0])); ++i)
+                if (!strcmp(conditions[i], argv[0]))
+                {
+                    instr->src = (uint8_t)i;
+                    known = true;
+                }
+
+            if (!known)
+                asm_error(ctx, "unsupported jmp condition", argv[0]);
+        }
+
+        ctx->fixupInstr[ctx->fixupCount] = program->length;
+        ctx->fixupLine[ctx->fixupCount] = ctx->line;
+        snprintf(ctx->fixupLabel[ctx->fixupCount], 32, "%s", argv[argc - 1]);
+        ++ctx->fixupCount;
+    }
+    else
+        asm_error(ctx, "unsupported instruction", op);
+
+    ++program->length;
+}
+
+bool hbridge_program_load(hbridge_program_model_t* program, const char* pioPath)
+{
+    FILE* file = fopen(pioPath, "r");
+
+    if (!file)
+    {
+        fprintf(stderr, "can not open %s\n", pioPath);
+        return false;
+    }
+
+    memset(program, 0, sizeof(*program));
+    program->wrap = -1;
+
+    asm_ctx_t ctx = { .program = program, .path = pioPath };
+
+    char lineBuf[256];
+    bool inCodeBlock = false;
+
+    while (!ctx.failed && fgets(lineBuf, sizeof(lineBuf), file))
+    {
+        ++ctx.line;
+
+        char* comment = strchr(lineBuf, ';');
+
+        if (comment)
+            *comment = 0;
+
+        char* line = (char*)skip_spaces(lineBuf);
+
+        if (inCodeBlock)
+        {
+            if (!strncmp(line, "%}", 2))
+                inCodeBlock = false;
+
+            continue;
+        }
+
+        if (*line == '%')
+        {
+            inCodeBlock = true;
+            continue;
+        }
+
+        if (!*line)
+            continue;
+
+        if (!strncmp(line, ".define", 7))
+        {
+            const char* s = skip_spaces(line + 7);
+            char name[32];
+
+            s = skip_spaces(read_ident(s, name, sizeof(name)));
+
+            if (!strcmp(name, "public"))
+                s = skip_spaces(read_ident(s, name, sizeof(name)));
+
+            if (program->defineCount == HBRIDGE_MODEL_MAX_DEFINES)
+            {
+                asm_error(&ctx, "too many defines at", name);
+                break;
+            }
+
+            int32_t value = expr_sum(&ctx, &s);
+
+            snprintf(program->defineName[program->defineCount], 32, "%s", name);
+            program->defineValue[program->defineCount++] = value;
+            continue;
+        }
+
+        if (!strncmp(line, ".wrap_target", 12))
+        {
+            program->wrapTarget = program->length;
+            continue;
+        }
+
+        if (!strncmp(line, ".wrap", 5))
+        {
+            program->wrap = program->length - 1;
+            continue;
+        }
+
+        if (*line == '.') //.program, .side_set etc. do not affect this model
+            continue;
+
+        //label: [instruction]
+        char name[32];
+        const char* after = read_ident(line, name, sizeof(name));
+
+        if (name[0] && *after == ':')
+        {
+            if (ctx.labelCount == _MAX_LABELS)
+            {
+                asm_error(&ctx, "too many labels at", name);
+                break;
+            }
+
+            snprintf(ctx.labelName[ctx.labelCount], 32, "%s", name);
+            ctx.labelAddr[ctx.labelCount++] = program->length;
+
+            line = (char*)skip_spaces(after + 1);
+
+            if (!*line)
+                continue;
+        }
+
+        asm_instruction(&ctx, line);
+    }
+
+    fclose(file);
+
+    for (int i = 0; i < ctx.fixupCount && !ctx.failed; ++i)
+    {
+        int target = -1;
+
+        for (int l = 0; l < ctx.labelCount; ++l)
+            if (!strcmp(ctx.labelName[l], ctx.fixupLabel[i]))
+                target = ctx.labelAddr[l];
+
+        if (target < 0)
+        {
+            //plain numbers are absolute addresses
+            char* end;
+            target = (int)strtol(ctx.fixupLabel[i], &end, 0);
+
+            if (*end)
+            {
+                ctx.line = ctx.fixupLine[i];
+                asm_error(&ctx, "unknown jmp target", ctx.fixupLabel[i]);
+            }
+        }
+
+        program->instr[ctx.fixupInstr[i]].value = (uint32_t)target;
+    }
+
+    if (program->wrap < 0)
+        program->wrap = program->length - 1;
+
+    return !ctx.failed && program->length > 0;
+}
+
+int32_t hbridge_program_define(const hbridge_program_model_t* program, const char* name, int32_t fallback)
+{
+    for (int i = 0; i < program->defineCount; ++i)
+        if (!strcmp(program->defineName[i], name))
+            return program->defineValue[i];
+
+    return fallback;
+}
+
+//--------------------------------------------------------------------+
+// state machine
+//--------------------------------------------------------------------+
+
+void hbridge_model_start(hbridge_model_t* model, const hbridge_program_model_t* program)
+{
+    memset(model, 0, sizeof(*model));
+
+    model->program = program;
+    model->osrShiftCount = 32; //empty, the first out pulls
+    model->legLastOn[0] = model->legLastOn[1] = -1;
+    model->minDeadClocks = (uint32_t)hbridge_program_define(program, "T_DEAD_CLOCKS", 1);
+    model->stats.minDeadClocksSeen = UINT32_MAX;
+
+    hbridge_model_put(model, (uint32_t)hbridge_program_define(program, "BRIDGE_ZERO", 0));
+}
+
+bool hbridge_model_put(hbridge_model_t* model, uint32_t word)
+{
+    if (hbridge_model_fifo_full(model))
+        return false;
+
+    model->fifo[(model->fifoStart + model->fifoLevel) % HBRIDGE_MODEL_FIFO_DEPTH] = word;
+    ++model->fifoLevel;
+
+    return true;
+}
+
+static uint32_t read_reg(hbridge_model_t* model, int reg)
+{
+    switch (reg)
+    {
+        case HBRIDGE_REG_PINS: return model->pins;
+        case HBRIDGE_REG_X: return model->x;
+        case HBRIDGE_REG_Y: return model->y;
+        case HBRIDGE_REG_ISR: return model->isr;
+        case HBRIDGE_REG_OSR: return model->osr;
+        default: return 0;
+    }
+}
+
+static void write_reg(hbridge_model_t* model, int reg, uint32_t value)
+{
+    switch (reg)
+    {
+        case HBRIDGE_REG_PINS: model->pins = (uint8_t)value; break;
+        case HBRIDGE_REG_X: model->x = value; break;
+        case HBRIDGE_REG_Y: model->y = value; break;
+        case HBRIDGE_REG_ISR: model->isr = value; break;
+        case HBRIDGE_REG_OSR: model->osr = value; model->osrShiftCount = 0; break;
+        default: break;
+    }
+}
+
+static uint32_t bit_reverse(uint32_t v)
+{
+    uint32_t r = 0;
+
+    for (int i = 0; i < 32; ++i)
+        r |= ((v >> i) & 1) << (31 - i);
+
+    return r;
+}
+
+//returns false if the instruction stalled
+static bool execute(hbridge_model_t* model, const hbridge_instr_t* instr)
+{
+    int nextPc = model->pc == model->program->wrap ? model->program->wrapTarget : model->pc + 1;
+
+    switch (instr->op)
+    {
+        case HBRIDGE_OP_OUT:
+        {
+            //autopull
+            if (model->osrShiftCount >= 32)
+            {
+                if (!model->fifoLevel)
+                    return false;
+
+                model->osr = model->fifo[model->fifoStart];
+                model->fifoStart = (model->fifoStart + 1) % HBRIDGE_MODEL_FIFO_DEPTH;
+                --model->fifoLevel;
+                model->osrShiftCount = 0;
+                ++model->stats.wordsPulled;
+            }
+
+            int bits = instr->value ? (int)instr->value : 32;
+            uint32_t value = bits == 32 ? model->osr : model->osr >> (32 - bits); //shift left, msb first
+
+            model->osr = bits == 32 ? 0 : model->osr << bits;
+            model->osrShiftCount += bits;
+
+            write_reg(model, instr->dest, value);
+            break;
+        }
+
+        case HBRIDGE_OP_SET:
+            write_reg(model, instr->dest, instr->value);
+            break;
+
+        case HBRIDGE_OP_MOV:
+        {
+            uint32_t value = read_reg(model, instr->src);
+
+            if (instr->srcOp == 1)
+                value = ~value;
+            else if (instr->srcOp == 2)
+                value = bit_reverse(value);
+
+            write_reg(model, instr->dest, value);
+            break;
+        }
+
+        case HBRIDGE_OP_JMP:
+        {
+            bool jump;
+
+            switch (instr->src)
+            {
+                case HBRIDGE_JMP_NOT_X: jump = !model->x; break;
+                case HBRIDGE_JMP_X_DEC: jump = model->x != 0; --model->x; break;
+                case HBRIDGE_JMP_NOT_Y: jump = !model->y; break;
+                case HBRIDGE_JMP_Y_DEC: jump = model->y != 0; --model->y; break;
+                case HBRIDGE_JMP_X_NOT_Y: jump = model->x != model->y; break;
+                default: jump = true; break;
+            }
+
+            if (jump)
+                nextPc = (int)instr->value;
+
+            break;
+        }
+    }
+
+    model->pc = nextPc;
+    model->delay = instr->delay;
+
+    return true;
+}
+
+static void track_leg(hbridge_model_t* model, int leg, bool high, bool low)
+{
+    hbridge_stats_t* stats = &model->stats;
+
+    if (high && low)
+    {
+        ++stats->shootThroughClocks;
+        return;
+    }
+
+    if (!high && !low)
+    {
+        ++model->legOffClocks[leg];
+        return;
+    }
+
+    int side = high ? 1 : 0;
+
+    if (model->legLastOn[leg] >= 0 && model->legLastOn[leg] != side)
+    {
+        if (model->legOffClocks[leg] < model->minDeadClocks)
+            ++stats->deadTimeViolations;
+
+        if (model->legOffClocks[leg] < stats->minDeadClocksSeen)
+            stats->minDeadClocksSeen = model->legOffClocks[leg];
+    }
+
+    model->legLastOn[leg] = side;
+    model->legOffClocks[leg] = 0;
+}
+
+uint8_t hbridge_model_clock(hbridge_model_t* model)
+{
+    uint8_t prevPins = model->pins;
+
+    if (model->delay)
+        --model->delay;
+    else if (!execute(model, &model->program->instr[model->pc]))
+        ++model->stats.stallClocks;
+
+    uint8_t pins = model->pins;
+    hbridge_stats_t* stats = &model->stats;
+
+    ++stats->clocks;
+
+    static const uint8_t gates[HBRIDGE_GATE_COUNT] = {
+        HBRIDGE_PIN_LOW_MINUS, HBRIDGE_PIN_HIGH_PLUS, HBRIDGE_PIN_LOW_PLUS, HBRIDGE_PIN_HIGH_MINUS
+    };
+
+    for (int g = 0; g < HBRIDGE_GATE_COUNT; ++g)
+        if (!(prevPins & gates[g]) != !(pins & gates[g]))
+            ++stats->gateToggles[g];
+
+    track_leg(model, 0, pins & HBRIDGE_PIN_HIGH_PLUS, pins & HBRIDGE_PIN_LOW_PLUS);
+    track_leg(model, 1, pins & HBRIDGE_PIN_HIGH_MINUS, pins & HBRIDGE_PIN_LOW_MINUS);
+
+    if (!(pins & (HBRIDGE_PIN_HIGH_PLUS | HBRIDGE_PIN_LOW_PLUS)) ||
+        !(pins & (HBRIDGE_PIN_HIGH_MINUS | HBRIDGE_PIN_LOW_MINUS)))
+        ++stats->hiZClocks;
+
+    int level = hbridge_pins_level(pins);
+
+    if (level != model->lastLevel)
+        ++stats->outputTransitions;
+
+    model->lastLevel = level;
+
+    return pins;
+}
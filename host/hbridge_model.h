@@ -0,0 +1,112 @@
+//cycle-accurate software model of one hbridge.pio state machine
+//
+//  the program is assembled at runtime from src/hbridge.pio itself (only the instructions and .defines it uses),
+// so the model follows any timing change made there. State machine configuration mirrors
+// _hbridge_program_init_channel: clkdiv 5, 8 out pins, left shift, autopull at 32 bits, joined 8-deep TX fifo
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define HBRIDGE_MODEL_PIO_CLOCK         (192000000 / 5)
+#define HBRIDGE_MODEL_FIFO_DEPTH        8
+#define HBRIDGE_MODEL_MAX_INSTRUCTIONS  32
+#define HBRIDGE_MODEL_MAX_DEFINES       32
+
+//out pins relative to the channel start pin, see the wiring comment in dacamp.c
+#define HBRIDGE_PIN_LOW_MINUS   0x03    //L-, Load- to 0V
+#define HBRIDGE_PIN_HIGH_PLUS   0x0C    //H+, Load+ to +5V
+#define HBRIDGE_PIN_LOW_PLUS    0x30    //L+, Load+ to 0V
+#define HBRIDGE_PIN_HIGH_MINUS  0xC0    //H-, Load- to +5V
+
+#define HBRIDGE_GATE_COUNT 4
+
+typedef struct hbridge_instr
+{
+    uint8_t op;         //HBRIDGE_OP_*
+    uint8_t dest;
+    uint8_t src;        //or jmp condition
+    uint8_t srcOp;      //mov: 0 none, 1 invert, 2 bit-reverse
+    uint32_t value;     //bit count, set value or jmp target
+    uint8_t delay;
+} hbridge_instr_t;
+
+typedef struct hbridge_program_model
+{
+    hbridge_instr_t instr[HBRIDGE_MODEL_MAX_INSTRUCTIONS];
+    int length;
+    int wrapTarget;
+    int wrap;
+
+    int defineCount;
+    char defineName[HBRIDGE_MODEL_MAX_DEFINES][32];
+    int32_t defineValue[HBRIDGE_MODEL_MAX_DEFINES];
+} hbridge_program_model_t;
+
+typedef struct hbridge_stats
+{
+    uint64_t clocks;
+    uint64_t stallClocks;           //autopull waited on an empty fifo
+    uint64_t wordsPulled;
+    uint64_t outputTransitions;     //changes of the differential output level
+    uint64_t gateToggles[HBRIDGE_GATE_COUNT]; //on/off edges per gate: L-, H+, L+, H-
+    uint64_t hiZClocks;             //at least one half-bridge with both transistors off
+    uint64_t shootThroughClocks;    //both transistors of one half-bridge on
+    uint64_t deadTimeViolations;    //a half-bridge switched sides with fewer than minDeadClocks in between
+    uint32_t minDeadClocksSeen;
+} hbridge_stats_t;
+
+typedef struct hbridge_model
+{
+    const hbridge_program_model_t* program;
+
+    int pc;
+    int delay;
+    uint32_t x, y, isr, osr;
+    int osrShiftCount;
+    uint8_t pins;
+
+    uint32_t fifo[HBRIDGE_MODEL_FIFO_DEPTH];
+    int fifoStart, fifoLevel;
+
+    //dead time tracking per half-bridge: 0 plus side (H+/L+), 1 minus side (H-/L-)
+    int legLastOn[2];   //-1 none yet, 0 low, 1 high
+    uint32_t legOffClocks[2];
+    int lastLevel;
+
+    uint32_t minDeadClocks;
+    hbridge_stats_t stats;
+} hbridge_model_t;
+
+//assembles the .pio file, returns false and prints the reason on unsupported syntax
+bool hbridge_program_load(hbridge_program_model_t* program, const char* pioPath);
+
+//value of a .define, or fallback if it does not exist
+int32_t hbridge_program_define(const hbridge_program_model_t* program, const char* name, int32_t fallback);
+
+//same state as after hbridge_program_start: restarted, jumped to the start, BRIDGE_ZERO preloaded
+void hbridge_model_start(hbridge_model_t* model, const hbridge_program_model_t* program);
+
+static inline bool hbridge_model_fifo_full(const hbridge_model_t* model)
+{
+    return model->fifoLevel == HBRIDGE_MODEL_FIFO_DEPTH;
+}
+
+//pio_sm_put, false if the fifo is full
+bool hbridge_model_put(hbridge_model_t* model, uint32_t word);
+
+//advances one PIO clock, returns the out pins
+uint8_t hbridge_model_clock(hbridge_model_t* model);
+
+//differential output: +1 for +5V, -1 for -5V, 0 when shorted to 0V or (any side) floating
+static inline int hbridge_pins_level(uint8_t pins)
+{
+    int plus = pins & HBRIDGE_PIN_HIGH_PLUS ? 1 : pins & HBRIDGE_PIN_LOW_PLUS ? 0 : -1;
+    int minus = pins & HBRIDGE_PIN_HIGH_MINUS ? 1 : pins & HBRIDGE_PIN_LOW_MINUS ? 0 : -1;
+
+    if (plus < 0 || minus < 0)
+        return 0;
+
+    return plus - minus;
+}
@@ -0,0 +1,246 @@
+//feeds DSM output through the hbridge.pio model and measures what the bridge actually does
+//
+//  hbridge_sim [-r 48000|96000] [-f Hz] [-a dBFS] [-n log2(symbols)] [-p hbridge.pio] [-o waveform.raw] [-c]
+//  -o writes the differential output level per PIO clock as int8 (+1, 0, -1) at 38.4 MHz
+//  -c checks symbol timing, dead time and the pulse area the modulator assumes, exits with 1 on failure
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "dsm.h"
+
+#include "analysis.h"
+#include "hbridge_model.h"
+
+#define SIM_WARMUP_WORDS    64
+#define SIM_BAND_HIGH       20000.0
+
+static inline uint32_t xorshift32(uint32_t x)
+{
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return x;
+}
+
+typedef struct sim_source
+{
+    dsm_t dsm;
+    double phase, step, amplitude;
+    bool sampleRate96k;
+    uint32_t random;
+} sim_source_t;
+
+static int32_t sim_next_pcm(sim_source_t* src)
+{
+    int32_t pcm = (int32_t)lrint(src->amplitude * sin(src->phase) * 8388607);
+    src->phase += src->step;
+
+    return DSM_INT24_TO_INT32(pcm);
+}
+
+static uint64_t sim_next_word(sim_source_t* src)
+{
+    src->random = xorshift32(src->random);
+
+    if (src->sampleRate96k)
+    {
+        int32_t first = sim_next_pcm(src);
+        return dsm_process_sample_x16(&src->dsm, first, sim_next_pcm(src), src->random);
+    }
+
+    return dsm_process_sample_x32(&src->dsm, sim_next_pcm(src), src->random);
+}
+
+static inline int symbol_sign(uint32_t symbol)
+{
+    return symbol == 0b01 ? 1 : symbol >= 0b10 ? -1 : 0;
+}
+
+int main(int argc, char** argv)
+{
+    const char* pioPath = HBRIDGE_PIO_PATH;
+    const char* rawPath = NULL;
+    double sampleRate = 48000, freq = 1000, amplitudeDb = -6;
+    int symbolsLog2 = 18;
+    bool check = false;
+
+    int opt;
+
+    while ((opt = getopt(argc, argv, "r:f:a:n:p:o:c")) != -1)
+    {
+        switch (opt)
+        {
+            case 'r': sampleRate = atof(optarg); break;
+            case 'f': freq = atof(optarg); break;
+            case 'a': amplitudeDb = atof(optarg); break;
+            case 'n': symbolsLog2 = atoi(optarg); break;
+            case 'p': pioPath = optarg; break;
+            case 'o': rawPath = optarg; break;
+            case 'c': check = true; break;
+            default:
+                fprintf(stderr, "usage: %s [-r rate] [-f Hz] [-a dBFS] [-n log2 symbols] [-p hbridge.pio] [-o waveform.raw] [-c]\n", argv[0]);
+                return 2;
+        }
+    }
+
+    hbridge_program_model_t program;
+
+    if (!hbridge_program_load(&program, pioPath))
+        return 2;
+
+    int pulseClocks = hbridge_program_define(&program, "T_PULSE_CLOCKS", 25);
+    int deadClocks = hbridge_program_define(&program, "T_DEAD_CLOCKS", 4);
+
+    int symbols = 1 << symbolsLog2;
+    double symbolRate = (double)HBRIDGE_MODEL_PIO_CLOCK / pulseClocks;
+
+    //snap to a bin center of the analysed block
+    freq = round(freq * symbols / symbolRate) * symbolRate / symbols;
+
+    sim_source_t src = {
+        .step = 2 * ANALYSIS_PI * freq / sampleRate,
+        .amplitude = pow(10, amplitudeDb / 20),
+        .sampleRate96k = sampleRate == 96000,
+        .random = 0xC0FFEE,
+    };
+
+    dsm_init(&src.dsm);
+
+    hbridge_model_t model;
+    hbridge_model_start(&model, &program);
+
+    //one extra symbol of clocks so the last analysed pulse is complete
+    int warmupSymbols = SIM_WARMUP_WORDS * 32;
+    int64_t clockCount = (int64_t)(warmupSymbols + symbols + 1) * pulseClocks + 2;
+
+    int8_t* levels = (int8_t*)malloc(clockCount);
+    uint8_t* symbolLog = (uint8_t*)malloc(warmupSymbols + symbols + 32 * (HBRIDGE_MODEL_FIFO_DEPTH + 2));
+    int symbolCount = 0;
+
+    uint64_t pendingWord = 0;
+    int pendingHalves = 0;
+
+    for (int64_t c = 0; c < clockCount; ++c)
+    {
+        while (!hbridge_model_fifo_full(&model))
+        {
+            //same order as core1_worker: high word first
+            if (!pendingHalves)
+            {
+                pendingWord = sim_next_word(&src);
+                pendingHalves = 2;
+
+                for (int s = 0; s < 32; ++s)
+                    symbolLog[symbolCount++] = (uint8_t)((pendingWord >> (62 - 2 * s)) & 0b11);
+            }
+
+            hbridge_model_put(&model, (uint32_t)(pendingWord >> (pendingHalves == 2 ? 32 : 0)));
+            --pendingHalves;
+        }
+
+        levels[c] = (int8_t)hbridge_pins_level(hbridge_model_clock(&model));
+    }
+
+    hbridge_stats_t* stats = &model.stats;
+    double seconds = stats->clocks / (double)HBRIDGE_MODEL_PIO_CLOCK;
+
+    //  symbol k starts with its `out` at clock 2 + k*T_PULSE (after `mov y` and `out isr`),
+    // a changed +-1 state is driven from clock 10 of its symbol until clock 6 of the next changed one
+    int firstSymbolClock = 2;
+    int windowOffset = 6;
+
+    double* output = (double*)malloc(sizeof(double) * symbols);
+    int areaMismatches = 0;
+
+    for (int k = 0; k < symbols; ++k)
+    {
+        int idx = warmupSymbols + k;
+        int64_t start = firstSymbolClock + (int64_t)idx * pulseClocks + windowOffset;
+        int area = 0;
+
+        for (int c = 0; c < pulseClocks; ++c)
+            area += levels[start + c];
+
+        output[k] = (double)area / pulseClocks;
+
+        //the area _dsm_calculate feeds back: T_PULSE, or T_PULSE - T_DEAD after a change
+        int sign = symbol_sign(symbolLog[idx]);
+        int expected = sign * (symbolLog[idx] == symbolLog[idx - 1] ? pulseClocks : pulseClocks - deadClocks);
+
+        if (sign && symbol_sign(symbolLog[idx + 1]) && area != expected)
+            ++areaMismatches;
+    }
+
+    double* power = (double*)malloc(sizeof(double) * (symbols / 2 + 1));
+    analysis_power_spectrum(output, symbols, power);
+
+    double distortion[ANALYSIS_MAX_DISTORTION_FREQS];
+    int distortionCount = 0;
+
+    for (int h = 2; h <= 9 && h * freq <= SIM_BAND_HIGH; ++h)
+        distortion[distortionCount++] = h * freq;
+
+    analysis_result_t result;
+    analysis_evaluate(power, symbols, symbolRate, SIM_BAND_HIGH, &freq, 1, distortion, distortionCount, &result);
+
+    printf("program: %d instructions from %s, T_PULSE_CLOCKS %d, T_DEAD_CLOCKS %d\n", program.length, pioPath, pulseClocks, deadClocks);
+    printf("input: %.2f Hz at %.1f dBFS, %.0f Hz\n", freq, amplitudeDb, sampleRate);
+    printf("clocks per symbol: %.3f (%llu clocks, %llu words pulled, %llu stall clocks)\n",
+        (double)(stats->clocks - firstSymbolClock) / ((stats->wordsPulled - 1) * 16),
+        (unsigned long long)stats->clocks, (unsigned long long)stats->wordsPulled, (unsigned long long)stats->stallClocks);
+    printf("output transitions: %.0f /s\n", stats->outputTransitions / seconds);
+    printf("gate toggles: L- %.0f /s, H+ %.0f /s, L+ %.0f /s, H- %.0f /s\n",
+        stats->gateToggles[0] / seconds, stats->gateToggles[1] / seconds,
+        stats->gateToggles[2] / seconds, stats->gateToggles[3] / seconds);
+    printf("hi-Z: %.2f%% of the time\n", 100.0 * stats->hiZClocks / stats->clocks);
+    printf("dead time: min %u clocks (%.0f ns), %llu violations, %llu shoot-through clocks\n",
+        stats->minDeadClocksSeen, stats->minDeadClocksSeen * 1e9 / HBRIDGE_MODEL_PIO_CLOCK,
+        (unsigned long long)stats->deadTimeViolations, (unsigned long long)stats->shootThroughClocks);
+    printf("pulse area vs modulator feedback: %d mismatches in %d symbols\n", areaMismatches, symbols);
+    printf("bridge output: SNR %.2f dB, THD+N %.2f dB, noise %.1f dBFS, max spur %.2f dBFS @ %.0f Hz\n",
+        result.snrDb, result.thdnDb, result.noiseDbfs, result.maxSpurDbfs, result.maxSpurFreq);
+
+    if (rawPath)
+    {
+        FILE* raw = fopen(rawPath, "wb");
+
+        if (!raw || fwrite(levels, 1, clockCount, raw) != (size_t)clockCount)
+        {
+            fprintf(stderr, "can not write %s\n", rawPath);
+            return 2;
+        }
+
+        fclose(raw);
+    }
+
+    int ret = 0;
+
+    if (check)
+    {
+        uint64_t expectedClocks = (uint64_t)(stats->wordsPulled - 1) * 16 * pulseClocks;
+
+        if (stats->stallClocks ||
+            stats->clocks - firstSymbolClock < expectedClocks - 16 * pulseClocks ||
+            stats->clocks - firstSymbolClock > expectedClocks ||
+            stats->deadTimeViolations ||
+            stats->shootThroughClocks ||
+            areaMismatches)
+        {
+            printf("CHECK FAILED\n");
+            ret = 1;
+        }
+        else
+            printf("check ok\n");
+    }
+
+    free(levels);
+    free(symbolLog);
+    free(output);
+    free(power);
+
+    return ret;
+}
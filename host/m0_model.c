@@ -0,0 +1,541 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "m0_model.h"
+
+//any address outside memory works, bit 0 is the thumb bit
+#define _RETURN_ADDRESS 0xFFFFFFFE
+
+static void fault(m0_model_t* model, const char* msg, uint32_t value)
+{
+    if (!model->fault)
+        fprintf(stderr, "m0_model: %s 0x%08X at pc 0x%08X\n", msg, value, model->r[M0_MODEL_PC]);
+
+    model->fault = true;
+}
+
+bool m0_model_init(m0_model_t* model, uint32_t memSize)
+{
+    memset(model, 0, sizeof(*model));
+
+    model->mem = (uint8_t*)calloc(memSize, 1);
+    model->memSize = memSize;
+
+    return model->mem != NULL;
+}
+
+void m0_model_free(m0_model_t* model)
+{
+    free(model->mem);
+    model->mem = NULL;
+}
+
+uint32_t m0_model_load(m0_model_t* model, const char* path, uint32_t address)
+{
+    FILE* f = fopen(path, "rb");
+
+    if (!f)
+    {
+        fprintf(stderr, "can not open %s\n", path);
+        return 0;
+    }
+
+    uint32_t size = (uint32_t)fread(model->mem + address, 1, model->memSize - address, f);
+    fclose(f);
+
+    return size;
+}
+
+static bool check_access(m0_model_t* model, uint32_t address, uint32_t size)
+{
+    if (address > model->memSize - size)
+    {
+        fault(model, "access outside memory", address);
+        return false;
+    }
+
+    if (address & (size - 1))
+    {
+        fault(model, "unaligned access", address);
+        return false;
+    }
+
+    return true;
+}
+
+static uint32_t read_mem(m0_model_t* model, uint32_t address, uint32_t size)
+{
+    if (!check_access(model, address, size))
+        return 0;
+
+    const uint8_t* p = model->mem + address;
+
+    return size == 1 ? p[0] : size == 2 ? (uint32_t)(p[0] | (p[1] << 8))
+        : (uint32_t)(p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24));
+}
+
+static void write_mem(m0_model_t* model, uint32_t address, uint32_t value, uint32_t size)
+{
+    if (!check_access(model, address, size))
+        return;
+
+    for (uint32_t i = 0; i < size; ++i)
+        model->mem[address + i] = (uint8_t)(value >> (8 * i));
+}
+
+uint32_t m0_model_read32(m0_model_t* model, uint32_t address)
+{
+    return read_mem(model, address, 4);
+}
+
+void m0_model_write32(m0_model_t* model, uint32_t address, uint32_t value)
+{
+    write_mem(model, address, value, 4);
+}
+
+//--------------------------------------------------------------------+
+// flags
+//--------------------------------------------------------------------+
+
+static inline void set_nz(m0_model_t* model, uint32_t result)
+{
+    model->n = result >> 31;
+    model->z = result == 0;
+}
+
+static uint32_t add_with_carry(m0_model_t* model, uint32_t a, uint32_t b, bool carry, bool setFlags)
+{
+    uint64_t unsignedSum = (uint64_t)a + b + carry;
+    int64_t signedSum = (int64_t)(int32_t)a + (int32_t)b + carry;
+    uint32_t result = (uint32_t)unsignedSum;
+
+    if (setFlags)
+    {
+        set_nz(model, result);
+        model->c = unsignedSum >> 32;
+        model->v = (int64_t)(int32_t)result != signedSum;
+    }
+
+    return result;
+}
+
+static bool condition_passed(m0_model_t* model, uint32_t cond)
+{
+    switch (cond)
+    {
+        case 0x0: return model->z;
+        case 0x1: return !model->z;
+        case 0x2: return model->c;
+        case 0x3: return !model->c;
+        case 0x4: return model->n;
+        case 0x5: return !model->n;
+        case 0x6: return model->v;
+        case 0x7: return !model->v;
+        case 0x8: return model->c && !model->z;
+        case 0x9: return !model->c || model->z;
+        case 0xA: return model->n == model->v;
+        case 0xB: return model->n != model->v;
+        case 0xC: return !model->z && model->n == model->v;
+        case 0xD: return model->z || model->n != model->v;
+        default:  return true;
+    }
+}
+
+//shift by register as the data processing instructions do it, amount is the bottom byte
+static uint32_t shift_reg(m0_model_t* model, uint32_t type, uint32_t value, uint32_t amount)
+{
+    amount &= 0xFF;
+
+    if (!amount)
+        return value;
+
+    switch (type)
+    {
+        case 0: //lsl
+            model->c = amount <= 32 ? (amount == 32 ? value & 1 : (value >> (32 - amount)) & 1) : 0;
+            return amount < 32 ? value << amount : 0;
+
+        case 1: //lsr
+            model->c = amount <= 32 ? (value >> (amount - 1)) & 1 : 0;
+            return amount < 32 ? value >> amount : 0;
+
+        case 2: //asr
+            if (amount >= 32)
+            {
+                model->c = value >> 31;
+                return (uint32_t)((int32_t)value >> 31);
+            }
+
+            model->c = (value >> (amount - 1)) & 1;
+            return (uint32_t)((int32_t)value >> amount);
+
+        default: //ror
+            amount &= 31;
+            value = amount ? (value >> amount) | (value << (32 - amount)) : value;
+            model->c = value >> 31;
+            return value;
+    }
+}
+
+//--------------------------------------------------------------------+
+// execution
+//--------------------------------------------------------------------+
+
+static void branch(m0_model_t* model, uint32_t target)
+{
+    model->r[M0_MODEL_PC] = target & ~1u;
+}
+
+static void execute_data_processing(m0_model_t* model, uint32_t op, uint32_t rdn, uint32_t rm)
+{
+    uint32_t* r = model->r;
+    uint32_t a = r[rdn], b = r[rm], result;
+
+    switch (op)
+    {
+        case 0x0: r[rdn] = a & b; set_nz(model, r[rdn]); break;                    //ands
+        case 0x1: r[rdn] = a ^ b; set_nz(model, r[rdn]); break;                    //eors
+        case 0x2: r[rdn] = shift_reg(model, 0, a, b); set_nz(model, r[rdn]); break; //lsls
+        case 0x3: r[rdn] = shift_reg(model, 1, a, b); set_nz(model, r[rdn]); break; //lsrs
+        case 0x4: r[rdn] = shift_reg(model, 2, a, b); set_nz(model, r[rdn]); break; //asrs
+        case 0x5: r[rdn] = add_with_carry(model, a, b, model->c, true); break;     //adcs
+        case 0x6: r[rdn] = add_with_carry(model, a, ~b, model->c, true); break;    //sbcs
+        case 0x7: r[rdn] = shift_reg(model, 3, a, b); set_nz(model, r[rdn]); break; //rors
+        case 0x8: set_nz(model, a & b); break;                                     //tst
+        case 0x9: r[rdn] = add_with_carry(model, ~b, 0, true, true); break;        //rsbs rdn, rm, #0
+        case 0xA: add_with_carry(model, a, ~b, true, true); break;                 //cmp
+        case 0xB: add_with_carry(model, a, b, false, true); break;                 //cmn
+        case 0xC: r[rdn] = a | b; set_nz(model, r[rdn]); break;                    //orrs
+        case 0xD: result = a * b; r[rdn] = result; set_nz(model, result); break;   //muls, 1 cycle on the RP2040
+        case 0xE: r[rdn] = a & ~b; set_nz(model, r[rdn]); break;                   //bics
+        case 0xF: r[rdn] = ~b; set_nz(model, r[rdn]); break;                       //mvns
+    }
+}
+
+//executes one instruction, returns its cycles
+static int step(m0_model_t* model)
+{
+    uint32_t* r = model->r;
+    uint32_t pc = r[M0_MODEL_PC];
+    uint32_t instr = read_mem(model, pc, 2);
+
+    if (model->fault)
+        return 0;
+
+    //pc reads as the instruction address + 4
+    r[M0_MODEL_PC] = pc + 2;
+    uint32_t pcValue = pc + 4;
+
+    uint32_t rd = instr & 7, rn = (instr >> 3) & 7, rm = (instr >> 6) & 7;
+    uint32_t imm5 = (instr >> 6) & 0x1F, imm8 = instr & 0xFF;
+
+    ++model->instructions;
+
+    switch (instr >> 11)
+    {
+        case 0x00: //lsls imm
+            if (imm5)
+                model->c = (r[rn] >> (32 - imm5)) & 1;
+            r[rd] = r[rn] << imm5;
+            set_nz(model, r[rd]);
+            return 1;
+
+        case 0x01: //lsrs imm, 0 means 32
+            imm5 = imm5 ? imm5 : 32;
+            r[rd] = shift_reg(model, 1, r[rn], imm5);
+            set_nz(model, r[rd]);
+            return 1;
+
+        case 0x02: //asrs imm, 0 means 32
+            imm5 = imm5 ? imm5 : 32;
+            r[rd] = shift_reg(model, 2, r[rn], imm5);
+            set_nz(model, r[rd]);
+            return 1;
+
+        case 0x03: //adds/subs register or imm3
+        {
+            uint32_t operand = instr & 0x400 ? rm : r[rm];
+
+            r[rd] = instr & 0x200
+                ? add_with_carry(model, r[rn], ~operand, true, true)
+                : add_with_carry(model, r[rn], operand, false, true);
+            return 1;
+        }
+
+        case 0x04: //movs imm8
+            r[(instr >> 8) & 7] = imm8;
+            set_nz(model, imm8);
+            return 1;
+
+        case 0x05: //cmp imm8
+            add_with_carry(model, r[(instr >> 8) & 7], ~imm8, true, true);
+            return 1;
+
+        case 0x06: //adds imm8
+            r[(instr >> 8) & 7] = add_with_carry(model, r[(instr >> 8) & 7], imm8, false, true);
+            return 1;
+
+        case 0x07: //subs imm8
+            r[(instr >> 8) & 7] = add_with_carry(model, r[(instr >> 8) & 7], ~imm8, true, true);
+            return 1;
+
+        case 0x08:
+            if (!(instr & 0x400))
+            {
+                execute_data_processing(model, (instr >> 6) & 0xF, rd, rn);
+                return 1;
+            }
+            else
+            {
+                //high register operations and bx/blx
+                uint32_t rdn = rd | ((instr >> 4) & 8), rm4 = (instr >> 3) & 0xF;
+                uint32_t value = rm4 == M0_MODEL_PC ? pcValue : r[rm4];
+
+                switch ((instr >> 8) & 3)
+                {
+                    case 0: //add
+                        if (rdn == M0_MODEL_PC)
+                        {
+                            branch(model, pcValue + value);
+                            return 2;
+                        }
+
+                        r[rdn] += value;
+                        return 1;
+
+                    case 1: //cmp
+                        add_with_carry(model, r[rdn], ~value, true, true);
+                        return 1;
+
+                    case 2: //mov
+                        if (rdn == M0_MODEL_PC)
+                        {
+                            branch(model, value);
+                            return 2;
+                        }
+
+                        r[rdn] = value;
+                        return 1;
+
+                    default: //bx, blx
+                        if (instr & 0x80)
+                            r[M0_MODEL_LR] = (pc + 2) | 1;
+
+                        branch(model, value);
+                        return 2;
+                }
+            }
+
+        case 0x09: //ldr literal
+            r[(instr >> 8) & 7] = read_mem(model, (pcValue & ~3u) + imm8 * 4, 4);
+            return 2;
+
+        case 0x0A:
+        case 0x0B: //load/store register offset
+        {
+            uint32_t address = r[rn] + r[rm];
+
+            switch ((instr >> 9) & 7)
+            {
+                case 0: write_mem(model, address, r[rd], 4); break;                      //str
+                case 1: write_mem(model, address, r[rd], 2); break;                      //strh
+                case 2: write_mem(model, address, r[rd], 1); break;                      //strb
+                case 3: r[rd] = (uint32_t)(int8_t)read_mem(model, address, 1); break;    //ldrsb
+                case 4: r[rd] = read_mem(model, address, 4); break;                      //ldr
+                case 5: r[rd] = read_mem(model, address, 2); break;                      //ldrh
+                case 6: r[rd] = read_mem(model, address, 1); break;                      //ldrb
+                case 7: r[rd] = (uint32_t)(int16_t)read_mem(model, address, 2); break;   //ldrsh
+            }
+
+            return 2;
+        }
+
+        case 0x0C: write_mem(model, r[rn] + imm5 * 4, r[rd], 4); return 2;    //str imm
+        case 0x0D: r[rd] = read_mem(model, r[rn] + imm5 * 4, 4); return 2;    //ldr imm
+        case 0x0E: write_mem(model, r[rn] + imm5, r[rd], 1); return 2;        //strb imm
+        case 0x0F: r[rd] = read_mem(model, r[rn] + imm5, 1); return 2;        //ldrb imm
+        case 0x10: write_mem(model, r[rn] + imm5 * 2, r[rd], 2); return 2;    //strh imm
+        case 0x11: r[rd] = read_mem(model, r[rn] + imm5 * 2, 2); return 2;    //ldrh imm
+
+        case 0x12: write_mem(model, r[M0_MODEL_SP] + imm8 * 4, r[(instr >> 8) & 7], 4); return 2;   //str sp
+        case 0x13: r[(instr >> 8) & 7] = read_mem(model, r[M0_MODEL_SP] + imm8 * 4, 4); return 2;   //ldr sp
+
+        case 0x14: r[(instr >> 8) & 7] = (pcValue & ~3u) + imm8 * 4; return 1;   //adr
+        case 0x15: r[(instr >> 8) & 7] = r[M0_MODEL_SP] + imm8 * 4; return 1;    //add rd, sp, imm
+
+        case 0x16:
+        case 0x17: //misc
+            if ((instr & 0xFF00) == 0xB000)
+            {
+                //add/sub sp, imm7
+                uint32_t offset = (instr & 0x7F) * 4;
+                r[M0_MODEL_SP] += instr & 0x80 ? -offset : offset;
+                return 1;
+            }
+
+            if ((instr & 0xFF00) == 0xB200)
+            {
+                switch ((instr >> 6) & 3)
+                {
+                    case 0: r[rd] = (uint32_t)(int16_t)r[rn]; break;  //sxth
+                    case 1: r[rd] = (uint32_t)(int8_t)r[rn]; break;   //sxtb
+                    case 2: r[rd] = r[rn] & 0xFFFF; break;            //uxth
+                    case 3: r[rd] = r[rn] & 0xFF; break;              //uxtb
+                }
+
+                return 1;
+            }
+
+            if ((instr & 0xFE00) == 0xB400 || (instr & 0xFE00) == 0xBC00)
+            {
+                //push/pop
+                uint32_t list = instr & 0xFF;
+                bool extra = instr & 0x100; //lr for push, pc for pop
+                int count = __builtin_popcount(list) + extra;
+
+                if (!(instr & 0x800))
+                {
+                    uint32_t address = r[M0_MODEL_SP] - 4 * count;
+                    r[M0_MODEL_SP] = address;
+
+                    for (int i = 0; i < 8; ++i)
+                        if (list & (1 << i))
+                        {
+                            write_mem(model, address, r[i], 4);
+                            address += 4;
+                        }
+
+                    if (extra)
+                        write_mem(model, address, r[M0_MODEL_LR], 4);
+
+                    return 1 + count;
+                }
+
+                uint32_t address = r[M0_MODEL_SP];
+
+                for (int i = 0; i < 8; ++i)
+                    if (list & (1 << i))
+                    {
+                        r[i] = read_mem(model, address, 4);
+                        address += 4;
+                    }
+
+                if (extra)
+                {
+                    branch(model, read_mem(model, address, 4));
+                    address += 4;
+                }
+
+                r[M0_MODEL_SP] = address;
+
+                return 1 + count + (extra ? 2 : 0);
+            }
+
+            if ((instr & 0xFFC0) == 0xBA00)
+            {
+                r[rd] = __builtin_bswap32(r[rn]); //rev
+                return 1;
+            }
+
+            if ((instr & 0xFFC0) == 0xBA40)
+            {
+                r[rd] = ((r[rn] & 0x00FF00FF) << 8) | ((r[rn] >> 8) & 0x00FF00FF); //rev16
+                return 1;
+            }
+
+            if ((instr & 0xFFC0) == 0xBAC0)
+            {
+                r[rd] = (uint32_t)(int16_t)((r[rn] << 8) | ((r[rn] >> 8) & 0xFF)); //revsh
+                return 1;
+            }
+
+            if ((instr & 0xFF0F) == 0xBF00)
+                return 1; //nop and hints
+
+            break;
+
+        case 0x18:
+        case 0x19: //stm, ldm
+        {
+            uint32_t base = (instr >> 8) & 7;
+            uint32_t list = instr & 0xFF;
+            uint32_t address = r[base];
+            int count = __builtin_popcount(list);
+
+            for (int i = 0; i < 8; ++i)
+                if (list & (1 << i))
+                {
+                    if (instr & 0x800)
+                        r[i] = read_mem(model, address, 4);
+                    else
+                        write_mem(model, address, r[i], 4);
+
+                    address += 4;
+                }
+
+            //ldm only writes back when the base is not in the list, stm always does
+            if (!(instr & 0x800) || !(list & (1 << base)))
+                r[base] = address;
+
+            return 1 + count;
+        }
+
+        case 0x1A:
+        case 0x1B: //b cond
+        {
+            uint32_t cond = (instr >> 8) & 0xF;
+
+            if (cond >= 0xE)
+                break; //udf, svc
+
+            if (!condition_passed(model, cond))
+                return 1;
+
+            branch(model, pcValue + ((int32_t)(int8_t)imm8 << 1));
+            return 2;
+        }
+
+        case 0x1C: //b
+            branch(model, pcValue + (((int32_t)((instr & 0x7FF) << 21)) >> 20));
+            return 2;
+
+        case 0x1E: //bl, first half
+        {
+            uint32_t second = read_mem(model, pc + 2, 2);
+
+            if ((second & 0xD000) != 0xD000)
+                break;
+
+            uint32_t s = (instr >> 10) & 1;
+            uint32_t i1 = !(((second >> 13) & 1) ^ s), i2 = !(((second >> 11) & 1) ^ s);
+            int32_t offset = (int32_t)((s << 24) | (i1 << 23) | (i2 << 22) | ((instr & 0x3FF) << 12) | ((second & 0x7FF) << 1));
+
+            offset = (offset << 7) >> 7;
+
+            r[M0_MODEL_LR] = (pc + 4) | 1;
+            branch(model, pc + 4 + offset);
+            return 3;
+        }
+    }
+
+    r[M0_MODEL_PC] = pc;
+    fault(model, "unsupported instruction", instr);
+
+    return 0;
+}
+
+uint32_t m0_model_call(m0_model_t* model, uint32_t entry, const uint32_t* args, int argCount)
+{
+    for (int i = 0; i < argCount && i < 4; ++i)
+        model->r[i] = args[i];
+
+    model->r[M0_MODEL_SP] = model->memSize & ~7u;
+    model->r[M0_MODEL_LR] = _RETURN_ADDRESS | 1;
+    branch(model, entry);
+
+    while (!model->fault && model->r[M0_MODEL_PC] != _RETURN_ADDRESS)
+        model->cycles += step(model);
+
+    return model->r[0];
+}
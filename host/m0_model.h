@@ -0,0 +1,40 @@
+//instruction-level model of a cortex-m0+ core (ARMv6-M thumb) for running firmware assembly on the host
+//
+//  enough to call a leaf function from a raw binary and count its cycles:
+// all 16 bit thumb instructions except the system ones, plus BL. Cycle counts follow the cortex-m0+ TRM
+// with the single-cycle multiplier the RP2040 has and zero wait state SRAM
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define M0_MODEL_SP     13
+#define M0_MODEL_LR     14
+#define M0_MODEL_PC     15
+
+typedef struct m0_model
+{
+    uint32_t r[16];
+    bool n, z, c, v;
+
+    uint8_t* mem;       //flat memory starting at address 0
+    uint32_t memSize;
+
+    uint64_t cycles;
+    uint64_t instructions;
+    bool fault;         //stops execution, the reason is printed once
+} m0_model_t;
+
+bool m0_model_init(m0_model_t* model, uint32_t memSize);
+void m0_model_free(m0_model_t* model);
+
+//loads a raw binary, returns its size or 0 on failure
+uint32_t m0_model_load(m0_model_t* model, const char* path, uint32_t address);
+
+uint32_t m0_model_read32(m0_model_t* model, uint32_t address);
+void m0_model_write32(m0_model_t* model, uint32_t address, uint32_t value);
+
+//calls the thumb function at entry with up to 4 arguments and the stack at the top of memory,
+//returns r0 once it returns to the caller. Cycles of the call are added to model->cycles
+uint32_t m0_model_call(m0_model_t* model, uint32_t entry, const uint32_t* args, int argCount);
@@ -0,0 +1,400 @@
+//dacamp_pcm_put conversion kernels and limiter.h: host time and modeled cortex-m0+ cycles per 1 ms USB packet,
+//and a check against a plain per-frame loop
+//
+//  pcm_bench [-c]
+//
+//  the generic column is the conversion as it was before pcmConvert.h: format and gain handled per frame.
+//  -c      only checks every kernel against the generic loop on random PCM and odd packet lengths, fails on a mismatch,
+//          the limiter: bit-exact delay below the ceiling, never above it, gain back to unity after the overs,
+//          and volumeLut.h against the formula in its comment
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "pcmConvert.h"
+#include "limiter.h"
+
+#define BENCH_PACKETS   20000
+#define BENCH_MAX_FRAMES 96 //1 ms at 96 kHz
+
+//  rough cortex-m0+ cost per frame as gcc -O3 would lay it out, same rules as dsm_bench:
+// ALU ops are 1 cycle (muls too), loads/stores 2, taken branches 2 and not taken 1
+#define _M0_LOAD_16         2   //one ldr
+#define _M0_LOAD_24         3   //ldm of both halves
+#define _M0_SCALE           4   //two sxth/asr, two shifts
+#define _M0_GAIN_APPLY      14  //two of: asr, muls, and, muls, asr, add, asr
+#define _M0_GAIN_NEXT       22  //two of: target and current loads, sub, asr, two compares, add, current store
+#define _M0_STORE           4   //two 32 bit str
+#define _M0_LOOP            4   //increments, compare, taken branch
+#define _M0_LOOP_UNROLLED   1   //_M0_LOOP for every 4 frames
+#define _M0_FORMAT_BRANCH   2   //sampleSize compare and branch
+#define _M0_MEMSET          3   //8 bytes of a word-aligned memset
+
+//limiter.h per frame below the ceiling, the unity gain path
+#define _M0_LIMITER_PEAK    10  //two abs as eor/sub with the sign, max, ceiling literal and compare
+#define _M0_LIMITER_ENV     12  //hold, target and current loads, compares, current store
+#define _M0_LIMITER_DELAY   16  //ldm/stm of the frame in and out of the delay line, index wrap
+#define _M0_LIMITER_CLAMP   12  //two of: two compares against the ceiling, not taken
+#define _M0_LIMITER         (_M0_LOAD_24 + _M0_LIMITER_PEAK + _M0_LIMITER_ENV + _M0_LIMITER_DELAY + _M0_LIMITER_CLAMP + _M0_STORE + _M0_LOOP)
+
+typedef struct bench_kernel
+{
+    const char* name;
+    pcm_convert_t convert[2];   //PCM16, PCM24
+    int32_t gainLeft, gainRight;
+    bool ramp;                  //restart the ramp for every packet
+    int m0Gain;                 //modeled gain cost per frame, _M0_*
+} bench_kernel_t;
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static uint32_t xorshift32(uint32_t x)
+{
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return x;
+}
+
+//per frame format and gain, like dacamp_pcm_put used to do it
+static void convert_generic(uint64_t* dst, const void* src, int count, int sampleSize, gain_t* left, gain_t* right)
+{
+    const uint32_t* samples = src;
+    const uint64_t* samples64 = src;
+
+    for (int i = 0; i < count; ++i)
+    {
+        int32_t sampleLeft, sampleRight;
+
+        if (sampleSize == 4)
+        {
+            uint32_t sample = *(samples++);
+            sampleLeft = DSM_INT16_TO_INT32_UNITY(PCM16_LEFT(sample));
+            sampleRight = DSM_INT16_TO_INT32_UNITY(PCM16_RIGHT(sample));
+        }
+        else
+        {
+            uint64_t sample = *(samples64++);
+            sampleLeft = DSM_INT24_TO_INT32_UNITY(PCM24_LEFT(sample));
+            sampleRight = DSM_INT24_TO_INT32_UNITY(PCM24_RIGHT(sample));
+        }
+
+        sampleLeft = gain_apply(sampleLeft, gain_next(left));
+        sampleRight = gain_apply(sampleRight, gain_next(right));
+
+        dst[i] = PCM_DSM_FRAME(sampleLeft, sampleRight);
+    }
+}
+
+static void fill_pcm(uint64_t* pcm, int frames, uint32_t seed)
+{
+    for (int i = 0; i < frames; ++i)
+    {
+        seed = xorshift32(seed);
+        uint32_t a = seed;
+        seed = xorshift32(seed);
+        pcm[i] = ((uint64_t)seed << 32) | a;
+    }
+}
+
+static void start_gains(const bench_kernel_t* kernel, gain_t* left, gain_t* right)
+{
+    gain_init(left, kernel->ramp ? 0 : kernel->gainLeft);
+    gain_init(right, kernel->ramp ? 0 : kernel->gainRight);
+    gain_set_target(left, kernel->gainLeft);
+    gain_set_target(right, kernel->gainRight);
+}
+
+static bool check_limiter(int lookahead);
+static bool check_volume_lut(void);
+
+static bool check(const bench_kernel_t* kernels, int kernelCount)
+{
+    static uint64_t pcm[BENCH_MAX_FRAMES], expected[BENCH_MAX_FRAMES], actual[BENCH_MAX_FRAMES];
+    static const int lengths[] = { 1, 3, 4, 7, 45, 48, 49, 96 };
+
+    bool ok = true;
+    uint32_t seed = 0x12345678;
+
+    for (int k = 0; k < kernelCount; ++k)
+        for (int f = 0; f < 2; ++f)
+        {
+            int sampleSize = f ? 8 : 4;
+            int mismatches = 0;
+
+            for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); ++l)
+            {
+                gain_t expectedLeft, expectedRight, actualLeft, actualRight;
+
+                fill_pcm(pcm, lengths[l], seed = xorshift32(seed));
+
+                start_gains(&kernels[k], &expectedLeft, &expectedRight);
+                start_gains(&kernels[k], &actualLeft, &actualRight);
+
+                convert_generic(expected, pcm, lengths[l], sampleSize, &expectedLeft, &expectedRight);
+                kernels[k].convert[f](actual, pcm, lengths[l], &actualLeft, &actualRight);
+
+                if (memcmp(expected, actual, lengths[l] * sizeof(uint64_t)) ||
+                    expectedLeft.current != actualLeft.current || expectedRight.current != actualRight.current)
+                    ++mismatches;
+            }
+
+            printf("%s %-8s PCM%d\n", mismatches ? "FAIL" : "ok  ", kernels[k].name, f ? 24 : 16);
+
+            ok = ok && !mismatches;
+        }
+
+    return ok && check_limiter(48) && check_limiter(96) && check_volume_lut();
+}
+
+//  the table is committed, not generated by the build: recomputed here the way the generator in its comment does,
+// and it has to span DACAMP_MIN_VOLUME_DB in the UAC2 steps gain_from_uac2 indexes it with
+static bool check_volume_lut(void)
+{
+    int mismatches = 0;
+
+    for (int i = 0; i < VOLUME_LUT_LENGTH; ++i)
+        if (volumeLut[i] != lrint((1 << VOLUME_LUT_Q) * pow(10, -i / 8.0 / 20)))
+            ++mismatches;
+
+    bool span = VOLUME_LUT_LENGTH << VOLUME_LUT_STEP_BITS == -DACAMP_MIN_VOLUME_UAC2;
+
+    printf("%s volumeLut.h: %d of %d entries off the formula%s\n", mismatches || !span ? "FAIL" : "ok  ",
+        mismatches, VOLUME_LUT_LENGTH, span ? "" : ", length does not match DACAMP_MIN_VOLUME_DB");
+
+    return !mismatches && span;
+}
+
+static uint64_t random_frame(uint32_t* seed, int32_t amplitude)
+{
+    *seed = xorshift32(*seed);
+    int32_t left = (int32_t)(*seed % (2 * amplitude + 1)) - amplitude;
+    *seed = xorshift32(*seed);
+    int32_t right = (int32_t)(*seed % (2 * amplitude + 1)) - amplitude;
+
+    return PCM_DSM_FRAME(left, right);
+}
+
+static uint32_t frame_peak(uint64_t frame)
+{
+    int32_t left = PCM_DSM_LEFT(frame), right = PCM_DSM_RIGHT(frame);
+    uint32_t peakLeft = left < 0 ? -left : left, peakRight = right < 0 ? -right : right;
+
+    return peakLeft > peakRight ? peakLeft : peakRight;
+}
+
+//  quiet, random overs up to unity scale, quiet again: frame by frame against the input delayed by lookahead.
+// the gain in effect has to cover the frame leaving, the clamp is only the safety net
+static bool check_limiter(int lookahead)
+{
+    enum { QUIET = 4096, LOUD = 4096, RELEASE = 16 << LIMITER_RELEASE_SHIFT };
+
+    static uint64_t in[QUIET + LOUD + RELEASE + LIMITER_MAX_LOOKAHEAD];
+
+    limiter_t limiter;
+    limiter_init(&limiter, lookahead);
+
+    uint32_t seed = 0xBADC0DE;
+    int total = QUIET + LOUD + RELEASE;
+    int errors = 0, mismatches = 0, notReleased = 0;
+
+    for (int i = 0; i < total; ++i)
+    {
+        bool loud = i >= QUIET && i < QUIET + LOUD;
+
+        //sparse overs of every size in the loud part, some full scale
+        in[i] = random_frame(&seed, DSM_INPUT_CEILING);
+
+        if (loud && (seed & 0x1F) == 0)
+            in[i] = random_frame(&seed, _DSM_INT_MAX);
+    }
+
+    for (int i = 0; i < total; ++i)
+    {
+        uint64_t frame = in[i];
+        limiter_process(&limiter, &frame, 1);
+
+        if (i < lookahead)
+            continue;
+
+        uint64_t expected = in[i - lookahead];
+        uint32_t peak = frame_peak(expected);
+
+        //what gain_apply gives for the peak, the ceiling must not need the clamp
+        if (((int64_t)peak * (limiter.current >> LIMITER_FRACTION_BITS) >> 15) > DSM_INPUT_CEILING + 1)
+            ++errors;
+
+        if (frame_peak(frame) > DSM_INPUT_CEILING)
+            ++errors;
+
+        //the ramp starts up to lookahead frames ahead of the first over
+        if (i < QUIET && frame != expected)
+            ++mismatches;
+
+        if (i >= total - QUIET / 4 && frame != expected)
+            ++notReleased;
+    }
+
+    printf("%s limiter %2d frames: %u overs, %d above the ceiling, %d changed before, %d not released after\n",
+        errors || mismatches || notReleased || !limiter.overs ? "FAIL" : "ok  ", lookahead, limiter.overs, errors, mismatches, notReleased);
+
+    return !errors && !mismatches && !notReleased && limiter.overs;
+}
+
+static int model_m0_cycles_per_packet(const bench_kernel_t* kernel, int f, int frames, bool generic)
+{
+    int load = f ? _M0_LOAD_24 : _M0_LOAD_16;
+
+    if (generic)
+        return frames * (_M0_FORMAT_BRANCH + load + _M0_SCALE + _M0_GAIN_NEXT + _M0_GAIN_APPLY + _M0_STORE + _M0_LOOP);
+
+    if (kernel->convert[f] == pcm_convert_mute)
+        return frames * _M0_MEMSET;
+
+    return frames * (load + _M0_SCALE + kernel->m0Gain + _M0_STORE + _M0_LOOP_UNROLLED);
+}
+
+volatile uint64_t pcmBenchSink;
+
+//limiter.h over DSM frames, quiet music level with an over every 64 frames
+static double bench_limiter_ns_per_packet(int frames)
+{
+    static uint64_t in[BENCH_MAX_FRAMES], out[BENCH_MAX_FRAMES];
+
+    uint32_t seed = 0xCAFEF00D;
+
+    for (int i = 0; i < frames; ++i)
+        in[i] = random_frame(&seed, i % 64 ? DSM_INPUT_CEILING / 2 : _DSM_INT_MAX);
+
+    limiter_t limiter;
+    limiter_init(&limiter, frames);
+
+    uint64_t acc = 0;
+    double elapsed = 0;
+
+    for (int p = 0; p < BENCH_PACKETS; ++p)
+    {
+        memcpy(out, in, frames * sizeof(uint64_t));
+
+        double start = now_ns();
+        limiter_process(&limiter, out, frames);
+        elapsed += now_ns() - start;
+
+        acc ^= out[p % frames];
+    }
+
+    pcmBenchSink = acc;
+
+    return elapsed / BENCH_PACKETS;
+}
+
+static double bench_ns_per_packet(const bench_kernel_t* kernel, int f, int frames, bool generic)
+{
+    static uint64_t pcm[BENCH_MAX_FRAMES], out[BENCH_MAX_FRAMES];
+
+    int sampleSize = f ? 8 : 4;
+    gain_t left, right;
+    uint64_t acc = 0;
+
+    fill_pcm(pcm, frames, 0xCAFEF00D);
+
+    double start = now_ns();
+
+    for (int p = 0; p < BENCH_PACKETS; ++p)
+    {
+        if (kernel->ramp || !p)
+            start_gains(kernel, &left, &right);
+
+        if (generic)
+            convert_generic(out, pcm, frames, sampleSize, &left, &right);
+        else
+            kernel->convert[f](out, pcm, frames, &left, &right);
+
+        acc ^= out[p % frames];
+    }
+
+    double elapsed = now_ns() - start;
+
+    pcmBenchSink = acc;
+
+    return elapsed / BENCH_PACKETS;
+}
+
+int main(int argc, char** argv)
+{
+    bool checkOnly = false;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (!strcmp(argv[i], "-c"))
+            checkOnly = true;
+        else
+        {
+            printf("usage: %s [-c]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    //  gains as pcm_convert_select would see them, the selected kernel is checked too.
+    // -6 dB is volumeLut[48]
+    const bench_kernel_t kernels[] = {
+        { "mute",   { pcm_convert_mute, pcm_convert_mute },         0,              0,              false,  0 },
+        { "unity",  { pcm_convert_16_unity, pcm_convert_24_unity }, GAIN_UNITY,     GAIN_UNITY,     false,  0 },
+        { "fixed",  { pcm_convert_16_fixed, pcm_convert_24_fixed }, volumeLut[48],  GAIN_UNITY,     false,  _M0_GAIN_APPLY },
+        { "ramp",   { pcm_convert_16_ramp, pcm_convert_24_ramp },   volumeLut[48],  volumeLut[48],  true,   _M0_GAIN_NEXT + _M0_GAIN_APPLY },
+    };
+
+    int kernelCount = sizeof(kernels) / sizeof(kernels[0]);
+
+    for (int k = 0; k < kernelCount; ++k)
+        for (int f = 0; f < 2; ++f)
+        {
+            gain_t left, right;
+            start_gains(&kernels[k], &left, &right);
+
+            if (pcm_convert_select(f ? 8 : 4, &left, &right) != kernels[k].convert[f])
+            {
+                printf("FAIL pcm_convert_select does not pick %s for PCM%d\n", kernels[k].name, f ? 24 : 16);
+                return 1;
+            }
+        }
+
+    if (!check(kernels, kernelCount))
+        return 1;
+
+    if (checkOnly)
+        return 0;
+
+    static const int rates[] = { 48, 96 };
+
+    printf("\nper 1 ms packet        host ns: generic   kernel  m0+ cycles: generic   kernel\n");
+
+    for (int r = 0; r < 2; ++r)
+        for (int f = 0; f < 2; ++f)
+            for (int k = 0; k < kernelCount; ++k)
+            {
+                double generic = bench_ns_per_packet(&kernels[k], f, rates[r], true);
+                double kernel = bench_ns_per_packet(&kernels[k], f, rates[r], false);
+
+                printf("%2d kHz PCM%d %-8s %18.1f %8.1f %20d %8d\n", rates[r], f ? 24 : 16, kernels[k].name, generic, kernel,
+                    model_m0_cycles_per_packet(&kernels[k], f, rates[r], true), model_m0_cycles_per_packet(&kernels[k], f, rates[r], false));
+            }
+
+    //  1 ms of look-ahead at either rate. the modeled cycles are the unity gain path,
+    // frames in gain reduction add a gain_apply and the overs a divide
+    printf("\nlimiter.h per 1 ms packet   host ns   m0+ cycles   latency\n");
+
+    for (int r = 0; r < 2; ++r)
+        printf("%2d kHz %27.1f %12d %7.2f ms\n", rates[r], bench_limiter_ns_per_packet(rates[r]), rates[r] * _M0_LIMITER, 1.0);
+
+    return 0;
+}
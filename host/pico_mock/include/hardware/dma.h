@@ -0,0 +1,93 @@
+#pragma once
+
+#include "pico/platform.h"
+
+//  only what a PIO TX feed needs: 32 bit transfers from memory into a state machine's txf, paced by its TX DREQ,
+// with a read ring and chain_to. The PIO clock thread in pico_mock.c moves the words, anything else panics
+
+#define NUM_DMA_CHANNELS 12
+
+#define DREQ_FORCE 0x3f
+
+enum dma_channel_transfer_size
+{
+    DMA_SIZE_8 = 0,
+    DMA_SIZE_16 = 1,
+    DMA_SIZE_32 = 2,
+};
+
+typedef struct
+{
+    enum dma_channel_transfer_size size;
+    bool readIncrement;
+    bool writeIncrement;
+    bool ringWrite;
+    uint ringSizeBits;  //0: no ring
+    uint dreq;
+    uint chainTo;       //own channel: no chaining
+    bool irqQuiet;
+    bool enable;
+} dma_channel_config;
+
+typedef struct
+{
+    volatile uint32_t transfer_count; //live count, like reading TRANS_COUNT
+} dma_channel_hw_t;
+
+int dma_claim_unused_channel(bool required);
+void dma_channel_claim(uint channel);
+void dma_channel_unclaim(uint channel);
+bool dma_channel_is_claimed(uint channel);
+
+dma_channel_config dma_channel_get_default_config(uint channel);
+
+static inline void channel_config_set_transfer_data_size(dma_channel_config* c, enum dma_channel_transfer_size size)
+{
+    c->size = size;
+}
+
+static inline void channel_config_set_read_increment(dma_channel_config* c, bool incr)
+{
+    c->readIncrement = incr;
+}
+
+static inline void channel_config_set_write_increment(dma_channel_config* c, bool incr)
+{
+    c->writeIncrement = incr;
+}
+
+static inline void channel_config_set_ring(dma_channel_config* c, bool write, uint size_bits)
+{
+    c->ringWrite = write;
+    c->ringSizeBits = size_bits;
+}
+
+static inline void channel_config_set_dreq(dma_channel_config* c, uint dreq)
+{
+    c->dreq = dreq;
+}
+
+static inline void channel_config_set_chain_to(dma_channel_config* c, uint chain_to)
+{
+    c->chainTo = chain_to;
+}
+
+static inline void channel_config_set_irq_quiet(dma_channel_config* c, bool irq_quiet)
+{
+    c->irqQuiet = irq_quiet;
+}
+
+static inline void channel_config_set_enable(dma_channel_config* c, bool enable)
+{
+    c->enable = enable;
+}
+
+void dma_channel_set_config(uint channel, const dma_channel_config* config, bool trigger);
+void dma_channel_configure(uint channel, const dma_channel_config* config, volatile void* write_addr,
+                           const volatile void* read_addr, uint transfer_count, bool trigger);
+
+void dma_channel_start(uint channel);
+void dma_channel_abort(uint channel);
+bool dma_channel_is_busy(uint channel);
+
+dma_channel_hw_t* dma_channel_hw_addr(uint channel);
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "pico/platform.h"
+
+#define GPIO_OUT 1
+#define GPIO_IN 0
+
+enum gpio_drive_strength
+{
+    GPIO_DRIVE_STRENGTH_2MA,
+    GPIO_DRIVE_STRENGTH_4MA,
+    GPIO_DRIVE_STRENGTH_8MA,
+    GPIO_DRIVE_STRENGTH_12MA
+};
+
+enum gpio_slew_rate
+{
+    GPIO_SLEW_RATE_SLOW,
+    GPIO_SLEW_RATE_FAST
+};
+
+//pins are only remembered, pico_mock_gpio_get() reads them back
+void gpio_init(uint gpio);
+void gpio_set_dir(uint gpio, bool out);
+void gpio_put(uint gpio, bool value);
+void gpio_set_drive_strength(uint gpio, enum gpio_drive_strength drive);
+void gpio_set_slew_rate(uint gpio, enum gpio_slew_rate slew);
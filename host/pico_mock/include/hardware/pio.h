@@ -0,0 +1,50 @@
+#pragma once
+
+#include "pico/platform.h"
+
+#define NUM_PIO_STATE_MACHINES 4
+
+#define DREQ_PIO0_TX0 0
+#define DREQ_PIO0_RX0 4
+
+struct pio_mock
+{
+    volatile uint32_t txf[NUM_PIO_STATE_MACHINES]; //only a DMA write address, the fifos live in pico_mock.c
+    struct pio_mock_impl* impl;
+};
+
+typedef struct pio_mock* PIO;
+
+extern struct pio_mock pioMock0;
+
+#define pio0 (&pioMock0)
+
+typedef struct pio_program
+{
+    const uint16_t* instructions;
+    uint8_t length;
+    int8_t origin;
+} pio_program_t;
+
+uint pio_add_program(PIO pio, const pio_program_t* program);
+
+static inline uint pio_get_dreq(PIO pio, uint sm, bool is_tx)
+{
+    (void)pio;
+    return (is_tx ? DREQ_PIO0_TX0 : DREQ_PIO0_RX0) + sm;
+}
+
+bool pio_sm_is_claimed(PIO pio, uint sm);
+void pio_sm_claim(PIO pio, uint sm);
+
+void pio_sm_set_enabled(PIO pio, uint sm, bool enabled);
+void pio_enable_sm_mask_in_sync(PIO pio, uint32_t mask);
+void pio_sm_drain_tx_fifo(PIO pio, uint sm);
+
+//like on the hardware a put into a full fifo is lost, it is counted as an overflow
+void pio_sm_put(PIO pio, uint sm, uint32_t data);
+void pio_sm_put_blocking(PIO pio, uint sm, uint32_t data);
+
+uint pio_sm_get_tx_fifo_level(PIO pio, uint sm);
+bool pio_sm_is_tx_fifo_full(PIO pio, uint sm);
+bool pio_sm_is_tx_fifo_empty(PIO pio, uint sm);
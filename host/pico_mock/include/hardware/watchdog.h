@@ -0,0 +1,8 @@
+#pragma once
+
+#include "pico/platform.h"
+
+//the watchdog never reboots, expirations are counted in pico_mock_stats_t instead
+void watchdog_enable(uint32_t delay_ms, bool pause_on_debug);
+void watchdog_update(void);
+bool watchdog_caused_reboot(void);
@@ -0,0 +1,77 @@
+//host stand-in for the pioasm output of hbridge.pio
+//the state machines are simulated at word level by pico_mock.c: one 32 bit word (16 symbols) every 400 PIO clocks
+
+#pragma once
+
+#include "hardware/pio.h"
+
+#define hbridge_T_PULSE_CLOCKS 25
+#define hbridge_T_DEAD_CLOCKS 4
+#define hbridge_T_ACTIVE_CLOCKS 21
+#define hbridge_BRIDGE_ZERO 51
+
+static const uint16_t hbridge_program_instructions[] = { 0 };
+
+static const pio_program_t hbridge_program = {
+    .instructions = hbridge_program_instructions,
+    .length = 19,
+    .origin = -1,
+};
+
+#define HBRIDGE_CHANNEL_PIN_LENGTH 8
+
+static inline bool hbridge_program_init(PIO pio, uint smLeft, uint smRight, uint offset, uint pinLeft, uint pinRight) 
+{
+    (void)offset;
+
+#ifdef HBRIDGE_STEREO
+    if (pinLeft - pinRight < HBRIDGE_CHANNEL_PIN_LENGTH &&
+        pinRight - pinLeft < HBRIDGE_CHANNEL_PIN_LENGTH)
+        return false;
+
+    if (pio_sm_is_claimed(pio, smRight))
+        return false;
+
+    pio_sm_claim(pio, smRight);
+#else
+    (void)smRight;
+    (void)pinLeft;
+    (void)pinRight;
+#endif
+
+    if (pio_sm_is_claimed(pio, smLeft))
+        return false;
+
+    pio_sm_claim(pio, smLeft);
+
+    return true;
+}
+
+//BRIDGE_ZERO preload is consumed by the program itself, so it is not pushed here
+static inline void hbridge_program_start(PIO pio, uint offset, uint smLeft, uint smRight) 
+{
+    (void)offset;
+
+    pio_sm_drain_tx_fifo(pio, smLeft);
+    uint32_t mask = 1 << smLeft;
+
+#ifdef HBRIDGE_STEREO   
+    pio_sm_drain_tx_fifo(pio, smRight);
+    mask |= 1 << smRight;
+#else
+    (void)smRight;
+#endif
+
+    pio_enable_sm_mask_in_sync(pio, mask);
+}
+
+static inline void hbridge_program_stop(PIO pio, uint smLeft, uint smRight) 
+{
+    pio_sm_set_enabled(pio, smLeft, false);
+
+#ifdef HBRIDGE_STEREO    
+    pio_sm_set_enabled(pio, smRight, false);
+#else
+    (void)smRight;
+#endif
+}
@@ -0,0 +1,6 @@
+#pragma once
+
+#include "pico/platform.h"
+
+//runs entry on a separate pthread
+void multicore_launch_core1(void (*entry)(void));
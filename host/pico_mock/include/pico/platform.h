@@ -0,0 +1,16 @@
+//host mock of the pico-sdk subset used by the firmware, see pico_mock.h
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef unsigned int uint;
+
+#define __not_in_flash_func(func) func
+#define __time_critical_func(func) func
+
+void panic(const char* fmt, ...);
+
+static inline void tight_loop_contents(void) {}
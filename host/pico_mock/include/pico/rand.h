@@ -0,0 +1,5 @@
+#pragma once
+
+#include "pico/platform.h"
+
+uint32_t get_rand_32(void);
@@ -0,0 +1,9 @@
+#pragma once
+
+#include "pico/platform.h"
+#include "hardware/gpio.h"
+
+bool set_sys_clock_pll(uint32_t vco_freq, uint post_div1, uint post_div2);
+
+void sleep_ms(uint32_t ms);
+void sleep_us(uint64_t us);
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "pico/platform.h"
+
+//a hardware spinlock is a plain atomic flag here, "irq state" is always 0
+typedef volatile uint32_t spin_lock_t;
+
+int spin_lock_claim_unused(bool required);
+spin_lock_t* spin_lock_init(uint lock_num);
+
+void spin_lock_unsafe_blocking(spin_lock_t* lock);
+void spin_unlock_unsafe(spin_lock_t* lock);
+
+static inline uint32_t spin_lock_blocking(spin_lock_t* lock)
+{
+    spin_lock_unsafe_blocking(lock);
+    return 0;
+}
+
+static inline void spin_unlock(spin_lock_t* lock, uint32_t saved_irq)
+{
+    (void)saved_irq;
+    spin_unlock_unsafe(lock);
+}
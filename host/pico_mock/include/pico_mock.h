@@ -0,0 +1,36 @@
+//harness side of the host pico-sdk mock: simulated PIO clock, statistics and hooks
+
+#pragma once
+
+#include "pico/platform.h"
+#include "hardware/pio.h"
+
+//192 MHz / 5 PIO divider / 25 clocks per symbol = 1.536 MHz, 16 symbols per 32 bit word
+#define PICO_MOCK_PIO_SYMBOL_RATE   1536000
+#define PICO_MOCK_PIO_WORD_NS       (1e9 * 16 / PICO_MOCK_PIO_SYMBOL_RATE)
+
+#define PICO_MOCK_PIO_TX_FIFO_DEPTH 8 //joined TX fifo
+
+typedef struct pico_mock_stats
+{
+    uint64_t pioWordsDrained[NUM_PIO_STATE_MACHINES];
+    uint64_t pioUnderruns[NUM_PIO_STATE_MACHINES];  //times a state machine stalled on an empty fifo
+    uint64_t pioStallNs[NUM_PIO_STATE_MACHINES];    //total stall time, the output is stuck at its last state meanwhile
+    uint64_t pioOverflows[NUM_PIO_STATE_MACHINES];  //puts into a full fifo, the word is lost
+    uint64_t watchdogExpirations;                   //would have rebooted the device
+} pico_mock_stats_t;
+
+//called from the PIO clock thread for every word a state machine consumes
+typedef void (*pico_mock_pio_sink_t)(uint sm, uint32_t word, void* ctx);
+
+//starts the PIO clock thread, call before anything else
+void pico_mock_init(void);
+
+void pico_mock_get_stats(pico_mock_stats_t* stats);
+void pico_mock_reset_stats(void);
+
+void pico_mock_set_pio_sink(pico_mock_pio_sink_t sink, void* ctx);
+
+bool pico_mock_gpio_get(uint gpio);
+
+uint64_t pico_mock_time_ns(void);
@@ -0,0 +1,655 @@
+//host implementation of the pico-sdk subset used by dacamp.c
+//core1 is a pthread, the PIO state machines are drained by a clock thread at the real symbol rate
+
+#define _GNU_SOURCE
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "pico/stdlib.h"
+#include "pico/multicore.h"
+#include "pico/sync.h"
+#include "pico/rand.h"
+#include "hardware/dma.h"
+#include "hardware/pio.h"
+#include "hardware/watchdog.h"
+
+#include "pico_mock.h"
+
+#define _PICO_MOCK_SPINLOCK_COUNT   32
+#define _PICO_MOCK_GPIO_COUNT       30
+#define _PICO_MOCK_CLOCK_PERIOD_NS  20000 //clock thread wake-up, the fifo holds ~83us of symbols
+
+typedef struct pio_mock_sm
+{
+    uint32_t fifo[PICO_MOCK_PIO_TX_FIFO_DEPTH];
+    int fifoStart;
+    int fifoLevel;
+
+    bool claimed;
+    bool enabled;
+    bool stalled;
+
+    uint64_t nextWordNs;    //when the program executes its next autopull
+    uint64_t stallStartNs;
+} pio_mock_sm_t;
+
+struct pio_mock_impl
+{
+    pthread_mutex_t mutex;
+    pio_mock_sm_t sm[NUM_PIO_STATE_MACHINES];
+    uint programOffset;
+};
+
+static struct pio_mock_impl pioMock0Impl = { .mutex = PTHREAD_MUTEX_INITIALIZER };
+
+struct pio_mock pioMock0 = { .impl = &pioMock0Impl };
+
+static spin_lock_t spinlocks[_PICO_MOCK_SPINLOCK_COUNT];
+static uint32_t spinlocksClaimed;
+
+static volatile bool gpioState[_PICO_MOCK_GPIO_COUNT];
+
+static pico_mock_stats_t stats;
+
+static pico_mock_pio_sink_t pioSink;
+static void* pioSinkCtx;
+
+static volatile uint64_t watchdogDelayNs, watchdogLastUpdateNs;
+
+uint64_t pico_mock_time_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+//--------------------------------------------------------------------+
+// DMA
+//--------------------------------------------------------------------+
+
+typedef struct dma_mock_channel
+{
+    bool claimed;
+    bool busy;
+    dma_channel_config config;
+    volatile void* writeAddr;
+    const volatile void* readAddr;
+    uint32_t reload;
+} dma_mock_channel_t;
+
+//guarded by the PIO mutex, a channel only ever talks to a state machine
+static dma_mock_channel_t dmaChannels[NUM_DMA_CHANNELS];
+static dma_channel_hw_t dmaChannelsHw[NUM_DMA_CHANNELS];
+
+static void dma_mock_trigger(uint ch)
+{
+    dma_mock_channel_t* dma = &dmaChannels[ch];
+
+    dmaChannelsHw[ch].transfer_count = dma->reload;
+    __atomic_store_n(&dma->busy, dma->reload > 0, __ATOMIC_RELEASE);
+}
+
+//moves words into the fifo of the state machine for as long as a channel paced by its TX DREQ has some
+static void dma_mock_service(struct pio_mock* pio, uint smIdx)
+{
+    pio_mock_sm_t* sm = &pio->impl->sm[smIdx];
+    bool progress = true;
+
+    while (progress && sm->fifoLevel < PICO_MOCK_PIO_TX_FIFO_DEPTH)
+    {
+        progress = false;
+
+        for (uint ch = 0; ch < NUM_DMA_CHANNELS && sm->fifoLevel < PICO_MOCK_PIO_TX_FIFO_DEPTH; ++ch)
+        {
+            dma_mock_channel_t* dma = &dmaChannels[ch];
+
+            if (!dma->busy || !dma->config.enable || dma->config.dreq != pio_get_dreq(pio, smIdx, true))
+                continue;
+
+            sm->fifo[(sm->fifoStart + sm->fifoLevel) % PICO_MOCK_PIO_TX_FIFO_DEPTH] = *(const volatile uint32_t*)dma->readAddr;
+            ++sm->fifoLevel;
+
+            uintptr_t addr = (uintptr_t)dma->readAddr + sizeof(uint32_t);
+
+            if (dma->config.ringSizeBits)
+            {
+                uintptr_t ringMask = ((uintptr_t)1 << dma->config.ringSizeBits) - 1;
+                addr = ((uintptr_t)dma->readAddr & ~ringMask) | (addr & ringMask);
+            }
+
+            dma->readAddr = (const volatile void*)addr;
+
+            if (--dmaChannelsHw[ch].transfer_count == 0)
+            {
+                __atomic_store_n(&dma->busy, false, __ATOMIC_RELEASE);
+
+                if (dma->config.chainTo != ch)
+                    dma_mock_trigger(dma->config.chainTo);
+            }
+
+            progress = true;
+        }
+    }
+}
+
+//--------------------------------------------------------------------+
+// PIO clock
+//--------------------------------------------------------------------+
+
+static void pio_clock_sm(struct pio_mock* pio, uint smIdx, uint64_t now)
+{
+    pio_mock_sm_t* sm = &pio->impl->sm[smIdx];
+
+    //the DREQ does not care whether the program runs
+    dma_mock_service(pio, smIdx);
+
+    while (sm->enabled && now >= sm->nextWordNs)
+    {
+        if (sm->fifoLevel == 0)
+        {
+            if (!sm->stalled)
+            {
+                sm->stalled = true;
+                sm->stallStartNs = sm->nextWordNs;
+                ++stats.pioUnderruns[smIdx];
+            }
+
+            return;
+        }
+
+        uint32_t word = sm->fifo[sm->fifoStart];
+
+        sm->fifoStart = (sm->fifoStart + 1) % PICO_MOCK_PIO_TX_FIFO_DEPTH;
+        --sm->fifoLevel;
+
+        dma_mock_service(pio, smIdx);
+
+        if (sm->stalled)
+        {
+            //the program resumes right when the word arrives
+            sm->stalled = false;
+            stats.pioStallNs[smIdx] += now - sm->stallStartNs;
+            sm->nextWordNs = now;
+        }
+
+        sm->nextWordNs += (uint64_t)PICO_MOCK_PIO_WORD_NS;
+        ++stats.pioWordsDrained[smIdx];
+
+        if (pioSink)
+            pioSink(smIdx, word, pioSinkCtx);
+    }
+}
+
+static void* pio_clock_thread(void* arg)
+{
+    (void)arg;
+
+    struct timespec period = { 0, _PICO_MOCK_CLOCK_PERIOD_NS };
+
+    while (1)
+    {
+        uint64_t now = pico_mock_time_ns();
+
+        pthread_mutex_lock(&pioMock0Impl.mutex);
+
+        for (uint sm = 0; sm < NUM_PIO_STATE_MACHINES; ++sm)
+            pio_clock_sm(&pioMock0, sm, now);
+
+        pthread_mutex_unlock(&pioMock0Impl.mutex);
+
+        if (watchdogDelayNs && now - watchdogLastUpdateNs > watchdogDelayNs)
+        {
+            ++stats.watchdogExpirations;
+            watchdogLastUpdateNs = now;
+        }
+
+        nanosleep(&period, NULL);
+    }
+
+    return NULL;
+}
+
+void pico_mock_init(void)
+{
+    pthread_t thread;
+
+    if (pthread_create(&thread, NULL, pio_clock_thread, NULL))
+        panic("pico_mock: can not start the PIO clock thread");
+
+    pthread_detach(thread);
+}
+
+void pico_mock_get_stats(pico_mock_stats_t* out)
+{
+    pthread_mutex_lock(&pioMock0Impl.mutex);
+    *out = stats;
+    pthread_mutex_unlock(&pioMock0Impl.mutex);
+}
+
+void pico_mock_reset_stats(void)
+{
+    pthread_mutex_lock(&pioMock0Impl.mutex);
+    memset(&stats, 0, sizeof(stats));
+    pthread_mutex_unlock(&pioMock0Impl.mutex);
+}
+
+void pico_mock_set_pio_sink(pico_mock_pio_sink_t sink, void* ctx)
+{
+    pthread_mutex_lock(&pioMock0Impl.mutex);
+    pioSink = sink;
+    pioSinkCtx = ctx;
+    pthread_mutex_unlock(&pioMock0Impl.mutex);
+}
+
+bool pico_mock_gpio_get(uint gpio)
+{
+    return gpio < _PICO_MOCK_GPIO_COUNT && gpioState[gpio];
+}
+
+//--------------------------------------------------------------------+
+// hardware/pio.h
+//--------------------------------------------------------------------+
+
+uint pio_add_program(PIO pio, const pio_program_t* program)
+{
+    uint offset = pio->impl->programOffset;
+    pio->impl->programOffset += program->length;
+
+    return offset;
+}
+
+bool pio_sm_is_claimed(PIO pio, uint sm)
+{
+    return pio->impl->sm[sm].claimed;
+}
+
+void pio_sm_claim(PIO pio, uint sm)
+{
+    if (pio->impl->sm[sm].claimed)
+        panic("pio_sm_claim: sm %u already claimed", sm);
+
+    pio->impl->sm[sm].claimed = true;
+}
+
+static void pio_sm_set_enabled_locked(PIO pio, uint sm, bool enabled, uint64_t now)
+{
+    pio_mock_sm_t* state = &pio->impl->sm[sm];
+
+    if (enabled && !state->enabled)
+    {
+        state->nextWordNs = now;
+        state->stalled = false;
+    }
+    else if (!enabled && state->stalled)
+    {
+        stats.pioStallNs[sm] += now - state->stallStartNs;
+        state->stalled = false;
+    }
+
+    state->enabled = enabled;
+}
+
+void pio_sm_set_enabled(PIO pio, uint sm, bool enabled)
+{
+    pthread_mutex_lock(&pio->impl->mutex);
+    pio_sm_set_enabled_locked(pio, sm, enabled, pico_mock_time_ns());
+    pthread_mutex_unlock(&pio->impl->mutex);
+}
+
+void pio_enable_sm_mask_in_sync(PIO pio, uint32_t mask)
+{
+    uint64_t now = pico_mock_time_ns();
+
+    pthread_mutex_lock(&pio->impl->mutex);
+
+    for (uint sm = 0; sm < NUM_PIO_STATE_MACHINES; ++sm)
+        if (mask & (1u << sm))
+            pio_sm_set_enabled_locked(pio, sm, true, now);
+
+    pthread_mutex_unlock(&pio->impl->mutex);
+}
+
+void pio_sm_drain_tx_fifo(PIO pio, uint sm)
+{
+    pthread_mutex_lock(&pio->impl->mutex);
+    pio->impl->sm[sm].fifoLevel = 0;
+    pthread_mutex_unlock(&pio->impl->mutex);
+}
+
+void pio_sm_put(PIO pio, uint sm, uint32_t data)
+{
+    pthread_mutex_lock(&pio->impl->mutex);
+
+    pio_mock_sm_t* state = &pio->impl->sm[sm];
+
+    if (state->fifoLevel == PICO_MOCK_PIO_TX_FIFO_DEPTH)
+        ++stats.pioOverflows[sm];
+    else
+    {
+        state->fifo[(state->fifoStart + state->fifoLevel) % PICO_MOCK_PIO_TX_FIFO_DEPTH] = data;
+        ++state->fifoLevel;
+
+        //a stalled program picks the word up immediately
+        if (state->stalled)
+            pio_clock_sm(pio, sm, pico_mock_time_ns());
+    }
+
+    pthread_mutex_unlock(&pio->impl->mutex);
+}
+
+void pio_sm_put_blocking(PIO pio, uint sm, uint32_t data)
+{
+    while (pio_sm_is_tx_fifo_full(pio, sm))
+        sched_yield();
+
+    pio_sm_put(pio, sm, data);
+}
+
+//lock-free like reading FLEVEL, core1 polls this in a tight loop
+uint pio_sm_get_tx_fifo_level(PIO pio, uint sm)
+{
+    return (uint)__atomic_load_n(&pio->impl->sm[sm].fifoLevel, __ATOMIC_ACQUIRE);
+}
+
+bool pio_sm_is_tx_fifo_full(PIO pio, uint sm)
+{
+    return pio_sm_get_tx_fifo_level(pio, sm) == PICO_MOCK_PIO_TX_FIFO_DEPTH;
+}
+
+bool pio_sm_is_tx_fifo_empty(PIO pio, uint sm)
+{
+    return pio_sm_get_tx_fifo_level(pio, sm) == 0;
+}
+
+//--------------------------------------------------------------------+
+// hardware/dma.h
+//--------------------------------------------------------------------+
+
+int dma_claim_unused_channel(bool required)
+{
+    for (uint ch = 0; ch < NUM_DMA_CHANNELS; ++ch)
+        if (!dmaChannels[ch].claimed)
+        {
+            dmaChannels[ch].claimed = true;
+            return (int)ch;
+        }
+
+    if (required)
+        panic("dma_claim_unused_channel: no channels left");
+
+    return -1;
+}
+
+void dma_channel_claim(uint channel)
+{
+    if (dmaChannels[channel].claimed)
+        panic("dma_channel_claim: channel %u already claimed", channel);
+
+    dmaChannels[channel].claimed = true;
+}
+
+void dma_channel_unclaim(uint channel)
+{
+    dmaChannels[channel].claimed = false;
+}
+
+bool dma_channel_is_claimed(uint channel)
+{
+    return dmaChannels[channel].claimed;
+}
+
+dma_channel_config dma_channel_get_default_config(uint channel)
+{
+    dma_channel_config c = {
+        .size = DMA_SIZE_32,
+        .readIncrement = true,
+        .writeIncrement = false,
+        .dreq = DREQ_FORCE,
+        .chainTo = channel,
+        .enable = true,
+    };
+
+    return c;
+}
+
+static void dma_mock_check(uint channel)
+{
+    dma_mock_channel_t* dma = &dmaChannels[channel];
+    uint sm = dma->config.dreq - DREQ_PIO0_TX0;
+
+    if (dma->config.size != DMA_SIZE_32 || !dma->config.readIncrement || dma->config.writeIncrement ||
+        (dma->config.ringSizeBits && dma->config.ringWrite) ||
+        sm >= NUM_PIO_STATE_MACHINES || dma->writeAddr != &pioMock0.txf[sm])
+        panic("dma channel %u: only 32 bit memory to PIO TX transfers paced by the TX DREQ are mocked", channel);
+}
+
+static void dma_mock_start_locked(uint channel)
+{
+    dma_mock_check(channel);
+    dma_mock_trigger(channel);
+
+    //a stalled program picks the words up immediately
+    pio_clock_sm(&pioMock0, dmaChannels[channel].config.dreq - DREQ_PIO0_TX0, pico_mock_time_ns());
+}
+
+void dma_channel_set_config(uint channel, const dma_channel_config* config, bool trigger)
+{
+    pthread_mutex_lock(&pioMock0Impl.mutex);
+
+    dmaChannels[channel].config = *config;
+
+    if (trigger)
+        dma_mock_start_locked(channel);
+
+    pthread_mutex_unlock(&pioMock0Impl.mutex);
+}
+
+void dma_channel_configure(uint channel, const dma_channel_config* config, volatile void* write_addr,
+                           const volatile void* read_addr, uint transfer_count, bool trigger)
+{
+    pthread_mutex_lock(&pioMock0Impl.mutex);
+
+    dma_mock_channel_t* dma = &dmaChannels[channel];
+
+    dma->config = *config;
+    dma->writeAddr = write_addr;
+    dma->readAddr = read_addr;
+    dma->reload = transfer_count;
+
+    if (trigger)
+        dma_mock_start_locked(channel);
+
+    pthread_mutex_unlock(&pioMock0Impl.mutex);
+}
+
+void dma_channel_start(uint channel)
+{
+    pthread_mutex_lock(&pioMock0Impl.mutex);
+    dma_mock_start_locked(channel);
+    pthread_mutex_unlock(&pioMock0Impl.mutex);
+}
+
+void dma_channel_abort(uint channel)
+{
+    pthread_mutex_lock(&pioMock0Impl.mutex);
+    __atomic_store_n(&dmaChannels[channel].busy, false, __ATOMIC_RELEASE);
+    pthread_mutex_unlock(&pioMock0Impl.mutex);
+}
+
+bool dma_channel_is_busy(uint channel)
+{
+    return __atomic_load_n(&dmaChannels[channel].busy, __ATOMIC_ACQUIRE);
+}
+
+dma_channel_hw_t* dma_channel_hw_addr(uint channel)
+{
+    return &dmaChannelsHw[channel];
+}
+
+//--------------------------------------------------------------------+
+// pico/multicore.h, pico/sync.h
+//--------------------------------------------------------------------+
+
+static void* core1_thread(void* arg)
+{
+    ((void (*)(void))arg)();
+    return NULL;
+}
+
+void multicore_launch_core1(void (*entry)(void))
+{
+    pthread_t thread;
+
+    if (pthread_create(&thread, NULL, core1_thread, (void*)entry))
+        panic("multicore_launch_core1: can not start core1 thread");
+
+    pthread_detach(thread);
+}
+
+int spin_lock_claim_unused(bool required)
+{
+    for (int i = 0; i < _PICO_MOCK_SPINLOCK_COUNT; ++i)
+        if (!(spinlocksClaimed & (1u << i)))
+        {
+            spinlocksClaimed |= 1u << i;
+            return i;
+        }
+
+    if (required)
+        panic("spin_lock_claim_unused: no spinlocks left");
+
+    return -1;
+}
+
+spin_lock_t* spin_lock_init(uint lock_num)
+{
+    spinlocks[lock_num] = 0;
+    return &spinlocks[lock_num];
+}
+
+void spin_lock_unsafe_blocking(spin_lock_t* lock)
+{
+    while (__atomic_exchange_n(lock, 1, __ATOMIC_ACQUIRE))
+        sched_yield();
+}
+
+void spin_unlock_unsafe(spin_lock_t* lock)
+{
+    __atomic_store_n(lock, 0, __ATOMIC_RELEASE);
+}
+
+//--------------------------------------------------------------------+
+// hardware/watchdog.h
+//--------------------------------------------------------------------+
+
+void watchdog_enable(uint32_t delay_ms, bool pause_on_debug)
+{
+    (void)pause_on_debug;
+
+    watchdogLastUpdateNs = pico_mock_time_ns();
+    watchdogDelayNs = (uint64_t)delay_ms * 1000000;
+}
+
+void watchdog_update(void)
+{
+    watchdogLastUpdateNs = pico_mock_time_ns();
+}
+
+bool watchdog_caused_reboot(void)
+{
+    return false;
+}
+
+//--------------------------------------------------------------------+
+// misc
+//--------------------------------------------------------------------+
+
+void panic(const char* fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+
+    fprintf(stderr, "PANIC: ");
+    vfprintf(stderr, fmt, args);
+    fprintf(stderr, "\n");
+
+    va_end(args);
+
+    exit(1);
+}
+
+bool set_sys_clock_pll(uint32_t vco_freq, uint post_div1, uint post_div2)
+{
+    (void)vco_freq;
+    (void)post_div1;
+    (void)post_div2;
+
+    return true;
+}
+
+void sleep_us(uint64_t us)
+{
+    struct timespec ts = { (time_t)(us / 1000000), (long)(us % 1000000) * 1000 };
+    nanosleep(&ts, NULL);
+}
+
+void sleep_ms(uint32_t ms)
+{
+    sleep_us((uint64_t)ms * 1000);
+}
+
+uint32_t get_rand_32(void)
+{
+    static __thread uint64_t state;
+
+    if (!state)
+        state = pico_mock_time_ns() | 1;
+
+    //splitmix64
+    uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+
+    return (uint32_t)(z ^ (z >> 31));
+}
+
+//--------------------------------------------------------------------+
+// hardware/gpio.h
+//--------------------------------------------------------------------+
+
+void gpio_init(uint gpio)
+{
+    if (gpio < _PICO_MOCK_GPIO_COUNT)
+        gpioState[gpio] = false;
+}
+
+void gpio_set_dir(uint gpio, bool out)
+{
+    (void)gpio;
+    (void)out;
+}
+
+void gpio_put(uint gpio, bool value)
+{
+    if (gpio < _PICO_MOCK_GPIO_COUNT)
+        gpioState[gpio] = value;
+}
+
+void gpio_set_drive_strength(uint gpio, enum gpio_drive_strength drive)
+{
+    (void)gpio;
+    (void)drive;
+}
+
+void gpio_set_slew_rate(uint gpio, enum gpio_slew_rate slew)
+{
+    (void)gpio;
+    (void)slew;
+}
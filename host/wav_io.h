@@ -0,0 +1,161 @@
+//minimal RIFF/WAVE reading and writing for the host tools
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define WAV_FORMAT_PCM          1
+#define WAV_FORMAT_FLOAT        3
+#define WAV_FORMAT_EXTENSIBLE   0xFFFE
+
+typedef struct wav_pcm
+{
+    uint32_t sampleRate;
+    int bits;           //16 or 24
+    int channels;       //1 or 2
+    int64_t frames;
+    int32_t* samples;   //interleaved, sign-extended to int32 but not rescaled
+} wav_pcm_t;
+
+static inline uint32_t _wav_le16(const uint8_t* p) { return p[0] | (p[1] << 8); }
+static inline uint32_t _wav_le32(const uint8_t* p) { return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24); }
+
+//reads 16/24 bit integer PCM, prints the reason and returns false on anything else
+static bool wav_read_pcm(const char* path, wav_pcm_t* wav)
+{
+    memset(wav, 0, sizeof(*wav));
+
+    FILE* f = fopen(path, "rb");
+
+    if (!f)
+    {
+        fprintf(stderr, "can not open %s\n", path);
+        return false;
+    }
+
+    uint8_t header[12];
+    bool haveFormat = false;
+    int blockAlign = 0;
+
+    if (fread(header, 1, 12, f) != 12 || memcmp(header, "RIFF", 4) || memcmp(header + 8, "WAVE", 4))
+    {
+        fprintf(stderr, "%s: not a RIFF/WAVE file\n", path);
+        fclose(f);
+        return false;
+    }
+
+    uint8_t chunk[8];
+
+    while (fread(chunk, 1, 8, f) == 8)
+    {
+        uint32_t size = _wav_le32(chunk + 4);
+
+        if (!memcmp(chunk, "fmt ", 4))
+        {
+            uint8_t fmt[40] = { 0 };
+
+            if (size < 16 || fread(fmt, 1, size < sizeof(fmt) ? size : sizeof(fmt), f) < 16)
+                break;
+
+            if (size > sizeof(fmt))
+                fseek(f, size - sizeof(fmt), SEEK_CUR);
+
+            uint32_t format = _wav_le16(fmt);
+
+            //extensible: the real format tag is the first 2 bytes of the subformat guid
+            if (format == WAV_FORMAT_EXTENSIBLE && size >= 26)
+                format = _wav_le16(fmt + 24);
+
+            wav->channels = (int)_wav_le16(fmt + 2);
+            wav->sampleRate = _wav_le32(fmt + 4);
+            blockAlign = (int)_wav_le16(fmt + 12);
+            wav->bits = (int)_wav_le16(fmt + 14);
+
+            if (format != WAV_FORMAT_PCM || (wav->bits != 16 && wav->bits != 24) ||
+                wav->channels < 1 || wav->channels > 2 || blockAlign != wav->channels * wav->bits / 8)
+            {
+                fprintf(stderr, "%s: only 16 or 24 bit integer PCM, mono or stereo is supported\n", path);
+                fclose(f);
+                return false;
+            }
+
+            haveFormat = true;
+        }
+        else if (!memcmp(chunk, "data", 4) && haveFormat)
+        {
+            uint8_t* data = (uint8_t*)malloc(size);
+            size = (uint32_t)fread(data, 1, size, f); //tolerate truncated files
+
+            wav->frames = size / blockAlign;
+            wav->samples = (int32_t*)malloc(sizeof(int32_t) * wav->frames * wav->channels);
+
+            int bytes = wav->bits / 8;
+
+            for (int64_t i = 0; i < wav->frames * wav->channels; ++i)
+            {
+                const uint8_t* p = data + i * bytes;
+
+                wav->samples[i] = bytes == 2
+                    ? (int16_t)_wav_le16(p)
+                    : (int32_t)((p[0] << 8) | (p[1] << 16) | ((uint32_t)p[2] << 24)) >> 8;
+            }
+
+            free(data);
+            fclose(f);
+
+            return true;
+        }
+        else
+            fseek(f, size + (size & 1), SEEK_CUR);
+    }
+
+    fprintf(stderr, "%s: no %s chunk\n", path, haveFormat ? "data" : "fmt");
+    fclose(f);
+
+    return false;
+}
+
+static inline void _wav_put16(FILE* f, uint32_t v) { uint8_t b[2] = { v, v >> 8 }; fwrite(b, 1, 2, f); }
+static inline void _wav_put32(FILE* f, uint32_t v) { uint8_t b[4] = { v, v >> 8, v >> 16, v >> 24 }; fwrite(b, 1, 4, f); }
+
+//writes interleaved 32 bit float samples, sizes are known upfront so the output can be a pipe
+static bool wav_write_float(const char* path, uint32_t sampleRate, int channels, int64_t frames, const float* samples)
+{
+    FILE* f = fopen(path, "wb");
+
+    if (!f)
+    {
+        fprintf(stderr, "can not write %s\n", path);
+        return false;
+    }
+
+    uint32_t dataSize = (uint32_t)(frames * channels * sizeof(float));
+
+    fwrite("RIFF", 1, 4, f);
+    _wav_put32(f, 36 + dataSize);
+    fwrite("WAVEfmt ", 1, 8, f);
+    _wav_put32(f, 16);
+    _wav_put16(f, WAV_FORMAT_FLOAT);
+    _wav_put16(f, channels);
+    _wav_put32(f, sampleRate);
+    _wav_put32(f, sampleRate * channels * sizeof(float));
+    _wav_put16(f, channels * sizeof(float));
+    _wav_put16(f, 32);
+    fwrite("data", 1, 4, f);
+    _wav_put32(f, dataSize);
+
+    //host is little endian like the format
+    bool ok = fwrite(samples, sizeof(float), frames * channels, f) == (size_t)(frames * channels);
+
+    if (fclose(f) || !ok)
+    {
+        fprintf(stderr, "can not write %s\n", path);
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,932 @@
+//offline renderer: runs a WAV file through the firmware conversion chain and writes what the speaker gets
+//
+//  wav_render [-v dB] [-L uH] [-C uF] [-R ohm] [-x] [-c] [-s seed] [-p hbridge.pio] [-T Hz] [-r rate] [-o out.wav] [in.wav]
+//
+//  pcm -> DSM_INT16/24_TO_INT32_UNITY -> gain.h -> limiter.h -> dsm_process_sample_x32/x16 -> hbridge.pio -> LC filter -> 32 bit float WAV
+//  input is 16/24 bit PCM, mono or stereo, 48 or 96 kHz like the USB descriptors offer
+//  -v      volume in dB as the UAC2 master volume control sets it, 0 .. -50, below -50 is mute
+//  -L -C -R output filter and load, default is the README filter (5.6 uH, 2.2 uF) into 4 ohm; -L 0 is the plain bridge output
+//  -x      clocks the cycle-accurate PIO model instead of the per-symbol table derived from it (much slower)
+//  -c      renders both ways and fails if they differ
+//  -T      renders 1 s of a -6 dBFS 24 bit sine at that frequency instead of reading a file, -r sets its rate
+//
+//  the output is band-limited to the input rate and delay-compensated except for the LC filter group delay.
+//  The bridge is ideal: +-1 is the supply across the load, dead time and floating states count as 0 V
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "dsm.h" //built with DSM_INTEGRATOR_METRICS, see CMakeLists.txt
+#include "dacamp.h"
+#include "gain.h"
+#include "limiter.h"
+
+#include "analysis.h"
+#include "hbridge_model.h"
+#include "wav_io.h"
+
+#define RENDER_MAX_PULSE_CLOCKS     64
+#define RENDER_START                3       //previous symbol of the first window: y is ~0 after hbridge_program_start
+#define RENDER_LEAD_CLOCKS          2       //mov y, ~null and out isr, 32 run before the first symbol
+#define RENDER_TRAINING_SYMBOLS     4096
+#define RENDER_FIR2_RATIO           4       //the first stage decimates to 4x the output rate, the second one to the output rate
+#define RENDER_FIR1_DELAY_FRAMES    2       //taps are 2 * delay frames worth of input + 1
+#define RENDER_FIR2_DELAY_FRAMES    64
+#define RENDER_FIR_DELAY_FRAMES     (RENDER_FIR1_DELAY_FRAMES + RENDER_FIR2_DELAY_FRAMES)
+#define RENDER_FIR1_CUTOFF          0.25    //of the first stage output rate, only has to keep images above 3.5x the output rate away
+#define RENDER_FIR2_CUTOFF          0.455   //of the output rate
+#define RENDER_CHECK_TOLERANCE      1e-6
+
+//bridge output over one symbol window, which only depends on the previous and the current symbol
+typedef struct render_pair
+{
+    bool seen;
+    uint8_t pins[RENDER_MAX_PULSE_CLOCKS];
+
+    int area;               //sum of the per-clock levels
+    double drive[2];        //LC state response to this window starting from rest
+    uint32_t transitions, hiZClocks;
+    uint32_t gateToggles[HBRIDGE_GATE_COUNT];
+} render_pair_t;
+
+typedef struct render_bridge
+{
+    const hbridge_program_model_t* program;
+    int pulseClocks;
+
+    render_pair_t pair[4][4];   //[previous symbol or RENDER_START][symbol]
+    uint8_t endPins[4];         //pins at the end of a window, only depend on its symbol
+    bool endSeen[4];
+
+    //LC filter state is {inductor current, capacitor voltage}, supply voltage is 1
+    bool ideal;
+    double phi[2][2], gamma[2]; //one PIO clock
+    double phiWindow[2][2];     //one symbol
+} render_bridge_t;
+
+typedef struct render_source
+{
+    const int32_t* pcm;         //DSM input of one channel, scaled and with volume applied
+    int64_t frames, pos;
+    bool sampleRate96k;
+    uint32_t random;
+    dsm_t dsm;
+
+    uint64_t word;
+    int symbolsLeft;
+} render_source_t;
+
+typedef struct render_fir
+{
+    int ratio, taps, phase, pos;
+    float* h;
+    float* history;             //written twice so the newest `taps` samples are always contiguous
+} render_fir_t;
+
+typedef struct render_decimator
+{
+    render_fir_t stage[2];
+
+    float* out;                 //interleaved output
+    int channels;
+    int64_t skip, count, capacity;
+} render_decimator_t;
+
+typedef struct render_stats
+{
+    uint64_t clocks;
+    uint64_t symbols[4];        //indexed by symbol, 0b11 is never emitted
+    uint64_t transitions, hiZClocks;
+    uint64_t gateToggles[HBRIDGE_GATE_COUNT];
+} render_stats_t;
+
+static inline uint32_t xorshift32(uint32_t x)
+{
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return x;
+}
+
+//--------------------------------------------------------------------+
+// LC filter
+//--------------------------------------------------------------------+
+
+static void matrix_mul(const double a[2][2], const double b[2][2], double out[2][2])
+{
+    double r[2][2];
+
+    for (int i = 0; i < 2; ++i)
+        for (int j = 0; j < 2; ++j)
+            r[i][j] = a[i][0] * b[0][j] + a[i][1] * b[1][j];
+
+    memcpy(out, r, sizeof(r));
+}
+
+static inline void lc_step(const double phi[2][2], const double* in, double* x)
+{
+    double x0 = phi[0][0] * x[0] + phi[0][1] * x[1] + in[0];
+    double x1 = phi[1][0] * x[0] + phi[1][1] * x[1] + in[1];
+
+    x[0] = x0;
+    x[1] = x1;
+}
+
+//  series L into C with the load across C:
+// di/dt = (u - v)/L, dv/dt = (i - v/R)/C, exact zero-order hold discretization for one PIO clock
+static void lc_init(render_bridge_t* bridge, double inductance, double capacitance, double resistance)
+{
+    bridge->ideal = inductance <= 0;
+
+    if (bridge->ideal)
+        return;
+
+    double t = 1.0 / HBRIDGE_MODEL_PIO_CLOCK;
+    double a[2][2] = { { 0, -t / inductance }, { t / capacitance, -t / (resistance * capacitance) } };
+
+    double term[2][2] = { { 1, 0 }, { 0, 1 } };
+    double sum[2][2] = { { 1, 0 }, { 0, 1 } };      //sum of a^n/(n+1)!
+
+    memcpy(bridge->phi, term, sizeof(term));
+
+    for (int n = 1; n < 30; ++n)
+    {
+        matrix_mul(term, a, term);
+
+        for (int i = 0; i < 2; ++i)
+            for (int j = 0; j < 2; ++j)
+            {
+                term[i][j] /= n;
+                bridge->phi[i][j] += term[i][j];
+                sum[i][j] += term[i][j] / (n + 1);
+            }
+    }
+
+    bridge->gamma[0] = sum[0][0] * t / inductance;
+    bridge->gamma[1] = sum[1][0] * t / inductance;
+
+    memcpy(bridge->phiWindow, bridge->phi, sizeof(bridge->phi));
+
+    for (int i = 1; i < bridge->pulseClocks; ++i)
+        matrix_mul(bridge->phiWindow, bridge->phi, bridge->phiWindow);
+}
+
+//--------------------------------------------------------------------+
+// per-symbol table, recorded from the PIO model
+//--------------------------------------------------------------------+
+
+static void count_window(render_pair_t* pair, uint8_t prevPins, int pulseClocks)
+{
+    static const uint8_t gates[HBRIDGE_GATE_COUNT] = {
+        HBRIDGE_PIN_LOW_MINUS, HBRIDGE_PIN_HIGH_PLUS, HBRIDGE_PIN_LOW_PLUS, HBRIDGE_PIN_HIGH_MINUS
+    };
+
+    int prevLevel = hbridge_pins_level(prevPins);
+
+    for (int c = 0; c < pulseClocks; ++c)
+    {
+        uint8_t pins = pair->pins[c];
+        int level = hbridge_pins_level(pins);
+
+        for (int g = 0; g < HBRIDGE_GATE_COUNT; ++g)
+            if (!(prevPins & gates[g]) != !(pins & gates[g]))
+                ++pair->gateToggles[g];
+
+        if (!(pins & (HBRIDGE_PIN_HIGH_PLUS | HBRIDGE_PIN_LOW_PLUS)) ||
+            !(pins & (HBRIDGE_PIN_HIGH_MINUS | HBRIDGE_PIN_LOW_MINUS)))
+            ++pair->hiZClocks;
+
+        if (level != prevLevel)
+            ++pair->transitions;
+
+        pair->area += level;
+        prevPins = pins;
+        prevLevel = level;
+    }
+}
+
+//  runs the model over random symbol sequences and records every window,
+// fails if a window turns out to depend on more than the previous symbol
+static bool bridge_build_table(render_bridge_t* bridge)
+{
+    int pulseClocks = bridge->pulseClocks;
+    int symbolCount = RENDER_TRAINING_SYMBOLS + 16 * (HBRIDGE_MODEL_FIFO_DEPTH + 2);
+
+    uint8_t* symbols = (uint8_t*)malloc(symbolCount);
+    uint32_t random = 0x2545F491;
+
+    for (int first = 0; first < 3; ++first)
+    {
+        for (int k = 0; k < symbolCount; ++k)
+        {
+            random = xorshift32(random);
+            symbols[k] = k ? random % 3 : first;
+        }
+
+        hbridge_model_t model;
+        hbridge_model_start(&model, bridge->program);
+
+        int wordsPut = 0;
+        uint8_t prevPins = 0;
+
+        for (int c = 0; c < RENDER_LEAD_CLOCKS + RENDER_TRAINING_SYMBOLS * pulseClocks; ++c)
+        {
+            while (!hbridge_model_fifo_full(&model))
+            {
+                uint32_t word = 0;
+
+                for (int s = 0; s < 16; ++s)
+                    word = (word << 2) | symbols[wordsPut * 16 + s];
+
+                hbridge_model_put(&model, word);
+                ++wordsPut;
+            }
+
+            uint8_t pins = hbridge_model_clock(&model);
+
+            if (c < RENDER_LEAD_CLOCKS)
+            {
+                prevPins = pins;
+                continue;
+            }
+
+            int k = (c - RENDER_LEAD_CLOCKS) / pulseClocks;
+            int offset = (c - RENDER_LEAD_CLOCKS) % pulseClocks;
+
+            int prev = k ? symbols[k - 1] : RENDER_START;
+            render_pair_t* pair = &bridge->pair[prev][symbols[k]];
+
+            if (!pair->seen)
+                pair->pins[offset] = pins;
+            else if (pair->pins[offset] != pins)
+            {
+                fprintf(stderr, "hbridge.pio output depends on more than the previous symbol, only -x is exact\n");
+                free(symbols);
+                return false;
+            }
+
+            if (offset == pulseClocks - 1)
+            {
+                pair->seen = true;
+
+                if (bridge->endSeen[symbols[k]] && bridge->endPins[symbols[k]] != pins)
+                {
+                    fprintf(stderr, "hbridge.pio window end state depends on more than the symbol, only -x is exact\n");
+                    free(symbols);
+                    return false;
+                }
+
+                bridge->endPins[symbols[k]] = pins;
+                bridge->endSeen[symbols[k]] = true;
+            }
+        }
+
+        if (model.stats.stallClocks)
+        {
+            fprintf(stderr, "hbridge.pio model stalled while recording the symbol table\n");
+            free(symbols);
+            return false;
+        }
+
+        //pins before the first window
+        bridge->endPins[RENDER_START] = prevPins;
+        bridge->endSeen[RENDER_START] = true;
+    }
+
+    free(symbols);
+
+    //prev 0b11 is RENDER_START
+    for (int prev = 0; prev < 4; ++prev)
+        for (int symbol = 0; symbol < 3; ++symbol)
+        {
+            render_pair_t* pair = &bridge->pair[prev][symbol];
+
+            if (!pair->seen)
+            {
+                fprintf(stderr, "symbol table incomplete: %d after %d never seen\n", symbol, prev);
+                return false;
+            }
+
+            count_window(pair, bridge->endPins[prev], pulseClocks);
+
+            if (!bridge->ideal)
+                for (int c = 0; c < pulseClocks; ++c)
+                {
+                    double u = hbridge_pins_level(pair->pins[c]);
+                    double in[2] = { bridge->gamma[0] * u, bridge->gamma[1] * u };
+
+                    lc_step(bridge->phi, in, pair->drive);
+                }
+        }
+
+    return true;
+}
+
+//--------------------------------------------------------------------+
+// modulator input
+//--------------------------------------------------------------------+
+
+static inline int32_t source_pcm(render_source_t* src)
+{
+    int64_t pos = src->pos++;
+
+    return pos < src->frames ? src->pcm[pos] : 0;
+}
+
+static uint64_t source_next_word(render_source_t* src)
+{
+    src->random = xorshift32(src->random);
+
+    if (src->sampleRate96k)
+    {
+        int32_t first = source_pcm(src);
+        return dsm_process_sample_x16(&src->dsm, first, source_pcm(src), src->random);
+    }
+
+    return dsm_process_sample_x32(&src->dsm, source_pcm(src), src->random);
+}
+
+static inline uint32_t source_next_symbol(render_source_t* src)
+{
+    if (!src->symbolsLeft)
+    {
+        src->word = source_next_word(src);
+        src->symbolsLeft = 32;
+    }
+
+    --src->symbolsLeft;
+
+    return (uint32_t)(src->word >> (2 * src->symbolsLeft)) & 0b11;
+}
+
+//same steps as dacamp_pcm_put for one channel
+static void convert_channel(const wav_pcm_t* wav, int channel, double volumeDb, int32_t* out)
+{
+    //fixed volume, the ramp of dacamp_pcm_put has nothing to do
+    int32_t gain = gain_from_uac2((int32_t)lrint(volumeDb * DACAMP_VOLUME_PER_DB_UAC2), false);
+
+    int inChannel = channel < wav->channels ? channel : 0;
+
+    for (int64_t i = 0; i < wav->frames; ++i)
+    {
+        int32_t pcm = wav->samples[i * wav->channels + inChannel];
+        int32_t sample = wav->bits == 16 ? DSM_INT16_TO_INT32_UNITY(pcm) : DSM_INT24_TO_INT32_UNITY(pcm);
+
+        out[i] = gain_apply(sample, gain);
+    }
+}
+
+//limiter.h over both channels with the 1 ms of dacamp_pcm_put, its delay taken out again
+static uint32_t limit_channels(const wav_pcm_t* wav, int32_t* dsmPcm[2])
+{
+    limiter_t limiter;
+    limiter_init(&limiter, wav->sampleRate / 1000);
+
+    for (int64_t i = 0; i < wav->frames + limiter.lookahead; ++i)
+    {
+        uint64_t frame = i < wav->frames ? PCM_DSM_FRAME(dsmPcm[0][i], dsmPcm[1][i]) : 0;
+
+        limiter_process(&limiter, &frame, 1);
+
+        if (i >= limiter.lookahead)
+        {
+            dsmPcm[0][i - limiter.lookahead] = PCM_DSM_LEFT(frame);
+            dsmPcm[1][i - limiter.lookahead] = PCM_DSM_RIGHT(frame);
+        }
+    }
+
+    return limiter.overs;
+}
+
+//--------------------------------------------------------------------+
+// symbol rate to output rate
+//--------------------------------------------------------------------+
+
+//blackman-harris windowed sinc, cutoff relative to the input rate
+static void fir_init(render_fir_t* fir, int ratio, int taps, double cutoff)
+{
+    memset(fir, 0, sizeof(*fir));
+
+    fir->ratio = ratio;
+    fir->taps = taps;
+    fir->h = (float*)malloc(sizeof(float) * taps);
+    fir->history = (float*)calloc(2 * taps, sizeof(float));
+
+    double center = (taps - 1) / 2.0;
+    double sum = 0;
+
+    double* h = (double*)malloc(sizeof(double) * taps);
+
+    for (int i = 0; i < taps; ++i)
+    {
+        double t = i - center;
+        double x = 2 * ANALYSIS_PI * i / (taps - 1);
+        double w = 0.35875 - 0.48829 * cos(x) + 0.14128 * cos(2 * x) - 0.01168 * cos(3 * x);
+
+        h[i] = (t == 0 ? 2 * cutoff : sin(2 * ANALYSIS_PI * cutoff * t) / (ANALYSIS_PI * t)) * w;
+        sum += h[i];
+    }
+
+    for (int i = 0; i < taps; ++i)
+        fir->h[i] = (float)(h[i] / sum);
+
+    free(h);
+}
+
+//returns true every `ratio` inputs with the filtered value in out
+static inline bool fir_push(render_fir_t* fir, float value, float* out)
+{
+    fir->history[fir->pos] = fir->history[fir->pos + fir->taps] = value;
+
+    if (++fir->pos == fir->taps)
+        fir->pos = 0;
+
+    if (++fir->phase < fir->ratio)
+        return false;
+
+    fir->phase = 0;
+
+    //symmetric taps, so the oldest-first order of the history does not matter
+    const float* x = fir->history + fir->pos;
+    float acc[8] = { 0 };
+    int i = 0;
+
+    for (; i + 8 <= fir->taps; i += 8)
+        for (int j = 0; j < 8; ++j)
+            acc[j] += fir->h[i + j] * x[i + j];
+
+    for (; i < fir->taps; ++i)
+        acc[0] += fir->h[i] * x[i];
+
+    *out = ((acc[0] + acc[1]) + (acc[2] + acc[3])) + ((acc[4] + acc[5]) + (acc[6] + acc[7]));
+
+    return true;
+}
+
+//symbol rate to output rate in two stages, a single sharp filter at the symbol rate costs ~4x more
+static void decimator_init(render_decimator_t* dec, int ratio, float* out, int channels, int64_t frames)
+{
+    memset(dec, 0, sizeof(*dec));
+
+    int ratio1 = ratio / RENDER_FIR2_RATIO;
+
+    fir_init(&dec->stage[0], ratio1, 2 * RENDER_FIR1_DELAY_FRAMES * ratio + 1, RENDER_FIR1_CUTOFF / ratio1);
+    fir_init(&dec->stage[1], RENDER_FIR2_RATIO, 2 * RENDER_FIR2_DELAY_FRAMES * RENDER_FIR2_RATIO + 1,
+        RENDER_FIR2_CUTOFF / RENDER_FIR2_RATIO);
+
+    dec->out = out;
+    dec->channels = channels;
+    dec->skip = RENDER_FIR_DELAY_FRAMES;
+    dec->capacity = frames;
+}
+
+static void decimator_free(render_decimator_t* dec)
+{
+    for (int i = 0; i < 2; ++i)
+    {
+        free(dec->stage[i].h);
+        free(dec->stage[i].history);
+    }
+}
+
+static inline void decimator_push(render_decimator_t* dec, int channel, double value)
+{
+    float mid, out;
+
+    if (!fir_push(&dec->stage[0], (float)value, &mid) || !fir_push(&dec->stage[1], mid, &out))
+        return;
+
+    if (dec->skip)
+        --dec->skip;
+    else if (dec->count < dec->capacity)
+        dec->out[dec->count++ * dec->channels + channel] = out;
+}
+
+//--------------------------------------------------------------------+
+// rendering
+//--------------------------------------------------------------------+
+
+static void render_table(const render_bridge_t* bridge, render_source_t* src, int64_t symbols,
+    render_decimator_t* dec, int channel, render_stats_t* stats)
+{
+    double x[2] = { 0, 0 };
+    uint32_t prev = RENDER_START;
+
+    //pins are all off before the first symbol
+    stats->clocks = RENDER_LEAD_CLOCKS;
+    stats->hiZClocks = RENDER_LEAD_CLOCKS;
+
+    for (int64_t k = 0; k < symbols; ++k)
+    {
+        uint32_t symbol = source_next_symbol(src);
+        const render_pair_t* pair = &bridge->pair[prev][symbol];
+
+        double y;
+
+        if (bridge->ideal)
+            y = (double)pair->area / bridge->pulseClocks;
+        else
+        {
+            lc_step(bridge->phiWindow, pair->drive, x);
+            y = x[1];
+        }
+
+        decimator_push(dec, channel, y);
+
+        ++stats->symbols[symbol];
+        stats->transitions += pair->transitions;
+        stats->hiZClocks += pair->hiZClocks;
+
+        for (int g = 0; g < HBRIDGE_GATE_COUNT; ++g)
+            stats->gateToggles[g] += pair->gateToggles[g];
+
+        prev = symbol;
+    }
+
+    stats->clocks += symbols * bridge->pulseClocks;
+}
+
+static void render_exact(const render_bridge_t* bridge, render_source_t* src, int64_t symbols,
+    render_decimator_t* dec, int channel, render_stats_t* stats)
+{
+    hbridge_model_t model;
+    hbridge_model_start(&model, bridge->program);
+
+    double x[2] = { 0, 0 };
+    int pendingHalves = 0;
+    uint64_t pendingWord = 0;
+
+    //symbols queued in the fifo, counted when their window is played
+    uint8_t queue[256];
+    uint8_t queueHead = 0, queueTail = 0;
+
+    int64_t clocks = RENDER_LEAD_CLOCKS + symbols * bridge->pulseClocks;
+    int area = 0;
+
+    for (int64_t c = 0; c < clocks; ++c)
+    {
+        while (!hbridge_model_fifo_full(&model))
+        {
+            //same order as core1_worker: high word first
+            if (!pendingHalves)
+            {
+                pendingWord = source_next_word(src);
+                pendingHalves = 2;
+
+                for (int s = 0; s < 32; ++s)
+                    queue[queueTail++] = (uint8_t)((pendingWord >> (62 - 2 * s)) & 0b11);
+            }
+
+            hbridge_model_put(&model, (uint32_t)(pendingWord >> (pendingHalves == 2 ? 32 : 0)));
+            --pendingHalves;
+        }
+
+        int level = hbridge_pins_level(hbridge_model_clock(&model));
+
+        if (c < RENDER_LEAD_CLOCKS)
+            continue;
+
+        if (!bridge->ideal)
+        {
+            double in[2] = { bridge->gamma[0] * level, bridge->gamma[1] * level };
+            lc_step(bridge->phi, in, x);
+        }
+
+        area += level;
+
+        if ((c - RENDER_LEAD_CLOCKS) % bridge->pulseClocks == bridge->pulseClocks - 1)
+        {
+            decimator_push(dec, channel, bridge->ideal ? (double)area / bridge->pulseClocks : x[1]);
+            ++stats->symbols[queue[queueHead++]];
+            area = 0;
+        }
+    }
+
+    stats->clocks = model.stats.clocks;
+    stats->transitions = model.stats.outputTransitions;
+    stats->hiZClocks = model.stats.hiZClocks;
+
+    for (int g = 0; g < HBRIDGE_GATE_COUNT; ++g)
+        stats->gateToggles[g] = model.stats.gateToggles[g];
+}
+
+//--------------------------------------------------------------------+
+// main
+//--------------------------------------------------------------------+
+
+static void make_tone(wav_pcm_t* wav, double freq, uint32_t sampleRate)
+{
+    wav->sampleRate = sampleRate;
+    wav->bits = 24;
+    wav->channels = 2;
+    wav->frames = sampleRate;
+    wav->samples = (int32_t*)malloc(sizeof(int32_t) * 2 * wav->frames);
+
+    for (int64_t i = 0; i < wav->frames; ++i)
+        wav->samples[2 * i] = wav->samples[2 * i + 1] =
+            (int32_t)lrint(0.5 * sin(2 * ANALYSIS_PI * freq * i / sampleRate) * 8388607);
+}
+
+static double seconds_since(const struct timespec* start)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (now.tv_sec - start->tv_sec) + (now.tv_nsec - start->tv_nsec) * 1e-9;
+}
+
+typedef struct render_job
+{
+    const render_bridge_t* bridge;
+    const wav_pcm_t* wav;
+    const int32_t* dsmPcm;
+    uint32_t seed;
+    bool exact;
+    int channel;
+
+    float* out;
+    render_stats_t stats;
+    dsm_t dsm;
+} render_job_t;
+
+static void* render_channel(void* arg)
+{
+    render_job_t* job = (render_job_t*)arg;
+
+    bool sampleRate96k = job->wav->sampleRate == 96000;
+    int symbolsPerFrame = sampleRate96k ? 16 : 32;
+    int64_t symbols = (job->wav->frames + RENDER_FIR_DELAY_FRAMES) * symbolsPerFrame;
+
+    render_source_t src = {
+        .pcm = job->dsmPcm,
+        .frames = job->wav->frames,
+        .sampleRate96k = sampleRate96k,
+        .random = job->seed + 0x9E3779B9 * job->channel,
+    };
+
+    dsm_init(&src.dsm);
+
+    render_decimator_t dec;
+    decimator_init(&dec, symbolsPerFrame, job->out, 2, job->wav->frames);
+
+    memset(&job->stats, 0, sizeof(job->stats));
+
+    if (job->exact)
+        render_exact(job->bridge, &src, symbols, &dec, job->channel, &job->stats);
+    else
+        render_table(job->bridge, &src, symbols, &dec, job->channel, &job->stats);
+
+    decimator_free(&dec);
+
+    job->dsm = src.dsm;
+
+    return NULL;
+}
+
+//renders the channels on their own threads, returns seconds spent
+static double render(const render_bridge_t* bridge, const wav_pcm_t* wav, int32_t* const* dsmPcm, uint32_t seed, bool exact,
+    float* out, render_job_t* jobs)
+{
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    pthread_t threads[2];
+
+    for (int ch = 0; ch < 2; ++ch)
+    {
+        jobs[ch] = (render_job_t){
+            .bridge = bridge,
+            .wav = wav,
+            .dsmPcm = dsmPcm[ch],
+            .seed = seed,
+            .exact = exact,
+            .channel = ch,
+            .out = out,
+        };
+
+        pthread_create(&threads[ch], NULL, render_channel, &jobs[ch]);
+    }
+
+    for (int ch = 0; ch < 2; ++ch)
+        pthread_join(threads[ch], NULL);
+
+    return seconds_since(&start);
+}
+
+static void report_channel(const char* name, const wav_pcm_t* wav, int ch, const float* out,
+    const render_stats_t* stats, const dsm_t* dsm)
+{
+    double inPeak = 0, outPeak = 0, outSquares = 0;
+    int inChannel = ch < wav->channels ? ch : 0;
+    double inScale = wav->bits == 16 ? 32768.0 : 8388608.0;
+
+    for (int64_t i = 0; i < wav->frames; ++i)
+    {
+        double in = fabs(wav->samples[i * wav->channels + inChannel] / inScale);
+        double o = out[2 * i + ch];
+
+        if (in > inPeak)
+            inPeak = in;
+
+        if (fabs(o) > outPeak)
+            outPeak = fabs(o);
+
+        outSquares += o * o;
+    }
+
+    double seconds = stats->clocks / (double)HBRIDGE_MODEL_PIO_CLOCK;
+    uint64_t symbolCount = stats->symbols[0] + stats->symbols[1] + stats->symbols[2];
+
+    printf("%s: input peak %.2f dBFS, output peak %.2f dBFS, rms %.2f dBFS\n", name,
+        analysis_db(inPeak * inPeak), analysis_db(outPeak * outPeak), analysis_db(outSquares / (wav->frames ? wav->frames : 1)));
+    printf("    symbols: %.2f%% +, %.2f%% -, %.2f%% zero\n",
+        100.0 * stats->symbols[0b01] / symbolCount, 100.0 * stats->symbols[0b10] / symbolCount,
+        100.0 * stats->symbols[0b00] / symbolCount);
+    printf("    output transitions %.0f /s, gate toggles L- %.0f H+ %.0f L+ %.0f H- %.0f /s, hi-Z %.2f%%\n",
+        stats->transitions / seconds,
+        stats->gateToggles[0] / seconds, stats->gateToggles[1] / seconds,
+        stats->gateToggles[2] / seconds, stats->gateToggles[3] / seconds,
+        100.0 * stats->hiZClocks / stats->clocks);
+    printf("    integrators min/max:");
+
+    for (int i = 0; i < 4; ++i)
+        printf(" [%d, %d]", dsm->integratorMin[i], dsm->integratorMax[i]);
+
+    printf("  quantizer: [%d, %d]\n", dsm->quantizerMin, dsm->quantizerMax);
+}
+
+int main(int argc, char** argv)
+{
+    const char* pioPath = HBRIDGE_PIO_PATH;
+    const char* outPath = NULL;
+    double volumeDb = 0, toneFreq = 0;
+    double inductance = 5.6, capacitance = 2.2, resistance = 4;
+    uint32_t toneRate = 48000, seed = 0xC0FFEE;
+    bool exact = false, check = false;
+
+    int opt;
+
+    while ((opt = getopt(argc, argv, "v:L:C:R:xcs:p:T:r:o:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'v': volumeDb = atof(optarg); break;
+            case 'L': inductance = atof(optarg); break;
+            case 'C': capacitance = atof(optarg); break;
+            case 'R': resistance = atof(optarg); break;
+            case 'x': exact = true; break;
+            case 'c': check = true; break;
+            case 's': seed = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'p': pioPath = optarg; break;
+            case 'T': toneFreq = atof(optarg); break;
+            case 'r': toneRate = (uint32_t)atoi(optarg); break;
+            case 'o': outPath = optarg; break;
+            default:
+                fprintf(stderr, "usage: %s [-v dB] [-L uH] [-C uF] [-R ohm] [-x] [-c] [-s seed] [-p hbridge.pio] "
+                    "[-T Hz] [-r rate] [-o out.wav] [in.wav]\n", argv[0]);
+                return 2;
+        }
+    }
+
+    wav_pcm_t wav;
+
+    if (toneFreq > 0)
+        make_tone(&wav, toneFreq, toneRate);
+    else if (optind < argc)
+    {
+        if (!wav_read_pcm(argv[optind], &wav))
+            return 2;
+    }
+    else
+    {
+        fprintf(stderr, "no input, give a WAV file or -T\n");
+        return 2;
+    }
+
+    if (wav.sampleRate != 48000 && wav.sampleRate != 96000)
+    {
+        fprintf(stderr, "%u Hz: the firmware only runs at 48 or 96 kHz\n", wav.sampleRate);
+        return 2;
+    }
+
+    if (volumeDb > 0)
+        volumeDb = 0;
+
+    if (resistance <= 0 || (inductance > 0 && capacitance <= 0))
+    {
+        fprintf(stderr, "need a positive load and capacitance\n");
+        return 2;
+    }
+
+    hbridge_program_model_t program;
+
+    if (!hbridge_program_load(&program, pioPath))
+        return 2;
+
+    render_bridge_t* bridge = (render_bridge_t*)calloc(1, sizeof(render_bridge_t));
+    bridge->program = &program;
+    bridge->pulseClocks = hbridge_program_define(&program, "T_PULSE_CLOCKS", 25);
+
+    if (bridge->pulseClocks > RENDER_MAX_PULSE_CLOCKS)
+    {
+        fprintf(stderr, "T_PULSE_CLOCKS %d is too long\n", bridge->pulseClocks);
+        return 2;
+    }
+
+    lc_init(bridge, inductance * 1e-6, capacitance * 1e-6, resistance);
+
+    if (!bridge_build_table(bridge) && !exact)
+        return 2;
+
+    int32_t* dsmPcm[2];
+
+    for (int ch = 0; ch < 2; ++ch)
+    {
+        dsmPcm[ch] = (int32_t*)malloc(sizeof(int32_t) * (wav.frames ? wav.frames : 1));
+        convert_channel(&wav, ch, volumeDb, dsmPcm[ch]);
+    }
+
+    uint32_t overs = limit_channels(&wav, dsmPcm);
+
+    float* out = (float*)calloc(2 * (wav.frames ? wav.frames : 1), sizeof(float));
+    render_job_t jobs[2];
+
+    double audioSeconds = (double)wav.frames / wav.sampleRate;
+    double renderSeconds = render(bridge, &wav, dsmPcm, seed, exact, out, jobs);
+
+    printf("input: %s, %d bit %s %u Hz, %.2f s, volume %.1f dB, %u frames limited\n",
+        toneFreq > 0 ? "test tone" : argv[optind], wav.bits, wav.channels == 1 ? "mono" : "stereo",
+        wav.sampleRate, audioSeconds, volumeDb, overs);
+
+    if (bridge->ideal)
+        printf("output: bridge average per symbol, no LC filter\n");
+    else
+        printf("output: LC %.2f uH / %.2f uF into %.1f ohm, f0 %.1f kHz, Q %.2f\n", inductance, capacitance, resistance,
+            1e-3 / (2 * ANALYSIS_PI * sqrt(inductance * capacitance * 1e-12)), resistance * sqrt(capacitance / inductance));
+
+    printf("rendered with the %s in %.2f s, %.1fx realtime\n",
+        exact ? "cycle-accurate PIO model" : "symbol table from the PIO model", renderSeconds, audioSeconds / renderSeconds);
+
+    for (int ch = 0; ch < 2; ++ch)
+        report_channel(ch ? "right" : "left", &wav, ch, out, &jobs[ch].stats, &jobs[ch].dsm);
+
+    int ret = 0;
+
+    if (check)
+    {
+        float* other = (float*)calloc(2 * (wav.frames ? wav.frames : 1), sizeof(float));
+        render_job_t otherJobs[2];
+
+        double otherSeconds = render(bridge, &wav, dsmPcm, seed, !exact, other, otherJobs);
+        double maxDiff = 0;
+
+        for (int64_t i = 0; i < 2 * wav.frames; ++i)
+            if (fabs(out[i] - other[i]) > maxDiff)
+                maxDiff = fabs(out[i] - other[i]);
+
+        bool statsMatch = true;
+
+        for (int ch = 0; ch < 2; ++ch)
+        {
+            const render_stats_t *a = &jobs[ch].stats, *b = &otherJobs[ch].stats;
+
+            statsMatch &= a->clocks == b->clocks &&
+                a->transitions == b->transitions &&
+                a->hiZClocks == b->hiZClocks &&
+                !memcmp(a->symbols, b->symbols, sizeof(a->symbols)) &&
+                !memcmp(a->gateToggles, b->gateToggles, sizeof(a->gateToggles));
+        }
+
+        printf("check against the %s (%.2f s): max difference %.3g, stats %s\n",
+            exact ? "symbol table" : "cycle-accurate model", otherSeconds, maxDiff, statsMatch ? "match" : "differ");
+
+        if (maxDiff > RENDER_CHECK_TOLERANCE || !statsMatch)
+        {
+            printf("CHECK FAILED\n");
+            ret = 1;
+        }
+        else
+            printf("check ok\n");
+
+        free(other);
+    }
+
+    if (outPath)
+    {
+        if (!wav_write_float(outPath, wav.sampleRate, 2, wav.frames, out))
+            ret = 2;
+    }
+
+    free(out);
+    free(dsmPcm[0]);
+    free(dsmPcm[1]);
+    free(wav.samples);
+    free(bridge);
+
+    return ret;
+}
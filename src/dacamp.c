@@ -4,14 +4,19 @@
 #include <string.h>
 #include "pico/stdlib.h"
 #include "pico/multicore.h"
-#include "pico/sync.h"
 #include "pico/platform.h"
 #include "hardware/watchdog.h"
+#include "hardware/sync.h"
 
-#include "ringbuf.h"
+#include "spscring.h"
 #include "dsm.h"
-#include "volumeLut.h"
+#include "pcmConvert.h"
+#include "halfband.h"
+#include "limiter.h"
+#include "feedback.h"
 #include "roscRandom.h"
+#include "dither.h"
+#include "pioDmaRing.h"
 
 //  undefine to process and init only one channel; 
 // has to be before the inclusion of "hbridge.pio.h"
@@ -59,39 +64,118 @@
 #define HBRIDGE_LEFT_START_PIN  6 // PIO takes first pin and assumes other pins are in succession
 #define HBRIDGE_RIGHT_START_PIN 14
 
-#define PIO_TX_FIFO_DEPTH 8
-#define PIO_RING_BUFFER_DEPTH 32 //allow buffering of up to N processed pio samples, should be at least PIO_TX_FIFO_DEPTH in size
+//  per state machine DMA ring of 32 bit PIO words, two per output word, power of two.
+// core1 keeps up to pioFillWords output words in it (the latency profile, at most PIO_DMA_FILL_WORDS, 2.5 ms),
+// DMA keeps the TX FIFO full
+#define PIO_DMA_RING_WORDS 256
+#define PIO_DMA_FILL_WORDS (PIO_DMA_RING_WORDS / 2 - DSM_BLOCK_LENGTH) //a full ring would read as an empty one, keep some slack
 
-#define PCM_RING_BUFFER_DEPTH 2048
+#define PCM_RING_BUFFER_DEPTH 4096 //power of two, see spscring.h. 42 ms of 96 kHz slots, the SAFE profile needs 40
 
-#define PCM_TO_DSM_PCM_BUFFER_LENGTH 256
+//  output words per channel modulated in one go: one ring access, one dither fetch and one call per channel for the block.
+// also the low mark of the DMA rings, below it core1 repeats the last frame instead of waiting for pcm
+#define DSM_BLOCK_LENGTH 8
+
+#define DACAMP_DITHER_MODE DITHER_RECTANGULAR //see dither.h
+
+//  48 kHz streams go through halfband.h on core0 and reach core1 as 96 kHz,
+// comment out to have the modulator interpolate 48 kHz linearly by itself
+#define DACAMP_HALFBAND_48K
+
+#define DACAMP_DSM_ORDER 4 //2..DSM_MAX_ORDER, see dsm.h and dacamp_set_dsm_order
+
+//  dsm_set_transition_penalty, 0 is off. _DSM_INT_MAX / 8 takes ~24% of the bridge state changes away for ~1 dB of SNR
+// (dsm_bench -t 12.5), but order 4 then runs the C loop instead of dsm_m0.S
+#define DACAMP_DSM_TRANSITION_PENALTY 0
+
+//  dsm_set_lookahead depth, 0 is off. depth 2 gets ~0.25 dB more stable input range for ~2 dB of SNR at >10x the
+// cycles (dsm_bench -l 2), core1 cannot afford it at any depth, it is here to be measured
+#define DACAMP_DSM_LOOKAHEAD 0
+
+#define DACAMP_LATENCY_PROFILE DACAMP_LATENCY_NORMAL //see dacamp_set_latency_profile
+
+//  all pcmRing levels in us of audio.
+// target: what the feedback endpoint asks the host to keep, see feedback.h
+// start: what core1 waits for after start and flush before filling the DMA rings, so the level settles near the target
+// max: above it dacamp_pcm_put rejects frames, a host ignoring the feedback cannot queue more latency than this
+typedef struct dacamp_latency_profile
+{
+    int targetUs;
+    int startUs;
+    int maxUs;
+    int pioFillWords;   //output words, 48 kHz
+} dacamp_latency_profile_t;
+
+//the pcm level steps by a whole 1 ms packet, targets are at least that. start is about the target plus the DMA fill
+static const dacamp_latency_profile_t dacampLatencyProfiles[DACAMP_LATENCY_COUNT] =
+{
+    [DACAMP_LATENCY_LOW]    = { .targetUs = 1000,  .startUs = 1500,  .maxUs = 3000,  .pioFillWords = 4 * DSM_BLOCK_LENGTH },
+    [DACAMP_LATENCY_NORMAL] = { .targetUs = 2500,  .startUs = 3500,  .maxUs = 8000,  .pioFillWords = 8 * DSM_BLOCK_LENGTH },
+    [DACAMP_LATENCY_SAFE]   = { .targetUs = 16000, .startUs = 18500, .maxUs = 40000, .pioFillWords = PIO_DMA_FILL_WORDS },
+};
 
 static volatile bool isEnabledRequested = false, isFlushRequested = false;
 static volatile uint32_t requestedSampleRate;
+static volatile int requestedDsmOrder = DACAMP_DSM_ORDER;
+static volatile dacamp_latency_t requestedLatencyProfile = DACAMP_LATENCY_PROFILE;
+
+//core0 sets them on start and flush, core1 takes them on its next start or flush
+static volatile uint32_t pcmStartSlots;
+static volatile int pioFillWords;
 
 static uint64_t pcmRingInternalBuffer[PCM_RING_BUFFER_DEPTH];
-static ringbuf_t pcmRing;
+static spscring_t pcmRing; //core0 produces, core1 consumes
+
+static volatile uint32_t pcmFlushHead; //core1 drops pcmRing up to here on flush
+
+static gain_t gainLeft, gainRight; //core0, dacamp_pcm_put
+static limiter_t limiter;
+static feedback_t feedback; //core0, the SOF interrupt
+static halfband_t halfband;
+static bool isInterpolating;
+static uint32_t inputSampleRate;
+static uint32_t pcmMaxSlots;
 
 static dsm_t dsmLeft, dsmRight;
+static const dsm_kernel_t* dsmKernel; //picked on every start and flush
+static dither_t dither;
 
-static uint64_t lastPcm;
+static uint32_t pioDmaBufferLeft[PIO_DMA_RING_WORDS] __attribute__((aligned(PIO_DMA_RING_WORDS * sizeof(uint32_t))));
+static uint32_t pioDmaBufferRight[PIO_DMA_RING_WORDS] __attribute__((aligned(PIO_DMA_RING_WORDS * sizeof(uint32_t))));
+static pio_dma_ring_t pioDmaLeft, pioDmaRight;
 
-static spin_lock_t *pcmSpinlock;
+//core1, set up by stream_start
+static uint64_t lastPcm;
+static bool sampleRate96k;
+static bool refillBuffers;
+static int startSlots;
+static int fillWords = PIO_DMA_FILL_WORDS;
 
-static uint64_t pcmToDsmPcmBuffer[PCM_TO_DSM_PCM_BUFFER_LENGTH];
+//  dsm_reset zeroes the per-modulator counts on every start and flush, core1 keeps the earlier ones here
+// and publishes the running total for dacamp_get_dsm_overloads
+static uint32_t dsmOverloadsBase;
+static volatile uint32_t dsmOverloads;
 
-#define _DACAMP_PCM16_LEFT(pcm)         ((int16_t)(pcm))
-#define _DACAMP_PCM16_RIGHT(pcm)        ((int16_t)((pcm) >> 16))
- 
-#define _DACAMP_PCM24_LEFT(pcm)         (((int32_t)(pcm)) >> 8)
-#define _DACAMP_PCM24_RIGHT(pcm)        ((int32_t)((pcm) >> 32) >> 8)
+static inline uint32_t dsm_overloads_total(void)
+{
+    uint32_t overloads = dsmOverloadsBase + dsmLeft.overloads;
+#ifdef HBRIDGE_STEREO
+    overloads += dsmRight.overloads;
+#endif
+    return overloads;
+}
 
-#define _DACAMP_DSM_PCM_LEFT(pcm)       ((int32_t)(pcm))
-#define _DACAMP_DSM_PCM_RIGHT(pcm)      ((int32_t)((pcm) >> 32))
-#define _DACAMP_DSM_PCM(left, right)    (((uint64_t)(left & 0xFFFFFFFF)) | (((uint64_t)((right)) << 32)))
+static int32_t dsmBlockPcm[2 * 2 * DSM_BLOCK_LENGTH]; //interleaved L/R, up to two frames per output word
+static uint32_t dsmBlockRandom[2 * DSM_BLOCK_LENGTH]; //left words, then right words
+static uint64_t dsmBlockOut[2 * DSM_BLOCK_LENGTH];    //interleaved L/R
 
 static void core1_worker(void);
-static bool process_sample(uint64_t *outSampleL, uint64_t *outSampleR, bool doNotRepeatPrevious, bool sampleRate96k);
+static void set_sample_rate(uint32_t sampleRate);
+static void apply_latency_profile(void);
+static void pio_dma_start(void);
+static void pio_dma_stop(void);
+static void stream_start(uint offset);
+static int process_block(int maxWords, bool doNotRepeatPrevious, bool sampleRate96k);
 static void dacamp_panic(void);
 static void dacamp_init_cringe_debug(void);
 
@@ -105,9 +189,7 @@ void dacamp_init(void)
     //set clock to 192mhz
     set_sys_clock_pll(1536000000, 4, 2);
 
-    ringbuf_init(&pcmRing, &pcmRingInternalBuffer, PCM_RING_BUFFER_DEPTH, sizeof(uint64_t));
-
-    pcmSpinlock = spin_lock_init(spin_lock_claim_unused(true));
+    spscring_init(&pcmRing, pcmRingInternalBuffer, PCM_RING_BUFFER_DEPTH);
 
     dacamp_init_cringe_debug();
     
@@ -116,36 +198,132 @@ void dacamp_init(void)
 
 void dacamp_start(uint32_t sampleRate)
 {
-    requestedSampleRate = sampleRate;
+    //fade in from silence
+    gain_init(&gainLeft, 0);
+    gain_init(&gainRight, 0);
+
+    set_sample_rate(sampleRate);
     isEnabledRequested = true;
 }
 
 void dacamp_change_sample_rate(uint32_t sampleRate)
 {
-    requestedSampleRate = sampleRate;
+    set_sample_rate(sampleRate);
     dacamp_flush();
 }
 
+//requestedSampleRate is what core1 gets from pcmRing
+static void set_sample_rate(uint32_t sampleRate)
+{
+#ifdef DACAMP_HALFBAND_48K
+    isInterpolating = sampleRate == 48000;
+#endif
+
+    halfband_init(&halfband);
+    limiter_init(&limiter, sampleRate / 1000); //1 ms
+
+    inputSampleRate = sampleRate;
+    requestedSampleRate = isInterpolating ? 2 * sampleRate : sampleRate;
+
+    apply_latency_profile();
+}
+
+//pcmRing levels for the current rate, slots are requestedSampleRate frames
+static void apply_latency_profile(void)
+{
+    const dacamp_latency_profile_t* profile = &dacampLatencyProfiles[requestedLatencyProfile];
+
+    uint32_t slotsPerMs = requestedSampleRate / 1000;
+
+    pcmMaxSlots = slotsPerMs * profile->maxUs / 1000;
+    pcmStartSlots = slotsPerMs * profile->startUs / 1000;
+    pioFillWords = profile->pioFillWords;
+
+    uint32_t status = save_and_disable_interrupts();
+    feedback_init(&feedback, inputSampleRate, (int)(inputSampleRate / 1000 * profile->targetUs / 1000));
+    restore_interrupts(status);
+}
+
 void dacamp_stop(void)
 {
     isEnabledRequested = false;
+
+    pcmFlushHead = spscring_head(&pcmRing);
     isFlushRequested = true;
+}
 
-    uint32_t irq = spin_lock_blocking(pcmSpinlock);
+bool dacamp_set_dsm_order(int order)
+{
+    if (order < 2 || order > DSM_MAX_ORDER)
+        return false;
 
-    ringbuf_clear(&pcmRing);
+    requestedDsmOrder = order;
+    return true;
+}
 
-    spin_unlock(pcmSpinlock, irq);
+int dacamp_get_dsm_order(void)
+{
+    return requestedDsmOrder;
 }
 
-void dacamp_flush(void)
+void dacamp_set_latency_profile(dacamp_latency_t profile)
 {
-    uint32_t irq = spin_lock_blocking(pcmSpinlock);
+    if (profile >= 0 && profile < DACAMP_LATENCY_COUNT)
+        requestedLatencyProfile = profile;
+}
 
-    ringbuf_clear(&pcmRing);
+dacamp_latency_t dacamp_get_latency_profile(void)
+{
+    return requestedLatencyProfile;
+}
 
-    spin_unlock(pcmSpinlock, irq);
+uint32_t dacamp_get_latency_ns(void)
+{
+    if (!inputSampleRate)
+        return 0;
 
+    //input frames, the filtered level is what the feedback holds it at
+    uint32_t frames = limiter.lookahead + (feedback.fill >> FEEDBACK_FILL_SHIFT);
+
+    if (isInterpolating)
+        frames += HALFBAND_PAIRS;
+
+    //output words run at 48 kHz whatever the input rate
+    return (uint32_t)((uint64_t)frames * 1000000000 / inputSampleRate + (uint64_t)pioFillWords * 1000000000 / 48000);
+}
+
+//core1 counts them in pio_dma_ring_filled, core0 only reads the aligned words
+uint32_t dacamp_get_pio_underruns(void)
+{
+    uint32_t underruns = ((volatile pio_dma_ring_t*)&pioDmaLeft)->underruns;
+#ifdef HBRIDGE_STEREO
+    underruns += ((volatile pio_dma_ring_t*)&pioDmaRight)->underruns;
+#endif
+    return underruns;
+}
+
+uint32_t dacamp_get_dsm_overloads(void)
+{
+    return dsmOverloads;
+}
+
+//called from the SOF interrupt on core0, the same core that fills pcmRing
+uint32_t dacamp_get_feedback(uint32_t frameNumber)
+{
+    int fill = spscring_filled_slots(&pcmRing) / (isInterpolating ? 2 : 1);
+
+    //nothing plays yet, keep the filter and the integral where they are
+    if (!isEnabledRequested)
+        return (uint32_t)feedback.nominal;
+
+    return feedback_update(&feedback, fill, frameNumber);
+}
+
+void dacamp_flush(void)
+{
+    apply_latency_profile();
+
+    pcmFlushHead = spscring_head(&pcmRing);
     isFlushRequested = true;
 }
 
@@ -159,72 +337,64 @@ int dacamp_pcm_put(const uint32_t* samples, int sampleCount, int sampleSize, con
     //4-byte uint32_t samples are 2 channels of 16bit pcm
     //8-byte uint64_t samples are 2 channels of 24bit pcm
 
-    uint64_t *samples64 = (uint64_t*)samples;
+    const uint8_t *src = (const uint8_t*)samples;
+
+    //master plus channel, the ramp takes it from wherever the previous packet left off
+    gain_set_target(&gainLeft, gain_from_uac2((int32_t)volume[0] + (int32_t)volume[1], mute[0] || mute[1]));
+    gain_set_target(&gainRight, gain_from_uac2((int32_t)volume[0] + (int32_t)volume[2], mute[0] || mute[2]));
 
-    int32_t sampleLeft, sampleRight;
+    pcm_convert_t convert = pcm_convert_select(sampleSize, &gainLeft, &gainRight);
 
-    int32_t volumeLeft = (int32_t)volume[0] + (int32_t)volume[1], 
-            volumeRight = (int32_t)volume[0] + (int32_t)volume[2];
+    int slotsPerSample = isInterpolating ? 2 : 1;
 
-    int32_t volumeIndexLeft = (-volumeLeft) >> DACAMP_VOLUME_STEP_BITS,
-            volumeIndexRight = (-volumeRight) >> DACAMP_VOLUME_STEP_BITS;
+    //the profile's max depth, whatever the host sends beyond it is rejected
+    int room = ((int)pcmMaxSlots - (int)spscring_filled_slots(&pcmRing)) / slotsPerSample;
 
-    int32_t muteLeft = mute[0] || mute[1] || volumeLeft <= DACAMP_MIN_VOLUME_UAC2, 
-            muteRight = mute[0] || mute[2] || volumeRight <= DACAMP_MIN_VOLUME_UAC2;
+    if (sampleCount > room)
+        sampleCount = room > 0 ? room : 0;
 
     while (sampleCount > 0)
     {
-        int samplesToWrite = sampleCount > PCM_TO_DSM_PCM_BUFFER_LENGTH
-            ? PCM_TO_DSM_PCM_BUFFER_LENGTH 
-            : sampleCount;
-        
-        for (int i = 0; i < samplesToWrite; ++i)
-        {
-            if (sampleSize == 4)
-            {
-                uint32_t sample = *(samples++);
-                sampleLeft = DSM_INT16_TO_INT32(_DACAMP_PCM16_LEFT(sample));
-                sampleRight = DSM_INT16_TO_INT32(_DACAMP_PCM16_RIGHT(sample));
-            }
-            else 
-            {
-                uint64_t sample = *(samples64++);
-                sampleLeft = DSM_INT24_TO_INT32(_DACAMP_PCM24_LEFT(sample));
-                sampleRight = DSM_INT24_TO_INT32(_DACAMP_PCM24_RIGHT(sample));
-            }
+        //convert straight into the ring, at most two runs around the wrap
+        int slots = sampleCount * slotsPerSample;
+        uint64_t *dsmPcm = spscring_reserve(&pcmRing, &slots);
 
-            //volume and mute
-            if (!muteLeft)
-            {
-                sampleLeft *= volumeLutNumerator[volumeIndexLeft];
-                sampleLeft /= volumeLutDenominator[volumeIndexLeft];
-            }
-            else
-                sampleLeft = 0;
-
-            if (!muteRight)
-            {
-                sampleRight *= volumeLutNumerator[volumeIndexRight];
-                sampleRight /= volumeLutDenominator[volumeIndexRight];
-            }
-            else
-                sampleRight = 0;
+        int samplesToWrite = slots / slotsPerSample;
 
-            pcmToDsmPcmBuffer[i] = _DACAMP_DSM_PCM(sampleLeft, sampleRight);
-        }
-
-        spin_lock_unsafe_blocking(pcmSpinlock);
+        if (!samplesToWrite)
+        {
+            //one slot left before the wrap, an interpolated pair has to go around it
+            if (!isInterpolating || !slots || spscring_free_slots(&pcmRing) < 2)
+                break;
 
-        int samplesWritten = ringbuf_put(&pcmRing, pcmToDsmPcmBuffer, samplesToWrite);
+            uint64_t pair[2];
 
-        spin_unlock_unsafe(pcmSpinlock);
+            convert(&pair[1], src, 1, &gainLeft, &gainRight);
+            limiter_process(&limiter, &pair[1], 1);
+            halfband_process(&halfband, pair, &pair[1], 1);
+            spscring_put(&pcmRing, pair, 2);
 
-        ret += samplesWritten;
+            samplesToWrite = 1;
+        }
+        else if (isInterpolating)
+        {
+            //converted into the second half, halfband_process spreads it over the whole run
+            convert(dsmPcm + samplesToWrite, src, samplesToWrite, &gainLeft, &gainRight);
+            limiter_process(&limiter, dsmPcm + samplesToWrite, samplesToWrite);
+            halfband_process(&halfband, dsmPcm, dsmPcm + samplesToWrite, samplesToWrite);
+            spscring_commit(&pcmRing, 2 * samplesToWrite);
+        }
+        else
+        {
+            convert(dsmPcm, src, samplesToWrite, &gainLeft, &gainRight);
+            limiter_process(&limiter, dsmPcm, samplesToWrite);
+            spscring_commit(&pcmRing, samplesToWrite);
+        }
 
-        if (samplesWritten != samplesToWrite)
-            break;
+        src += samplesToWrite * sampleSize;
 
-        sampleCount -= samplesWritten;
+        ret += samplesToWrite;
+        sampleCount -= samplesToWrite;
     }
 
     return ret;
@@ -235,19 +405,22 @@ static void core1_worker(void)
     uint offset = pio_add_program(PIO, &hbridge_program);
 
     if (!hbridge_program_init(PIO, SM_LEFT, SM_RIGHT, offset, HBRIDGE_LEFT_START_PIN, HBRIDGE_RIGHT_START_PIN) ||
+        !pio_dma_ring_init(&pioDmaLeft, pioDmaBufferLeft, PIO_DMA_RING_WORDS, PIO, SM_LEFT) ||
+#ifdef HBRIDGE_STEREO
+        !pio_dma_ring_init(&pioDmaRight, pioDmaBufferRight, PIO_DMA_RING_WORDS, PIO, SM_RIGHT) ||
+#endif
         !rosc_random_init())
         dacamp_panic();
 
-    bool isEnabled, sampleRate96k;
-    bool isEnabledActual = false;
-    bool refillBuffers = false;
+    uint32_t ditherSeed[4];
 
-    uint64_t pioRingInternalBuf[2*PIO_RING_BUFFER_DEPTH];
-    ringbuf_t pioRing;
+    for (int i = 0; i < 4; ++i)
+        ditherSeed[i] = rosc_random_get();
 
-    ringbuf_init(&pioRing, pioRingInternalBuf, PIO_RING_BUFFER_DEPTH, 2*sizeof(uint64_t));
+    dither_init(&dither, ditherSeed, DACAMP_DITHER_MODE);
 
-    uint64_t pioSample[2];
+    bool isEnabled;
+    bool isEnabledActual = false;
 
     watchdog_enable(500, 1); // 500ms without samples 
 
@@ -258,18 +431,13 @@ static void core1_worker(void)
         {
             if (isEnabled) 
             {
-                dsm_reset(&dsmLeft);
-                dsm_reset(&dsmRight);
-                ringbuf_clear(&pioRing);
-                refillBuffers = true;
-                lastPcm = 0;
-
-                sampleRate96k = requestedSampleRate == 96000;
-
-                hbridge_program_start(PIO, offset, SM_LEFT, SM_RIGHT);
+                stream_start(offset);
             }
             else 
+            {
                 hbridge_program_stop(PIO, SM_LEFT, SM_RIGHT);
+                pio_dma_stop();
+            }
 
             isEnabledActual = isEnabled;
             isFlushRequested = false;
@@ -279,16 +447,9 @@ static void core1_worker(void)
             if (isEnabledActual)
             {
                 hbridge_program_stop(PIO, SM_LEFT, SM_RIGHT);
+                pio_dma_stop();
 
-                dsm_reset(&dsmLeft);
-                dsm_reset(&dsmRight);
-                ringbuf_clear(&pioRing);
-                refillBuffers = true;
-                lastPcm = 0;
-
-                sampleRate96k = requestedSampleRate == 96000;
-
-                hbridge_program_start(PIO, offset, SM_LEFT, SM_RIGHT);
+                stream_start(offset);
             }
 
             isFlushRequested = false;
@@ -300,94 +461,138 @@ static void core1_worker(void)
             continue;
         }
 
-        if (refillBuffers && ringbuf_is_full(&pioRing))
-            refillBuffers = false;
-
-        if (!refillBuffers)
-            while (pio_sm_get_tx_fifo_level(PIO, SM_LEFT) <= (PIO_TX_FIFO_DEPTH - 2) && ringbuf_get_one(&pioRing, pioSample))
-            {   
-                // assuming we already fill right first and left second, 
-                //and they consume bits at the same rate, left will always be 'fuller'
+        //both rings get the same words, but one DMA may be a word or two behind the other
+        uint32_t filled = pio_dma_ring_filled(&pioDmaLeft);
 #ifdef HBRIDGE_STEREO
-                pio_sm_put(PIO, SM_RIGHT, (uint32_t)(pioSample[1] >> 32));
-                pio_sm_put(PIO, SM_RIGHT, (uint32_t)pioSample[1]);
+        uint32_t filledRight = pio_dma_ring_filled(&pioDmaRight);
+
+        if (filledRight > filled)
+            filled = filledRight;
 #endif
-                pio_sm_put(PIO, SM_LEFT, (uint32_t)(pioSample[0] >> 32));
-                pio_sm_put(PIO, SM_LEFT, (uint32_t)pioSample[0]);
-            }
+        int filledWords = filled / 2;
+        int freeWords = fillWords - filledWords;
 
-        if (ringbuf_is_full(&pioRing))
+        //nothing leaves pcmRing before the start level is there, the level then settles near the target
+        if (refillBuffers && !filledWords && spscring_filled_slots(&pcmRing) < startSlots)
             continue;
 
-        if (!process_sample(&pioSample[0], &pioSample[1], !ringbuf_is_empty(&pioRing) || refillBuffers, sampleRate96k))
+        if (refillBuffers && freeWords < DSM_BLOCK_LENGTH)
+        {
+            pio_dma_start();
+            refillBuffers = false;
+        }
+
+        //wait for room for a whole block, while refilling take whatever fits
+        if (freeWords <= 0 || (freeWords < DSM_BLOCK_LENGTH && !refillBuffers))
             continue;
 
-        ringbuf_put_one(&pioRing, pioSample);
+        //repeat the last frame rather than letting DMA replay the ring
+        process_block(freeWords, filledWords >= DSM_BLOCK_LENGTH || refillBuffers, sampleRate96k);
+        dsmOverloads = dsm_overloads_total();
     }
 }
 
-static inline bool process_sample(uint64_t *outSampleL, uint64_t *outSampleR, bool doNotRepeatPrevious, bool sampleRate96k)
+//  everything a start and a flush have in common: fresh modulators and settings, pcmRing from the flush point on,
+// DMA rings refilled before the state machines get to them
+static void stream_start(uint offset)
 {
-    if (sampleRate96k)
-    {
-        uint64_t firstPcm;
+    dsmOverloadsBase = dsm_overloads_total();
+
+    dsm_reset(&dsmLeft);
+    dsm_reset(&dsmRight);
+    spscring_discard(&pcmRing, pcmFlushHead);
+    refillBuffers = true;
+    lastPcm = 0;
+
+    sampleRate96k = requestedSampleRate == 96000;
+    startSlots = (int)pcmStartSlots;
+    fillWords = pioFillWords;
+    dsmKernel = dsm_kernel(requestedDsmOrder);
+    dsm_set_transition_penalty(&dsmLeft, DACAMP_DSM_TRANSITION_PENALTY);
+    dsm_set_transition_penalty(&dsmRight, DACAMP_DSM_TRANSITION_PENALTY);
+    dsm_set_lookahead(&dsmLeft, DACAMP_DSM_LOOKAHEAD);
+    dsm_set_lookahead(&dsmRight, DACAMP_DSM_LOOKAHEAD);
+
+    hbridge_program_start(PIO, offset, SM_LEFT, SM_RIGHT);
+}
 
-        uint32_t irq = spin_lock_blocking(pcmSpinlock);
+static void pio_dma_start(void)
+{
+    pio_dma_ring_start(&pioDmaLeft);
+#ifdef HBRIDGE_STEREO
+    pio_dma_ring_start(&pioDmaRight);
+#endif
+}
 
-        bool success = ringbuf_filled_slots(&pcmRing) >= 2;
+static void pio_dma_stop(void)
+{
+    pio_dma_ring_stop(&pioDmaLeft);
+#ifdef HBRIDGE_STEREO
+    pio_dma_ring_stop(&pioDmaRight);
+#endif
+}
 
-        if (success)
-        {
-            ringbuf_get_one(&pcmRing, &firstPcm);
-            ringbuf_get_one(&pcmRing, &lastPcm);
-        }
+//  dequeues up to maxWords (and at most DSM_BLOCK_LENGTH) output words worth of pcm in one go
+// and puts the modulated words into the DMA rings, returns the word count
+static int process_block(int maxWords, bool doNotRepeatPrevious, bool sampleRate96k)
+{
+    int framesPerWord = sampleRate96k ? 2 : 1;
+    int words = maxWords > DSM_BLOCK_LENGTH ? DSM_BLOCK_LENGTH : maxWords;
 
-        spin_unlock(pcmSpinlock, irq);
+    int availableWords = spscring_filled_slots(&pcmRing) / framesPerWord;
 
-        if (success)
-            watchdog_update();
+    if (words > availableWords)
+        words = availableWords;
 
-        if (!success && doNotRepeatPrevious)
-            return false;
+    spscring_get(&pcmRing, dsmBlockPcm, words * framesPerWord);
 
-        if (success)
-        {
-            *outSampleL = dsm_process_sample_x16(&dsmLeft, _DACAMP_DSM_PCM_LEFT(firstPcm), _DACAMP_DSM_PCM_LEFT(lastPcm), (uint32_t)rosc_random_get());
-#ifdef HBRIDGE_STEREO
-            *outSampleR = dsm_process_sample_x16(&dsmRight, _DACAMP_DSM_PCM_RIGHT(firstPcm), _DACAMP_DSM_PCM_RIGHT(lastPcm), (uint32_t)rosc_random_get());
-#endif
-        }
-        else 
-        {
-            *outSampleL = dsm_process_sample_x32(&dsmLeft, _DACAMP_DSM_PCM_LEFT(lastPcm), (uint32_t)rosc_random_get());
-#ifdef HBRIDGE_STEREO
-            *outSampleR = dsm_process_sample_x32(&dsmRight, _DACAMP_DSM_PCM_RIGHT(lastPcm), (uint32_t)rosc_random_get());
-#endif
-        }
+    if (words > 0)
+    {
+        watchdog_update();
 
-        return true;        
+        int last = 2 * (words * framesPerWord - 1);
+        lastPcm = PCM_DSM_FRAME(dsmBlockPcm[last], dsmBlockPcm[last + 1]);
     }
-    else 
+    else if (doNotRepeatPrevious)
+        return 0;
+    else
     {
-        uint32_t irq = spin_lock_blocking(pcmSpinlock);
-
-        bool success = ringbuf_get_one(&pcmRing, &lastPcm);
+        //running dry, repeat the last frame for one word
+        dsmBlockPcm[0] = PCM_DSM_LEFT(lastPcm);
+        dsmBlockPcm[1] = PCM_DSM_RIGHT(lastPcm);
 
-        spin_unlock(pcmSpinlock, irq);
+        words = 1;
+        framesPerWord = 1;
+    }
 
-        if (success)
-            watchdog_update();
+    dither_stir(&dither, rosc_random_bit());
+    dither_fill(&dither, 0, &dsmBlockRandom[0], words);
+    dither_fill(&dither, 1, &dsmBlockRandom[words], words);
 
-        if (!success && doNotRepeatPrevious)
-            return false;
+    if (framesPerWord == 2)
+        dsmKernel->block_x16(&dsmLeft, &dsmBlockPcm[0], 2, words, &dsmBlockRandom[0], &dsmBlockOut[0]);
+    else
+        dsmKernel->block_x32(&dsmLeft, &dsmBlockPcm[0], 2, words, &dsmBlockRandom[0], &dsmBlockOut[0]);
 
-        *outSampleL = dsm_process_sample_x32(&dsmLeft, _DACAMP_DSM_PCM_LEFT(lastPcm), (uint32_t)rosc_random_get());
 #ifdef HBRIDGE_STEREO
-        *outSampleR = dsm_process_sample_x32(&dsmRight, _DACAMP_DSM_PCM_RIGHT(lastPcm), (uint32_t)rosc_random_get());
+    if (framesPerWord == 2)
+        dsmKernel->block_x16(&dsmRight, &dsmBlockPcm[1], 2, words, &dsmBlockRandom[words], &dsmBlockOut[1]);
+    else
+        dsmKernel->block_x32(&dsmRight, &dsmBlockPcm[1], 2, words, &dsmBlockRandom[words], &dsmBlockOut[1]);
 #endif
 
-        return true;
+    //the state machines shift out the high half first
+    for (int i = 0; i < words; ++i)
+    {
+        pio_dma_ring_put(&pioDmaLeft, (uint32_t)(dsmBlockOut[2 * i] >> 32));
+        pio_dma_ring_put(&pioDmaLeft, (uint32_t)dsmBlockOut[2 * i]);
+#ifdef HBRIDGE_STEREO
+        pio_dma_ring_put(&pioDmaRight, (uint32_t)(dsmBlockOut[2 * i + 1] >> 32));
+        pio_dma_ring_put(&pioDmaRight, (uint32_t)dsmBlockOut[2 * i + 1]);
+#endif
     }
+
+    return words;
 }
 
 static void dacamp_panic(void)
@@ -415,11 +620,7 @@ static void dacamp_init_cringe_debug(void)
 
 void dacamp_debug_stuff_task(void)
 {
-    uint32_t irq = spin_lock_blocking(pcmSpinlock);
-
-    uint32_t level = ringbuf_filled_slots(&pcmRing);
-
-    spin_unlock(pcmSpinlock, irq);
+    uint32_t level = spscring_filled_slots(&pcmRing);
 
     gpio_put(CRINGE_DEBUG_LED1, level > 30);
     gpio_put(CRINGE_DEBUG_LED2, level == 0);
@@ -1,13 +1,24 @@
 #pragma once
 
+#include <stdbool.h>
 #include <stdint.h>
 
-#define DACAMP_VOLUME_STEP_BITS 7
+#define DACAMP_VOLUME_STEP_BITS 5 //1/8 dB, the step of volumeLut.h
 #define DACAMP_VOLUME_STEP (1 << DACAMP_VOLUME_STEP_BITS)
 #define DACAMP_MIN_VOLUME_DB (-50)
 #define DACAMP_VOLUME_PER_DB_UAC2 256 
 #define DACAMP_MIN_VOLUME_UAC2 (DACAMP_MIN_VOLUME_DB * DACAMP_VOLUME_PER_DB_UAC2)
 
+//  pcm buffering, from the next dacamp_start or flush on, see dacampLatencyProfiles in dacamp.c.
+// LOW is for A/V sync, SAFE rides out hosts that are late with packets for tens of ms
+typedef enum dacamp_latency
+{
+    DACAMP_LATENCY_LOW,     //~3 ms from USB to the bridges
+    DACAMP_LATENCY_NORMAL,  //~5 ms
+    DACAMP_LATENCY_SAFE,    //~20 ms
+    DACAMP_LATENCY_COUNT
+} dacamp_latency_t;
+
 void dacamp_init(void);
 
 void dacamp_start(uint32_t sampleRate);
@@ -18,11 +29,36 @@ void dacamp_stop(void);
 
 void dacamp_flush(void);
 
+//  modulator order 2..DSM_MAX_ORDER (dsm.h) from the next dacamp_start or flush on, false and ignored otherwise.
+// DACAMP_DSM_ORDER by default, the host picks one with a vendor request (main.c)
+bool dacamp_set_dsm_order(int order);
+int dacamp_get_dsm_order(void);
+
+//DACAMP_LATENCY_PROFILE by default, the host picks one with a vendor request (main.c)
+void dacamp_set_latency_profile(dacamp_latency_t profile);
+dacamp_latency_t dacamp_get_latency_profile(void);
+
+//  what a frame accepted by dacamp_pcm_put now takes to reach the bridges, in ns: the limiter look-ahead,
+// the halfband delay, the filtered pcm level and the PIO DMA fill. for the UAC2 latency control
+uint32_t dacamp_get_latency_ns(void);
+
+//modulator overloads of both channels since dacamp_init, across starts and flushes. see _dsm_check_overload in dsm.h
+uint32_t dacamp_get_dsm_overloads(void);
+
+//  16.16 frames per USB frame for tud_audio_n_fb_set, frameNumber is the one of the current SOF.
+// the rate that holds pcmRing at its target level, see feedback.h
+uint32_t dacamp_get_feedback(uint32_t frameNumber);
+
+//  times a PIO DMA ring ran dry since power-up, both channels. the bridges got zero state until core1 caught up,
+// see pioDmaRing.h
+uint32_t dacamp_get_pio_underruns(void);
+
 void dacamp_debug_stuff_task(void);
 
 //samples is an array of LR 16 bit or 24 (stored as 32) bit sample pairs
 //sampleSize is 4 for PCM16 or 8 for PCM24
 //L = sample&0xFFFF, R = sample >> 16 
 //L = sample&0xFFFFFFFF, R = sample >> 32 
+//4 byte alignment is enough for both, samples can point right into the USB endpoint FIFO
 //returns how many samples were written to the internal buffer
 int dacamp_pcm_put(const uint32_t* samples, int sampleCount, int sampleSize, const int16_t *volume, const int8_t *mute);
\ No newline at end of file
@@ -0,0 +1,128 @@
+#pragma once
+
+//  dither words for dsm_process_sample_x32/x16 and the block versions, made in bulk by xoshiro128**
+//
+// the modulator only looks at the top _DSM_DITHER_MSB + 1 bits of each 16 bit half (_DSM_DITHER_GARBAGE_1/2),
+// so anything but plain random bits is made by writing the wanted signed value into exactly those bits:
+//
+// DITHER_RECTANGULAR  generator output as is, uniform -64..63 - what the ROSC CRC words used to give
+// DITHER_TRIANGULAR   sum of two uniform -32..31, same peak, no noise modulation with the signal
+// DITHER_HIGHPASS     u[n] - u[n-1] of uniform -32..31 per channel: triangular too, but the power is
+//                     pushed up towards fs/2 of the dither rate instead of sitting flat in the audio band
+//
+// xoshiro128** is a few shifts, a rotate and two multiplies by small constants per 32 bits,
+// all single cycle on cortex-m0+. dither_stir mixes fresh entropy in, see roscRandom.h
+
+#include <stdint.h>
+
+#include "dsm.h"
+
+typedef enum dither_mode
+{
+    DITHER_RECTANGULAR,
+    DITHER_TRIANGULAR,
+    DITHER_HIGHPASS,
+} dither_mode_t;
+
+typedef struct dither
+{
+    uint32_t s[4];
+    dither_mode_t mode;
+    int32_t prev[2];    //DITHER_HIGHPASS history per channel
+} dither_t;
+
+#define _DITHER_SHIFT       (31 - _DSM_DITHER_MSB)
+#define _DITHER_HALF_MASK   ((1u << (_DSM_DITHER_MSB + 1)) - 1)
+
+//value to the bits _DSM_DITHER_GARBAGE_1 reads back, the other half to the bits of _DSM_DITHER_GARBAGE_2
+#define _DITHER_WORD(first, second) \
+    (((uint32_t)(first) << _DITHER_SHIFT) | (((uint32_t)(second) & _DITHER_HALF_MASK) << (_DITHER_SHIFT - 16)))
+
+//uniform signed value of _DSM_DITHER_MSB bits (half the full dither range) from bit position pos of r
+#define _DITHER_UNIFORM(r, pos) (((int32_t)((r) << (pos))) >> (_DITHER_SHIFT + 1))
+
+static inline uint32_t _dither_rotl(uint32_t x, int k)
+{
+    return (x << k) | (x >> (32 - k));
+}
+
+static inline uint32_t _dither_next(dither_t* ptr)
+{
+    uint32_t* s = ptr->s;
+    uint32_t result = _dither_rotl(s[1] * 5, 7) * 9;
+    uint32_t t = s[1] << 9;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+
+    s[2] ^= t;
+    s[3] = _dither_rotl(s[3], 11);
+
+    return result;
+}
+
+//xoshiro must not be all zero, it would stay there
+static inline void dither_stir(dither_t* ptr, uint32_t entropy)
+{
+    ptr->s[0] ^= entropy;
+
+    if (!(ptr->s[0] | ptr->s[1] | ptr->s[2] | ptr->s[3]))
+        ptr->s[0] = 1;
+}
+
+static void dither_init(dither_t* ptr, const uint32_t seed[4], dither_mode_t mode)
+{
+    for (int i = 0; i < 4; ++i)
+        ptr->s[i] = seed[i];
+
+    ptr->mode = mode;
+    ptr->prev[0] = ptr->prev[1] = 0;
+
+    dither_stir(ptr, 0);
+}
+
+//count dither words for one channel (0 or 1, only DITHER_HIGHPASS cares)
+static void dither_fill(dither_t* ptr, int channel, uint32_t* words, int count)
+{
+    switch (ptr->mode)
+    {
+    case DITHER_RECTANGULAR:
+    default:
+        for (int i = 0; i < count; ++i)
+            words[i] = _dither_next(ptr);
+        break;
+
+    case DITHER_TRIANGULAR:
+        for (int i = 0; i < count; ++i)
+        {
+            uint32_t r = _dither_next(ptr);
+
+            int32_t first = _DITHER_UNIFORM(r, 0) + _DITHER_UNIFORM(r, 8);
+            int32_t second = _DITHER_UNIFORM(r, 16) + _DITHER_UNIFORM(r, 24);
+
+            words[i] = _DITHER_WORD(first, second);
+        }
+        break;
+
+    case DITHER_HIGHPASS:
+    {
+        int32_t prev = ptr->prev[channel];
+
+        for (int i = 0; i < count; ++i)
+        {
+            uint32_t r = _dither_next(ptr);
+
+            int32_t first = _DITHER_UNIFORM(r, 0);
+            int32_t second = _DITHER_UNIFORM(r, 16);
+
+            words[i] = _DITHER_WORD(first - prev, second - first);
+            prev = second;
+        }
+
+        ptr->prev[channel] = prev;
+        break;
+    }
+    }
+}
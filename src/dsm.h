@@ -1,23 +1,44 @@
-//4th order DSM with CIFF topology and linear interpolation 32x oversampling
+//  CIFF DSM of order 2 to 5 with a 3-level quantizer, 32 symbols per 48 kHz output word: x32 interpolates one
+// 48 kHz frame linearly, x16 two 96 kHz frames (or the halfband.h output at 48 kHz)
 
 #pragma once
 
+#include <stdbool.h>
 #include <memory.h>
 #include <stdint.h>
 
-// internally DSM uses 24 bit inputs - +-2^23 * 71% (to prevent overload), 
-//if use more than 24 bits current DSM implementation with 32bit integrators starts to overflow
-//71% is also a result of modelling and running this code locally with test signals 
+//  inputs are 24 bit, _DSM_INT_MAX is ~2^23. every order is stable up to DSM_INPUT_CEILING, 45/64 (~71%, -3 dB)
+// of it, past that the 32 bit integrators can overload. the firmware converts at unity and limiter.h reduces
+// the gain of peaks above the ceiling only, so the rest of the signal keeps its full level
 
+//  scaled to the ceiling, what host tools and tests feed the modulator with
 #define DSM_INT16_TO_INT32(a)       ((((int32_t)(a)) * 45) << 2) //limit modulator input to 45/64= ~71%
 #define DSM_INT24_TO_INT32(a)       ((((int32_t)(a)) * 45) >> 6)
 
+//full scale PCM at _DSM_INT_MAX, ~3 dB above the ceiling
+#define DSM_INT16_TO_INT32_UNITY(a) (((int32_t)(a)) << 8)
+#define DSM_INT24_TO_INT32_UNITY(a) ((int32_t)(a))
+
+#define DSM_INPUT_CEILING           DSM_INT24_TO_INT32(0x7FFFFF)
+
 #define _DSM_INT_MAX                (0x7FFF << 8)
 #define _DSM_INT_MAX_SHORT_PULSE    ((_DSM_INT_MAX * 21) / 25) //minus dead time (?)
-#define _DSM_ZERO_THRESHOLD         ((int32_t)0x00000000) //proper three-state quantizing needs more careful implementation to be useful
+
+//  3-level quantizer: inputs within the dead band +-_DSM_ZERO_THRESHOLD give 0b00, the bridge zero state, instead of a
+// full swing. a quarter of _DSM_INT_MAX measured best (dsm_bench, order 4): half loses low level SNR to dead zone
+// limit cycles, an eighth rarely rests. 0 is the old 2-level quantizer. dsm_m0.S has its own copy,
+// and every coefficient set has to pass dsm_search -c with it
+#define _DSM_ZERO_THRESHOLD         (_DSM_INT_MAX / 4)
+
+//  overload limits, checked once per 16 symbols. a stable loop keeps the quantizer input below ~2^24 even past
+// the stable input range, dsm_search rejects sets that reach 2^26. the integrator limit catches the wrap that would
+// hide an overload from the quantizer sum, a 16 symbol run cannot get from it past 2^31 on its own
+#define _DSM_OVERLOAD_QUANTIZER     (1 << 26)
+#define _DSM_OVERLOAD_INTEGRATOR    0x70000000
+
+#define _DSM_DITHER_MSB             6 //dither is a signed MSB + 1 bit value from the top of each 16 bit half, see dither.h
 
 #if 1
-    #define _DSM_DITHER_MSB             6
     #define _DSM_DITHER_GARBAGE_1(bits) (((int32_t)(bits)) >> (31 - _DSM_DITHER_MSB)) //use top half
     #define _DSM_DITHER_GARBAGE_2(bits) _DSM_DITHER_GARBAGE_1(bits << 16) //use bottom half
 #else
@@ -25,29 +46,69 @@
     #define _DSM_DITHER_GARBAGE_2(bits) (0)
 #endif
 
+//  CIFF modulators of order 2 to DSM_MAX_ORDER, every order is its own set of functions generated from the same
+// always_inline templates with a constant dsm_coefficients_t, so the coefficients are immediates and the
+// order loops are unrolled away - no branches on the order or the coefficients per symbol.
+// The orders share dsm_t, dsm_kernel picks one for a stream. Order 4 is the original design and the only one
+// with dsm_m0.S, the unsuffixed dsm_process_* are order 4
+
+#define DSM_MAX_ORDER 5
+
 typedef struct dsm
 {
     int32_t prevSample;
-    int32_t integrator[4];
+    int32_t integrator[DSM_MAX_ORDER];
     uint32_t prevOutput;
+    int32_t transitionPenalty; //0 is off, see dsm_set_transition_penalty
+    int32_t lookahead;         //0 is off, see dsm_set_lookahead
+    uint32_t overloads;        //blocks that tripped _dsm_check_overload since dsm_init
 
 #ifdef DSM_INTEGRATOR_METRICS //only for local PC simulation
-    int32_t integratorMax[4];
-    int32_t integratorMin[4];
+    int32_t integratorMax[DSM_MAX_ORDER];
+    int32_t integratorMin[DSM_MAX_ORDER];
     int32_t quantizerMax;
     int32_t quantizerMin;
 #endif
 } dsm_t;
 
+#define DSM_NO_COEFFICIENT (-1)
+
+//  all coefficients are powers of two, stored as right shifts. b is 1 into the first integrator and the quantizer
+// and 0 elsewhere. c is 1 unless set: later integrators of high orders outgrow 32 bits and are kept scaled down
+typedef struct dsm_coefficients
+{
+    int order;
+    int8_t a[DSM_MAX_ORDER];    //quantizer input += integrator[i] >> a[i]
+    int8_t c[DSM_MAX_ORDER];    //integrator[i] += integrator[i - 1] >> c[i], c[0] unused
+    int8_t g[DSM_MAX_ORDER];    //resonator, integrator[i] -= integrator[i + 1] >> g[i]
+    int8_t leak[DSM_MAX_ORDER]; //integrator[i] -= integrator[i] >> leak[i]
+} dsm_coefficients_t;
+
+#include "dsmCoefficients.h"
+
+//  dsm_m0.S does the same as _dsm_calculate_block16 for order 4 with the state kept in registers,
+// host builds can define DSM_ASM_KERNEL to run it in an emulator (see host/dsm_m0_glue.c)
+#if defined(__ARM_ARCH_6M__) && !defined(DSM_INTEGRATOR_METRICS) && !defined(DSM_NO_ASM_KERNEL)
+    #define DSM_ASM_KERNEL
+#endif
+
+#ifdef DSM_ASM_KERNEL
+uint32_t _dsm_calculate_block16_m0(dsm_t* ptr, int32_t sample, int32_t step);
+#endif
+
 static void dsm_init(dsm_t* ptr)
 {
     ptr->prevSample = 0;
     ptr->prevOutput = 0xFFFFFFFF;
-    memset(ptr->integrator, 0, sizeof(int32_t) * 4);
+    ptr->transitionPenalty = 0;
+    ptr->lookahead = 0;
+    ptr->overloads = 0;
+    memset(ptr->integrator, 0, sizeof(ptr->integrator));
 
 #ifdef DSM_INTEGRATOR_METRICS
-    memset(ptr->integratorMax, 0, sizeof(int32_t) * 4);
-    memset(ptr->integratorMin, 0, sizeof(int32_t) * 4);
+    memset(ptr->integratorMax, 0, sizeof(ptr->integratorMax));
+    memset(ptr->integratorMin, 0, sizeof(ptr->integratorMin));
+    ptr->quantizerMax = ptr->quantizerMin = 0;
 #endif
 }
 
@@ -56,79 +117,119 @@ static inline void dsm_reset(dsm_t* ptr)
     dsm_init(ptr);
 }
 
-//a = [1, 1/4, 1/16, 1/128];
-//b = [1, 0, 0, 0, 1];
-//c = [1, 1, 1, 1];
-//g = [1/1024, 1/128];
+//  transition-aware quantizing: both decision levels move by penalty away from the previous state, toward it when
+// they would keep it, so every change of the bridge state takes that much more than the dead band alone.
+// runs that only trade gate charge for a little in-band noise go away, the loop shapes the extra error like any other.
+// the short pulse feedback already accounts for the dead time of every change.
+// 0 (dsm_init) is off and order 4 runs dsm_m0.S, with a penalty every order runs the C loop
+static inline void dsm_set_transition_penalty(dsm_t* ptr, int32_t penalty)
+{
+    ptr->transitionPenalty = penalty;
+}
 
-#define _DSM_A1(a) ((a))
-#define _DSM_A2(a) ((a) >> 2)
-#define _DSM_A3(a) ((a) >> 4)
-#define _DSM_A4(a) ((a) >> 8)
+#define DSM_MAX_LOOKAHEAD 8
 
-#define _DSM_B1(a) ((a))
-#define _DSM_B2(a) (0)
-#define _DSM_B3(a) (0)
-#define _DSM_B4(a) (0)
-#define _DSM_B5(a) ((a))
+//  look-ahead quantizing: every symbol tries the plain decision and the next level toward the quantizer input,
+// runs a copy of the loop depth more symbols ahead with plain decisions on the same input ramp for both
+// and keeps the one with the smaller sum of squared quantizer errors. a pruned tree, two branches at the root and
+// greedy below: 2 * (depth + 1) runs of the loop per symbol instead of the 3^depth of a full trellis.
+// what it buys is stable input range, +0.25 dB at depth 2 and +0.5 dB at 8 for 1-2 dB of SNR (dsm_bench -l).
+// it cannot be split between the cores, every decision needs the state the one before left.
+// 0 (dsm_init) is off, depth is clamped to DSM_MAX_LOOKAHEAD, with it every order runs the C loop
+static inline void dsm_set_lookahead(dsm_t* ptr, int depth)
+{
+    ptr->lookahead = depth < 0 ? 0 : depth > DSM_MAX_LOOKAHEAD ? DSM_MAX_LOOKAHEAD : depth;
+}
 
-#define _DSM_C1(a) ((a))
-#define _DSM_C2(a) ((a))
-#define _DSM_C3(a) ((a))
-#define _DSM_C4(a) ((a))
+#define _DSM_INLINE static inline __attribute__((always_inline))
 
-#define _DSM_G1(a) ((a) >> 10)
-#define _DSM_G2(a) ((a) >> 7)
+//+1, -1 or 0 for 0b01, 0b10 and 0b00 or the dsm_init value
+#define _DSM_LEVEL(symbol)          ((int32_t)((symbol) & 1) - (int32_t)(((symbol) >> 1) & 1))
 
-//watning: optimizations
-static inline uint32_t _dsm_calculate(dsm_t* ptr, int32_t input)
+_DSM_INLINE int32_t _dsm_quantizer_input(const dsm_t* ptr, int32_t input, const dsm_coefficients_t* k)
 {
-    int32_t quantizerInput = _DSM_A1(ptr->integrator[0]) +
-        _DSM_A2(ptr->integrator[1]) +
-        _DSM_A3(ptr->integrator[2]) +
-        _DSM_A4(ptr->integrator[3]) +
-        _DSM_B5(input);
+    int32_t quantizerInput = input;
 
-#ifdef DSM_INTEGRATOR_METRICS
-    if (quantizerInput > ptr->quantizerMax)
-        ptr->quantizerMax = quantizerInput;
+#pragma GCC unroll 8
+    for (int i = 0; i < k->order; ++i)
+        if (k->a[i] != DSM_NO_COEFFICIENT)
+            quantizerInput += ptr->integrator[i] >> k->a[i];
 
-    if (quantizerInput < ptr->quantizerMin)
-        ptr->quantizerMin = quantizerInput;
-#endif
+    return quantizerInput;
+}
 
-    uint32_t dsmOutput;
-    int32_t quantizerOutput;
+_DSM_INLINE uint32_t _dsm_quantize(const dsm_t* ptr, int32_t quantizerInput, bool penalize)
+{
+    //quantizerInput > up is +1, <= down is -1
+    int32_t up = _DSM_ZERO_THRESHOLD, down = -_DSM_ZERO_THRESHOLD;
 
-    if (quantizerInput <= -_DSM_ZERO_THRESHOLD)
+    if (penalize)
     {
-        dsmOutput = 0b10;
-        quantizerOutput = ptr->prevOutput == dsmOutput 
+        int32_t level = _DSM_LEVEL(ptr->prevOutput);
+        int32_t penalty = ptr->transitionPenalty;
+
+        up += level > 0 ? -penalty : penalty;
+        down += level < 0 ? penalty : -penalty;
+    }
+
+    if (quantizerInput <= down)
+        return 0b10;
+    else if (quantizerInput > up)
+        return 0b01;
+    else
+        return 0b00;
+}
+
+//what the bridge puts out for dsmOutput after prevOutput
+_DSM_INLINE int32_t _dsm_feedback(uint32_t prevOutput, uint32_t dsmOutput)
+{
+    if (dsmOutput == 0b10)
+        return prevOutput == dsmOutput 
             ? -_DSM_INT_MAX 
             : -_DSM_INT_MAX_SHORT_PULSE;
-    }
-    else if (quantizerInput > _DSM_ZERO_THRESHOLD)
-    {
-        dsmOutput = 0b01;
-        quantizerOutput = ptr->prevOutput == dsmOutput 
+    else if (dsmOutput == 0b01)
+        return prevOutput == dsmOutput 
             ? _DSM_INT_MAX 
             : _DSM_INT_MAX_SHORT_PULSE;
-    }
     else 
-    {
-        dsmOutput = 0b00;
-        quantizerOutput = 0;
-    }
+        return 0;
+}
+
+//feedback of dsmOutput and the integrator updates
+_DSM_INLINE void _dsm_update(dsm_t* ptr, int32_t input, uint32_t dsmOutput, const dsm_coefficients_t* k)
+{
+    int32_t quantizerOutput = _dsm_feedback(ptr->prevOutput, dsmOutput);
 
     ptr->prevOutput = dsmOutput;
 
-    ptr->integrator[0] += _DSM_B1(input) - _DSM_C1(quantizerOutput) - _DSM_G1(ptr->integrator[1]);
-    ptr->integrator[1] += _DSM_B2(input) + _DSM_C2(ptr->integrator[0]);
-    ptr->integrator[2] += _DSM_B3(input) + _DSM_C3(ptr->integrator[1]) - _DSM_G2(ptr->integrator[2]);
-    ptr->integrator[3] += _DSM_B4(input) + _DSM_C4(ptr->integrator[2]);
+    //in order, every integrator takes the already updated one before it and the old one after it
+#pragma GCC unroll 8
+    for (int i = 0; i < k->order; ++i)
+    {
+        int32_t delta = i == 0
+            ? input - quantizerOutput
+            : ptr->integrator[i - 1] >> k->c[i];
+
+        if (k->g[i] != DSM_NO_COEFFICIENT && i + 1 < k->order)
+            delta -= ptr->integrator[i + 1] >> k->g[i];
+
+        if (k->leak[i] != DSM_NO_COEFFICIENT)
+            delta -= ptr->integrator[i] >> k->leak[i];
+
+        ptr->integrator[i] += delta;
+    }
+}
 
+_DSM_INLINE void _dsm_metrics(dsm_t* ptr, int32_t quantizerInput, const dsm_coefficients_t* k)
+{
 #ifdef DSM_INTEGRATOR_METRICS
-    for (int i = 0; i < 4; ++i)
+    if (quantizerInput > ptr->quantizerMax)
+        ptr->quantizerMax = quantizerInput;
+
+    if (quantizerInput < ptr->quantizerMin)
+        ptr->quantizerMin = quantizerInput;
+
+    for (int i = 0; i < k->order; ++i)
     {
         if (ptr->integrator[i] > ptr->integratorMax[i])
             ptr->integratorMax[i] = ptr->integrator[i];
@@ -137,52 +238,171 @@ static inline uint32_t _dsm_calculate(dsm_t* ptr, int32_t input)
             ptr->integratorMin[i] = ptr->integrator[i];
     }
 #endif
+}
+
+//watning: optimizations
+_DSM_INLINE uint32_t _dsm_calculate(dsm_t* ptr, int32_t input, const dsm_coefficients_t* k, bool penalize)
+{
+    int32_t quantizerInput = _dsm_quantizer_input(ptr, input, k);
+    uint32_t dsmOutput = _dsm_quantize(ptr, quantizerInput, penalize);
+
+    _dsm_update(ptr, input, dsmOutput, k);
+    _dsm_metrics(ptr, quantizerInput, k);
 
     return dsmOutput;
 }
 
-static uint64_t dsm_process_sample_x32(dsm_t* ptr, int32_t dsmPcm, uint32_t randomBits)
+//  squared quantizer errors of dsmOutput for quantizerInput and depth plain decisions after it on a copy of the state.
+// errors are taken down 8 bits, DSM_MAX_LOOKAHEAD + 1 squares of them stay far below 2^63
+_DSM_INLINE int64_t _dsm_lookahead_cost(const dsm_t* ptr, int32_t quantizerInput, uint32_t dsmOutput, 
+                                        int32_t sample, int32_t step, const dsm_coefficients_t* k, bool penalize)
 {
-    uint32_t retLow = 0, retHigh = 0;
+    dsm_t state = *ptr;
+    int64_t cost = 0;
 
-    //linear interpolation with 1 sample delay
-    int32_t sample = ptr->prevSample + _DSM_DITHER_GARBAGE_1(randomBits);
-    int32_t step = (dsmPcm - sample) >> 5; // / 32
+    for (int i = 0; i <= ptr->lookahead; ++i)
+    {
+        if (i)
+        {
+            quantizerInput = _dsm_quantizer_input(&state, sample, k);
+            dsmOutput = _dsm_quantize(&state, quantizerInput, penalize);
+        }
 
-    ptr->prevSample = dsmPcm;
+        int32_t error = (quantizerInput >> 8) - (_dsm_feedback(state.prevOutput, dsmOutput) >> 8);
+        cost += (int64_t)error * error;
 
-    retHigh |= _dsm_calculate(ptr, sample);
-    sample += step;
+        _dsm_update(&state, sample, dsmOutput, k);
+        sample += step;
+    }
 
-#pragma GCC unroll 16
-    for (int i = 0; i < 15; ++i)
-    {
-        retHigh <<= 2;
+    return cost;
+}
+
+//_dsm_calculate with the input ramp known ahead, see dsm_set_lookahead
+_DSM_INLINE uint32_t _dsm_calculate_lookahead(dsm_t* ptr, int32_t sample, int32_t step, const dsm_coefficients_t* k,
+                                              bool penalize)
+{
+    int32_t quantizerInput = _dsm_quantizer_input(ptr, sample, k);
+    uint32_t dsmOutput = _dsm_quantize(ptr, quantizerInput, penalize);
+
+    //the other side of the nearest decision level
+    uint32_t other = dsmOutput != 0b00 ? 0b00 : quantizerInput > 0 ? 0b01 : 0b10;
+
+    if (_dsm_lookahead_cost(ptr, quantizerInput, other, sample, step, k, penalize) <
+        _dsm_lookahead_cost(ptr, quantizerInput, dsmOutput, sample, step, k, penalize))
+        dsmOutput = other;
+
+    _dsm_update(ptr, sample, dsmOutput, k);
+    _dsm_metrics(ptr, quantizerInput, k);
+
+    return dsmOutput;
+}
+
+//not unrolled, the look-ahead is big enough on its own
+_DSM_INLINE uint32_t _dsm_calculate_block16_lookahead(dsm_t* ptr, int32_t sample, int32_t step, const dsm_coefficients_t* k)
+{
+    bool penalize = ptr->transitionPenalty != 0;
+    uint32_t ret = 0;
 
-        retHigh |= _dsm_calculate(ptr, sample);
+    for (int i = 0; i < 16; ++i)
+    {
+        ret = (ret << 2) | _dsm_calculate_lookahead(ptr, sample, step, k, penalize);
         sample += step;
     }
 
-    sample += _DSM_DITHER_GARBAGE_2(randomBits) - _DSM_DITHER_GARBAGE_1(randomBits); //switch garbage
+    return ret;
+}
 
-    retLow |= _dsm_calculate(ptr, sample);
+_DSM_INLINE uint32_t _dsm_calculate_block16_c(dsm_t* ptr, int32_t sample, int32_t step, const dsm_coefficients_t* k,
+                                               bool penalize)
+{
+    uint32_t ret = _dsm_calculate(ptr, sample, k, penalize);
     sample += step;
 
 #pragma GCC unroll 16
     for (int i = 0; i < 15; ++i)
     {
-        retLow <<= 2;
+        ret <<= 2;
 
-        retLow |= _dsm_calculate(ptr, sample);
+        ret |= _dsm_calculate(ptr, sample, k, penalize);
         sample += step;
     }
 
+    return ret;
+}
+
+//  an overloaded loop does not come back on its own, it rails the output until dsm_reset.
+// the integrators are cleared instead, prevSample and prevOutput stay so the interpolation and the
+// short pulse logic carry on. the loop settles again within a few symbols and it is counted in overloads.
+// ~order * 5 cycles per 16 symbols, a few % of the block
+_DSM_INLINE void _dsm_check_overload(dsm_t* ptr, const dsm_coefficients_t* k)
+{
+    //|x| > limit as one unsigned compare
+    uint32_t bad = (uint32_t)_dsm_quantizer_input(ptr, 0, k) + _DSM_OVERLOAD_QUANTIZER > 2u * _DSM_OVERLOAD_QUANTIZER;
+
+#pragma GCC unroll 8
+    for (int i = 0; i < k->order; ++i)
+        bad |= (uint32_t)ptr->integrator[i] + _DSM_OVERLOAD_INTEGRATOR > 2u * _DSM_OVERLOAD_INTEGRATOR;
+
+    if (__builtin_expect(bad, 0))
+    {
+        memset(ptr->integrator, 0, sizeof(ptr->integrator));
+        ++ptr->overloads;
+    }
+}
+
+_DSM_INLINE uint32_t _dsm_calculate_block16_run(dsm_t* ptr, int32_t sample, int32_t step, const dsm_coefficients_t* k)
+{
+    //decided once per block, the plain loop stays free of it
+    if (ptr->lookahead)
+        return _dsm_calculate_block16_lookahead(ptr, sample, step, k);
+
+    if (ptr->transitionPenalty)
+        return _dsm_calculate_block16_c(ptr, sample, step, k, true);
+
+#ifdef DSM_ASM_KERNEL
+    //the kernel needs a real previous symbol, only the very first block after dsm_init does not have one
+    if (k->order == 4 && ptr->prevOutput <= 0b10)
+        return _dsm_calculate_block16_m0(ptr, sample, step);
+#endif
+
+    return _dsm_calculate_block16_c(ptr, sample, step, k, false);
+}
+
+//16 steps with sample += step after each one, the first symbol ends up in the top bits
+_DSM_INLINE uint32_t _dsm_calculate_block16(dsm_t* ptr, int32_t sample, int32_t step, const dsm_coefficients_t* k)
+{
+    uint32_t ret = _dsm_calculate_block16_run(ptr, sample, step, k);
+
+    _dsm_check_overload(ptr, k);
+
+    return ret;
+}
+
+_DSM_INLINE uint64_t _dsm_process_sample_x32(dsm_t* ptr, int32_t dsmPcm, uint32_t randomBits, const dsm_coefficients_t* k)
+{
+    uint32_t retLow, retHigh;
+
+    //linear interpolation with 1 sample delay
+    int32_t sample = ptr->prevSample + _DSM_DITHER_GARBAGE_1(randomBits);
+    int32_t step = (dsmPcm - sample) >> 5; // / 32
+
+    ptr->prevSample = dsmPcm;
+
+    retHigh = _dsm_calculate_block16(ptr, sample, step, k);
+    sample += 16 * step;
+
+    sample += _DSM_DITHER_GARBAGE_2(randomBits) - _DSM_DITHER_GARBAGE_1(randomBits); //switch garbage
+
+    retLow = _dsm_calculate_block16(ptr, sample, step, k);
+
     return ((uint64_t)retHigh) << 32 | retLow;
 }
 
-static uint64_t dsm_process_sample_x16(dsm_t* ptr, int32_t firstDsmPcm, int32_t secondDsmPcm, uint32_t randomBits)
+_DSM_INLINE uint64_t _dsm_process_sample_x16(dsm_t* ptr, int32_t firstDsmPcm, int32_t secondDsmPcm, uint32_t randomBits,
+                                             const dsm_coefficients_t* k)
 {
-    uint32_t retLow = 0, retHigh = 0;
+    uint32_t retLow, retHigh;
 
     //linear interpolation with 1 sample delay
     int32_t sample = ptr->prevSample + _DSM_DITHER_GARBAGE_1(randomBits);
@@ -190,32 +410,83 @@ static uint64_t dsm_process_sample_x16(dsm_t* ptr, int32_t firstDsmPcm, int32_t
 
     ptr->prevSample = secondDsmPcm;
 
-    retHigh |= _dsm_calculate(ptr, sample);
-    sample += step;
-
-#pragma GCC unroll 16
-    for (int i = 0; i < 15; ++i)
-    {
-        retHigh <<= 2;
-
-        retHigh |= _dsm_calculate(ptr, sample);
-        sample += step;
-    }
+    retHigh = _dsm_calculate_block16(ptr, sample, step, k);
 
     sample = firstDsmPcm + _DSM_DITHER_GARBAGE_2(randomBits);
     step = (secondDsmPcm - sample) >> 4; // / 16
 
-    retLow |= _dsm_calculate(ptr, sample);
-    sample += step;
+    retLow = _dsm_calculate_block16(ptr, sample, step, k);
 
-#pragma GCC unroll 16
-    for (int i = 0; i < 15; ++i)
-    {
-        retLow <<= 2;
+    return ((uint64_t)retHigh) << 32 | retLow;
+}
 
-        retLow |= _dsm_calculate(ptr, sample);
-        sample += step;
-    }
+//  one function set per order: dsm_process_sample_x32_o4, dsm_process_block_x16_o2...
+//
+//  the block versions are for core1: n output words of one channel from interleaved frames,
+// frame i is pcm[i * stride] and its word goes to out[i * stride], so stride 2 picks one half of L/R pairs.
+// random holds one word per output word, the output is bit-exact with n single calls. x16 takes two frames per word
+#define _DSM_DEFINE_ORDER(order)                                                                                            \
+                                                                                                                            \
+static uint64_t dsm_process_sample_x32_o##order(dsm_t* ptr, int32_t dsmPcm, uint32_t randomBits)                            \
+{                                                                                                                           \
+    return _dsm_process_sample_x32(ptr, dsmPcm, randomBits, &dsmCoefficients##order);                                       \
+}                                                                                                                           \
+                                                                                                                            \
+static uint64_t dsm_process_sample_x16_o##order(dsm_t* ptr, int32_t firstDsmPcm, int32_t secondDsmPcm, uint32_t randomBits) \
+{                                                                                                                           \
+    return _dsm_process_sample_x16(ptr, firstDsmPcm, secondDsmPcm, randomBits, &dsmCoefficients##order);                    \
+}                                                                                                                           \
+                                                                                                                            \
+static void dsm_process_block_x32_o##order(dsm_t* ptr, const int32_t* pcm, int stride, int n,                               \
+                                           const uint32_t* random, uint64_t* out)                                           \
+{                                                                                                                           \
+    for (int i = 0; i < n; ++i, pcm += stride, out += stride)                                                               \
+        *out = _dsm_process_sample_x32(ptr, *pcm, random[i], &dsmCoefficients##order);                                      \
+}                                                                                                                           \
+                                                                                                                            \
+static void dsm_process_block_x16_o##order(dsm_t* ptr, const int32_t* pcm, int stride, int n,                               \
+                                           const uint32_t* random, uint64_t* out)                                           \
+{                                                                                                                           \
+    for (int i = 0; i < n; ++i, pcm += 2 * stride, out += stride)                                                           \
+        *out = _dsm_process_sample_x16(ptr, pcm[0], pcm[stride], random[i], &dsmCoefficients##order);                      \
+}
 
-    return ((uint64_t)retHigh) << 32 | retLow;
-}
\ No newline at end of file
+_DSM_DEFINE_ORDER(2)
+_DSM_DEFINE_ORDER(3)
+_DSM_DEFINE_ORDER(4)
+_DSM_DEFINE_ORDER(5)
+
+#define dsm_process_sample_x32  dsm_process_sample_x32_o4
+#define dsm_process_sample_x16  dsm_process_sample_x16_o4
+#define dsm_process_block_x32   dsm_process_block_x32_o4
+#define dsm_process_block_x16   dsm_process_block_x16_o4
+
+typedef struct dsm_kernel
+{
+    int order;
+    const dsm_coefficients_t* coefficients;
+    uint64_t (*sample_x32)(dsm_t* ptr, int32_t dsmPcm, uint32_t randomBits);
+    uint64_t (*sample_x16)(dsm_t* ptr, int32_t firstDsmPcm, int32_t secondDsmPcm, uint32_t randomBits);
+    void (*block_x32)(dsm_t* ptr, const int32_t* pcm, int stride, int n, const uint32_t* random, uint64_t* out);
+    void (*block_x16)(dsm_t* ptr, const int32_t* pcm, int stride, int n, const uint32_t* random, uint64_t* out);
+} dsm_kernel_t;
+
+#define _DSM_KERNEL(order) \
+    { order, &dsmCoefficients##order, dsm_process_sample_x32_o##order, dsm_process_sample_x16_o##order, dsm_process_block_x32_o##order, dsm_process_block_x16_o##order }
+
+static const dsm_kernel_t dsmKernels[] =
+{
+    _DSM_KERNEL(2),
+    _DSM_KERNEL(3),
+    _DSM_KERNEL(4),
+    _DSM_KERNEL(5),
+};
+
+//functions of the given order, out of range falls back to order 4
+static const dsm_kernel_t* dsm_kernel(int order)
+{
+    if (order < 2 || order > DSM_MAX_ORDER)
+        order = 4;
+
+    return &dsmKernels[order - 2];
+}
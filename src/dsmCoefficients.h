@@ -0,0 +1,42 @@
+#pragma once
+
+//  coefficient sets of the dsm.h modulator family, shifts: a = 2^-a[i], DSM_NO_COEFFICIENT is 0.
+// written by host/dsm_search -g, x32 path: the sets with the best 1 kHz -6 dBFS SNR that stay stable with
+// every integrator below 2^31 on clipped two-tone and full-scale sines. order 4 is kept by hand for dsm_m0.S
+
+//searched, SNR 63.2 dB at -6 dBFS, 64.1 dB at 0 dBFS, stable to +1.5 dBFS, integrator headroom 6.36 bits
+static const dsm_coefficients_t dsmCoefficients2 =
+{
+    .order = 2,
+    .a = { 0, 0 },
+    .g = { DSM_NO_COEFFICIENT, DSM_NO_COEFFICIENT },
+    .leak = { DSM_NO_COEFFICIENT, DSM_NO_COEFFICIENT },
+};
+
+//searched, SNR 75.9 dB at -6 dBFS, 77.9 dB at 0 dBFS, stable to +2.0 dBFS, integrator headroom 5.03 bits
+static const dsm_coefficients_t dsmCoefficients3 =
+{
+    .order = 3,
+    .a = { 0, 2, 4 },
+    .g = { 8, DSM_NO_COEFFICIENT, DSM_NO_COEFFICIENT },
+    .leak = { DSM_NO_COEFFICIENT, DSM_NO_COEFFICIENT, 8 },
+};
+
+//kept, SNR 71.7 dB at -6 dBFS, 73.5 dB at 0 dBFS, stable to +1.5 dBFS, integrator headroom 1.37 bits
+static const dsm_coefficients_t dsmCoefficients4 =
+{
+    .order = 4,
+    .a = { 0, 2, 4, 8 },
+    .g = { 10, DSM_NO_COEFFICIENT, DSM_NO_COEFFICIENT, DSM_NO_COEFFICIENT },
+    .leak = { DSM_NO_COEFFICIENT, DSM_NO_COEFFICIENT, 7, DSM_NO_COEFFICIENT },
+};
+
+//searched, SNR 85.7 dB at -6 dBFS, 84.4 dB at 0 dBFS, stable to +0.0 dBFS, integrator headroom 0.39 bits
+static const dsm_coefficients_t dsmCoefficients5 =
+{
+    .order = 5,
+    .a = { 0, 1, 4, 7, 5 },
+    .c = { 0, 0, 0, 0, 5 },
+    .g = { 9, DSM_NO_COEFFICIENT, 7, DSM_NO_COEFFICIENT, DSM_NO_COEFFICIENT },
+    .leak = { DSM_NO_COEFFICIENT, DSM_NO_COEFFICIENT, DSM_NO_COEFFICIENT, DSM_NO_COEFFICIENT, DSM_NO_COEFFICIENT },
+};
@@ -0,0 +1,79 @@
+#pragma once
+
+//  UAC2 explicit feedback for the asynchronous ISO OUT endpoint: how many frames the host should send per USB frame,
+// 16.16 fixed point, the format tud_audio_n_fb_set takes since tinyUSB 0.14 - it sends the 10.14 full-speed wants
+// by itself. the device clock plays, the host follows it.
+//
+// updated at every feedback interval (SOF) from the pcmRing fill level: a one-pole filter takes out the packet
+// and core1 block steps, then a PI loop holds the level at the target. the integral part ends up holding the
+// clock difference (100 ppm is ~315 units at 48 kHz), the proportional part pulls the level back in ~64 ms.
+// the frame number tells how many USB frames passed, a missed SOF does not slow the integral down
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define FEEDBACK_FRACTION_BITS  16  //16.16, frames per 1 ms USB frame
+#define FEEDBACK_FILL_SHIFT     3   //fill level filter, 8 frames
+#define FEEDBACK_KP_SHIFT       6   //65536 >> 6 = 1024 units per frame of error, 64 ms time constant
+#define FEEDBACK_KI_SHIFT       14  //4 units (one full-speed 10.14 unit) per frame of error and USB frame
+#define FEEDBACK_INTEGRAL_BITS  8   //below the 16.16 units, so small errors still move the integral
+#define FEEDBACK_RANGE_SHIFT    7   //the answer stays within 1/128 of the nominal rate, under the one spare frame of TUD_AUDIO_EP_SIZE
+
+typedef struct feedback
+{
+    int32_t nominal;    //16.16
+    int32_t target;     //fill level, frames << FEEDBACK_FILL_SHIFT
+    int32_t fill;       //filtered, frames << FEEDBACK_FILL_SHIFT
+    int32_t integral;   //16.16 << FEEDBACK_INTEGRAL_BITS
+    uint32_t lastFrame;
+    bool started;
+} feedback_t;
+
+static void feedback_init(feedback_t* ptr, uint32_t sampleRate, int targetFrames)
+{
+    ptr->nominal = (int32_t)(((uint64_t)sampleRate << FEEDBACK_FRACTION_BITS) / 1000);
+    ptr->target = ptr->fill = targetFrames << FEEDBACK_FILL_SHIFT;
+    ptr->integral = 0;
+    ptr->lastFrame = 0;
+    ptr->started = false;
+}
+
+//  fillFrames is the pcmRing level in input frames, frameNumber the 11 bit USB frame number of the SOF.
+// returns the 16.16 value for tud_audio_n_fb_set
+static uint32_t feedback_update(feedback_t* ptr, int fillFrames, uint32_t frameNumber)
+{
+    int32_t frames = ptr->started ? (int32_t)((frameNumber - ptr->lastFrame) & 0x7FF) : 1;
+
+    //a gap that long is a stalled bus rather than missed SOFs, and the integral step below must not overflow
+    if (frames > 8)
+        frames = 8;
+
+    ptr->lastFrame = frameNumber;
+    ptr->started = true;
+
+    ptr->fill += (int32_t)((fillFrames << FEEDBACK_FILL_SHIFT) - ptr->fill) >> FEEDBACK_FILL_SHIFT;
+
+    //positive: fuller than the target, ask for less
+    int32_t error = ptr->fill - ptr->target;
+
+    ptr->integral -= frames * (error << (FEEDBACK_FRACTION_BITS + FEEDBACK_INTEGRAL_BITS - FEEDBACK_KI_SHIFT - FEEDBACK_FILL_SHIFT));
+
+    int32_t range = ptr->nominal >> FEEDBACK_RANGE_SHIFT;
+    int32_t integralLimit = range << FEEDBACK_INTEGRAL_BITS;
+
+    //no windup past what the answer can use
+    if (ptr->integral > integralLimit)
+        ptr->integral = integralLimit;
+    else if (ptr->integral < -integralLimit)
+        ptr->integral = -integralLimit;
+
+    int32_t value = ptr->nominal + (ptr->integral >> FEEDBACK_INTEGRAL_BITS)
+        - (error << (FEEDBACK_FRACTION_BITS - FEEDBACK_KP_SHIFT - FEEDBACK_FILL_SHIFT));
+
+    if (value > ptr->nominal + range)
+        value = ptr->nominal + range;
+    else if (value < ptr->nominal - range)
+        value = ptr->nominal - range;
+
+    return (uint32_t)value;
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+//  per channel volume: volumeLut.h Q15 gain applied with two multiplies and shifts instead of a divide,
+// ramped per sample toward the target so volume and mute changes do not step
+//
+// GAIN_RAMP_EXPONENTIAL   moves 1/2^GAIN_RAMP_SHIFT of the remaining distance per sample, a one-pole
+//                         smoother - steps of any size settle in the same time, ~5 time constants
+// otherwise linear        fixed GAIN_RAMP_LINEAR_STEP per sample, full scale in GAIN_RAMP_LINEAR_SAMPLES
+//
+// the ramp runs GAIN_RAMP_FRACTION_BITS below Q15 so slow exponential tails still move
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "dacamp.h"
+#include "volumeLut.h"
+
+#define GAIN_RAMP_EXPONENTIAL
+#define GAIN_RAMP_SHIFT             7   //time constant of 128 samples, 2.7 ms at 48 kHz
+#define GAIN_RAMP_LINEAR_SAMPLES    512 //0 dB to mute in 10.7 ms at 48 kHz
+
+#define GAIN_RAMP_FRACTION_BITS     8
+#define GAIN_RAMP_LINEAR_STEP       ((1 << (VOLUME_LUT_Q + GAIN_RAMP_FRACTION_BITS)) / GAIN_RAMP_LINEAR_SAMPLES)
+
+#define GAIN_UNITY                  (1 << VOLUME_LUT_Q)
+
+typedef struct gain
+{
+    int32_t current;    //Q15 << GAIN_RAMP_FRACTION_BITS
+    int32_t target;
+} gain_t;
+
+//Q15 gain for a UAC2 volume (1/256 dB) and mute, DACAMP_MIN_VOLUME_UAC2 and below is mute
+static inline int32_t gain_from_uac2(int32_t volume, bool mute)
+{
+    if (mute || volume <= DACAMP_MIN_VOLUME_UAC2)
+        return 0;
+
+    if (volume >= 0)
+        return GAIN_UNITY;
+
+    return volumeLut[(-volume) >> VOLUME_LUT_STEP_BITS];
+}
+
+//jumps straight to gainQ15, no ramp
+static void gain_init(gain_t* ptr, int32_t gainQ15)
+{
+    ptr->current = ptr->target = gainQ15 << GAIN_RAMP_FRACTION_BITS;
+}
+
+static inline void gain_set_target(gain_t* ptr, int32_t gainQ15)
+{
+    ptr->target = gainQ15 << GAIN_RAMP_FRACTION_BITS;
+}
+
+static inline bool gain_is_ramping(const gain_t* ptr)
+{
+    return ptr->current != ptr->target;
+}
+
+//one sample of the ramp, returns the Q15 gain for this sample
+static inline int32_t gain_next(gain_t* ptr)
+{
+    int32_t diff = ptr->target - ptr->current;
+
+#ifdef GAIN_RAMP_EXPONENTIAL
+    int32_t step = diff >> GAIN_RAMP_SHIFT;
+
+    //less than 2^GAIN_RAMP_SHIFT away is well below one Q15 step, snap
+    if (step == 0 || step == -1)
+        step = diff;
+#else
+    int32_t step = diff;
+
+    if (step > GAIN_RAMP_LINEAR_STEP)
+        step = GAIN_RAMP_LINEAR_STEP;
+    else if (step < -GAIN_RAMP_LINEAR_STEP)
+        step = -GAIN_RAMP_LINEAR_STEP;
+#endif
+
+    ptr->current += step;
+
+    return ptr->current >> GAIN_RAMP_FRACTION_BITS;
+}
+
+static inline int32_t gain_current(const gain_t* ptr)
+{
+    return ptr->current >> GAIN_RAMP_FRACTION_BITS;
+}
+
+//  sample * gainQ15 >> 15 without a 64 bit product: sample is DSM input (below 2^23),
+// the top part times the gain stays below 2^31 and the low 7 bits are added back separately
+static inline int32_t gain_apply(int32_t sample, int32_t gainQ15)
+{
+    return ((sample >> 7) * gainQ15 + (((sample & 0x7F) * gainQ15) >> 7)) >> 8;
+}
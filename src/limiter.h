@@ -0,0 +1,133 @@
+#pragma once
+
+//  stereo-linked look-ahead peak limiter for DSM input frames (see pcmConvert.h), core0 after the gain stage.
+// PCM is converted at DSM_INT16/24_TO_INT32_UNITY scale, full scale at _DSM_INT_MAX, and only the peaks above
+// DSM_INPUT_CEILING (the old 45/64 scaling, what every modulator order takes) get gain reduction:
+// everything below it plays 3 dB louder than with the fixed scaling, a full scale master keeps the old level at its peaks
+//
+// frames leave lookahead frames (1 ms) late. a peak entering the delay line starts a linear ramp that gets the gain
+// down to what it needs before it leaves, any lower one on the way steepens the ramp. the gain holds as long as
+// anything in the delay line is above the ceiling, then releases exponentially. the ramp rounds toward less gain and
+// the output is clamped to the ceiling, so nothing above it ever reaches the modulator from here.
+// the halfband.h interpolator after it can overshoot a limited peak by a fraction of a dB,
+// orders 2-4 are stable 1.5 dB above the ceiling and _dsm_check_overload catches the rest
+
+#include <stdint.h>
+#include <string.h>
+
+#include "pcmConvert.h"
+
+#define LIMITER_MAX_LOOKAHEAD   96  //frames, 1 ms at 96 kHz
+#define LIMITER_FRACTION_BITS   8   //below Q15 like gain.h, slow releases still move
+#define LIMITER_RELEASE_SHIFT   11  //time constant of 2048 frames, 43 ms at 48 kHz
+
+#define LIMITER_UNITY           (GAIN_UNITY << LIMITER_FRACTION_BITS)
+
+typedef struct limiter
+{
+    uint64_t delay[LIMITER_MAX_LOOKAHEAD];
+    int idx;
+    int lookahead;
+
+    int32_t current;    //Q15 << LIMITER_FRACTION_BITS
+    int32_t target;     //the lowest gain anything in the delay line needs
+    int32_t step;       //per frame while current is above target
+    int hold;           //frames until the last frame above the ceiling leaves
+    uint32_t overs;     //frames that needed gain reduction, since limiter_init
+} limiter_t;
+
+//lookahead frames of delay, up to LIMITER_MAX_LOOKAHEAD
+static void limiter_init(limiter_t* ptr, int lookahead)
+{
+    memset(ptr->delay, 0, sizeof(ptr->delay));
+    ptr->idx = 0;
+    ptr->lookahead = lookahead > LIMITER_MAX_LOOKAHEAD ? LIMITER_MAX_LOOKAHEAD : lookahead < 1 ? 1 : lookahead;
+
+    ptr->current = ptr->target = LIMITER_UNITY;
+    ptr->step = 0;
+    ptr->hold = 0;
+    ptr->overs = 0;
+}
+
+static inline int32_t _limiter_clamp(int32_t sample)
+{
+    return sample > DSM_INPUT_CEILING ? DSM_INPUT_CEILING : sample < -DSM_INPUT_CEILING ? -DSM_INPUT_CEILING : sample;
+}
+
+//  gain envelope for a frame with peak entering the delay line, returns the Q15 gain for the frame leaving it.
+// the ceiling over the peak is one 32 bit divide (the rp2040 divider), only for frames above the ceiling
+static inline int32_t _limiter_next(limiter_t* ptr, uint32_t peak)
+{
+    if (__builtin_expect(peak > DSM_INPUT_CEILING, 0))
+    {
+        //Q15, peak is below 2^24 so the divisor keeps 16 bits
+        int32_t needed = (int32_t)(((uint32_t)DSM_INPUT_CEILING << 8) / (peak >> 7)) << LIMITER_FRACTION_BITS;
+
+        if (needed < ptr->target)
+        {
+            int32_t step = (ptr->current - needed) / ptr->lookahead + 1;
+
+            ptr->target = needed;
+
+            if (step > ptr->step)
+                ptr->step = step;
+        }
+
+        ptr->hold = ptr->lookahead;
+        ++ptr->overs;
+    }
+    else if (ptr->hold)
+        --ptr->hold;
+    else if (ptr->target != LIMITER_UNITY)
+    {
+        int32_t step = (LIMITER_UNITY - ptr->target) >> LIMITER_RELEASE_SHIFT;
+        ptr->target += step ? step : LIMITER_UNITY - ptr->target;
+    }
+
+    if (ptr->current > ptr->target)
+    {
+        ptr->current -= ptr->step;
+
+        if (ptr->current <= ptr->target)
+        {
+            ptr->current = ptr->target;
+            ptr->step = 0;
+        }
+    }
+    else
+        ptr->current = ptr->target;
+
+    return ptr->current >> LIMITER_FRACTION_BITS;
+}
+
+//in place, frames come out lookahead frames late
+static void limiter_process(limiter_t* ptr, uint64_t* frames, int count)
+{
+    for (int i = 0; i < count; ++i)
+    {
+        uint64_t frame = frames[i];
+
+        int32_t left = PCM_DSM_LEFT(frame), right = PCM_DSM_RIGHT(frame);
+        uint32_t peakLeft = left < 0 ? -left : left, peakRight = right < 0 ? -right : right;
+
+        int32_t gain = _limiter_next(ptr, peakLeft > peakRight ? peakLeft : peakRight);
+
+        uint64_t delayed = ptr->delay[ptr->idx];
+        ptr->delay[ptr->idx] = frame;
+
+        if (++ptr->idx == ptr->lookahead)
+            ptr->idx = 0;
+
+        left = PCM_DSM_LEFT(delayed);
+        right = PCM_DSM_RIGHT(delayed);
+
+        //at unity only the clamp, which nothing below the ceiling touches
+        if (gain != GAIN_UNITY)
+        {
+            left = gain_apply(left, gain);
+            right = gain_apply(right, gain);
+        }
+
+        frames[i] = PCM_DSM_FRAME(_limiter_clamp(left), _limiter_clamp(right));
+    }
+}
@@ -78,11 +78,24 @@ static uint32_t blink_interval_ms = BLINK_NOT_MOUNTED;
 static int8_t mute[CFG_TUD_AUDIO_FUNC_1_N_CHANNELS_RX + 1];    // +1 for master channel 0
 static int16_t volume[CFG_TUD_AUDIO_FUNC_1_N_CHANNELS_RX + 1]; // +1 for master channel 0
 
-// Buffer for speaker data
-static int32_t spk_buf[CFG_TUD_AUDIO_FUNC_1_EP_OUT_SW_BUF_SZ / 4];
+// audio_task converts straight out of the endpoint FIFO, a frame must never straddle its wrap
+TU_VERIFY_STATIC(CFG_TUD_AUDIO_FUNC_1_EP_OUT_SW_BUF_SZ % 8 == 0, "EP OUT FIFO has to hold whole PCM16 and PCM24 frames");
 
-// Speaker data size received in the last frame
-static int spk_data_size;
+// Received packet sizes, in the order their bytes sit in the EP OUT FIFO
+#define AUDIO_RX_QUEUE_PACKETS 32 // power of two
+
+static uint16_t rx_queue[AUDIO_RX_QUEUE_PACKETS];
+static uint32_t rx_queue_head, rx_queue_tail; // free-running, like spscring.h
+static uint32_t rx_skip_bytes;                // FIFO bytes in front of the queued packets that belong to dropped ones
+
+typedef struct audio_rx_stats
+{
+    uint32_t received;  // OUT packets tinyUSB delivered
+    uint32_t converted; // packets dacamp_pcm_put took whole
+    uint32_t dropped;   // overwritten in the FIFO, out of queue entries or rejected by dacamp_pcm_put
+} audio_rx_stats_t;
+
+static audio_rx_stats_t rx_stats;
 
 // Resolution per format
 const uint8_t sampleLengthPerFormat[CFG_TUD_AUDIO_FUNC_1_N_FORMATS] = {
@@ -96,6 +109,7 @@ static uint32_t currentSampleRate = 48000; // 44100;
 
 void led_blinking_task(void);
 void audio_task(void);
+static void audio_rx_queue_reset(void);
 
 /*------------- MAIN -------------*/
 int main(void)
@@ -320,6 +334,87 @@ bool tud_audio_get_req_entity_cb(uint8_t rhport, tusb_control_request_t const *p
     return false;
 }
 
+// Invoked when audio class specific get request received for an interface
+bool tud_audio_get_req_itf_cb(uint8_t rhport, tusb_control_request_t const *p_request)
+{
+    audio_control_request_t const *request = (audio_control_request_t const *)p_request;
+    uint8_t const itf = tu_u16_low(tu_le16toh(p_request->wIndex));
+
+    // the AC interface header advertises the latency control and nothing else, read only and CUR only
+    if (itf == ITF_NUM_AUDIO_CONTROL && request->bControlSelector == UAC2_AC_LATENCY_CONTROL &&
+        request->bRequest == AUDIO_CS_REQ_CUR)
+    {
+        TU_VERIFY(request->wLength == sizeof(audio_control_cur_4_t));
+
+        audio_control_cur_4_t latency = {(int32_t)tu_htole32(dacamp_get_latency_ns())};
+        TU_LOG1("Get latency %ld ns\r\n", latency.bCur);
+        return tud_audio_buffer_and_schedule_control_xfer(rhport, p_request, &latency, sizeof(latency));
+    }
+
+    TU_LOG1("Get interface request not handled, interface = %u, selector = %u, request = %u\r\n",
+            itf, request->bControlSelector, request->bRequest);
+    return false;
+}
+
+//  vendor requests to the device, there is no vendor interface. SET is OUT with the value in wValue and no data stage,
+// GET is IN and answers 1 byte. e.g. pyusb ctrl_transfer(0x40, VENDOR_REQUEST_LATENCY_PROFILE, DACAMP_LATENCY_LOW, 0)
+enum
+{
+    VENDOR_REQUEST_LATENCY_PROFILE = 1, // dacamp_latency_t, a running stream is flushed to apply it
+    VENDOR_REQUEST_DSM_ORDER = 2,       // 2..DSM_MAX_ORDER, the same
+};
+
+bool tud_vendor_control_xfer_cb(uint8_t rhport, uint8_t stage, tusb_control_request_t const *request)
+{
+    static uint8_t reply;
+
+    if (stage != CONTROL_STAGE_SETUP)
+        return true;
+
+    TU_VERIFY(request->bmRequestType_bit.type == TUSB_REQ_TYPE_VENDOR &&
+              request->bmRequestType_bit.recipient == TUSB_REQ_RCPT_DEVICE);
+
+    uint16_t const value = tu_le16toh(request->wValue);
+    bool const get = request->bmRequestType_bit.direction == TUSB_DIR_IN;
+
+    switch (request->bRequest)
+    {
+    case VENDOR_REQUEST_LATENCY_PROFILE:
+        if (get)
+        {
+            reply = (uint8_t)dacamp_get_latency_profile();
+            return tud_control_xfer(rhport, request, &reply, sizeof(reply));
+        }
+
+        TU_VERIFY(request->wLength == 0 && value < DACAMP_LATENCY_COUNT);
+
+        dacamp_set_latency_profile((dacamp_latency_t)value);
+        dacamp_flush();
+
+        TU_LOG1("Set latency profile %u\r\n", value);
+        return tud_control_status(rhport, request);
+
+    case VENDOR_REQUEST_DSM_ORDER:
+        if (get)
+        {
+            reply = (uint8_t)dacamp_get_dsm_order();
+            return tud_control_xfer(rhport, request, &reply, sizeof(reply));
+        }
+
+        // dacamp_set_dsm_order knows the valid orders
+        TU_VERIFY(request->wLength == 0 && dacamp_set_dsm_order(value));
+
+        dacamp_flush();
+
+        TU_LOG1("Set DSM order %u\r\n", value);
+        return tud_control_status(rhport, request);
+
+    default:
+        TU_LOG1("Vendor request not handled, request = %u\r\n", request->bRequest);
+        return false;
+    }
+}
+
 // Invoked when audio class specific set request received for an entity
 bool tud_audio_set_req_entity_cb(uint8_t rhport, tusb_control_request_t const *p_request, uint8_t *buf)
 {
@@ -348,8 +443,7 @@ bool tud_audio_set_itf_close_EP_cb(uint8_t rhport, tusb_control_request_t const
         blink_interval_ms = BLINK_MOUNTED;
 
         dacamp_stop();
-
-        spk_data_size = 0;
+        audio_rx_queue_reset();
     }
 
     return true;
@@ -370,13 +464,36 @@ bool tud_audio_set_itf_cb(uint8_t rhport, tusb_control_request_t const *p_reques
 
         dacamp_flush();
         dacamp_start(currentSampleRate);
-
-        spk_data_size = 0;
+        audio_rx_queue_reset();
     }
 
     return true;
 }
 
+// Invoked when the streaming alt setting gets activated
+void tud_audio_feedback_params_cb(uint8_t func_id, uint8_t alt_itf, audio_feedback_params_t *feedback_param)
+{
+    (void)func_id;
+    (void)alt_itf;
+
+    // the value comes from the dacamp buffer level, not from the stack counting clocks
+    feedback_param->method = AUDIO_FEEDBACK_METHOD_DISABLED;
+    feedback_param->sample_freq = currentSampleRate;
+}
+
+// Invoked every feedback interval (1 ms) from the SOF interrupt
+void tud_audio_feedback_interval_isr(uint8_t func_id, uint32_t frame_number, uint8_t interval_shift)
+{
+    (void)interval_shift;
+
+    //  16.16 since tinyUSB 0.14, which converts it to 10.14 on full speed by itself. older versions sent the value as is,
+    // TUSB_VERSION_* pin it
+    TU_VERIFY_STATIC(TUSB_VERSION_MAJOR > 0 || TUSB_VERSION_MINOR >= 14, "tud_audio_n_fb_set has to take 16.16");
+
+    tud_audio_n_fb_set(func_id, dacamp_get_feedback(frame_number));
+}
+
+// Invoked after every OUT packet landed in the EP OUT FIFO, audio_task reads it from there
 bool tud_audio_rx_done_pre_read_cb(uint8_t rhport, uint16_t n_bytes_received, uint8_t func_id, uint8_t ep_out, uint8_t cur_alt_setting)
 {
     (void)rhport;
@@ -384,23 +501,131 @@ bool tud_audio_rx_done_pre_read_cb(uint8_t rhport, uint16_t n_bytes_received, ui
     (void)ep_out;
     (void)cur_alt_setting;
 
-    spk_data_size = tud_audio_read(spk_buf, n_bytes_received);
+    if (!n_bytes_received)
+        return true;
+
+    ++rx_stats.received;
+
+    if (rx_queue_head - rx_queue_tail == AUDIO_RX_QUEUE_PACKETS)
+    {
+        // out of entries, give up the oldest packet rather than lose track of the FIFO
+        rx_skip_bytes += rx_queue[rx_queue_tail++ % AUDIO_RX_QUEUE_PACKETS];
+        ++rx_stats.dropped;
+    }
+
+    rx_queue[rx_queue_head++ % AUDIO_RX_QUEUE_PACKETS] = n_bytes_received;
 
     return true;
 }
 
+static void audio_rx_queue_reset(void)
+{
+    rx_queue_tail = rx_queue_head;
+    rx_skip_bytes = 0;
+}
+
 //--------------------------------------------------------------------+
 // AUDIO Task
 //--------------------------------------------------------------------+
 
+//  received packets stay in the endpoint FIFO until here, however many tud_task delivered since the last call.
+// dacamp_pcm_put converts each from the FIFO memory straight into its ring, at most two runs around the FIFO wrap
 void audio_task(void)
 {
-    if (spk_data_size && (currentSampleLength == 4 || currentSampleLength == 8))
+    tu_fifo_t *ff = tud_audio_get_ep_out_ff();
+
+    tu_fifo_buffer_info_t info;
+    tu_fifo_get_read_info(ff, &info);
+
+    uint32_t available = info.len_lin + info.len_wrap;
+    uint32_t queued = rx_skip_bytes;
+
+    for (uint32_t i = rx_queue_tail; i != rx_queue_head; ++i)
+        queued += rx_queue[i % AUDIO_RX_QUEUE_PACKETS];
+
+    // bytes nobody queued are older than every queued packet, left over from before a reset
+    if (available > queued)
+        rx_skip_bytes += available - queued;
+
+    // audio_task was late and the FIFO overwrote the oldest bytes, the packets they belonged to are lost
+    while (queued > available)
+    {
+        if (!rx_skip_bytes)
+        {
+            rx_skip_bytes = rx_queue[rx_queue_tail++ % AUDIO_RX_QUEUE_PACKETS];
+            ++rx_stats.dropped;
+        }
+
+        uint32_t lost = queued - available;
+
+        if (lost > rx_skip_bytes)
+            lost = rx_skip_bytes;
+
+        rx_skip_bytes -= lost;
+        queued -= lost;
+    }
+
+    if (rx_skip_bytes)
+    {
+        tu_fifo_advance_read_pointer(ff, (uint16_t)rx_skip_bytes);
+        rx_skip_bytes = 0;
+    }
+
+    while (rx_queue_tail != rx_queue_head)
+    {
+        uint16_t bytes = rx_queue[rx_queue_tail++ % AUDIO_RX_QUEUE_PACKETS];
+        int accepted = -1;
+
+        if (currentSampleLength == 4 || currentSampleLength == 8)
+        {
+            tu_fifo_get_read_info(ff, &info);
+
+            uint16_t lin = bytes < info.len_lin ? bytes : info.len_lin;
+
+            accepted = dacamp_pcm_put((const uint32_t *)info.ptr_lin, lin / currentSampleLength, currentSampleLength, volume, mute);
+
+            if (bytes > lin)
+                accepted += dacamp_pcm_put((const uint32_t *)info.ptr_wrap, (bytes - lin) / currentSampleLength, currentSampleLength, volume, mute);
+        }
+
+        tu_fifo_advance_read_pointer(ff, bytes);
+
+        // whatever dacamp_pcm_put rejected is lost, the packet counts as dropped
+        if (accepted >= 0 && accepted == bytes / currentSampleLength)
+            ++rx_stats.converted;
+        else
+            ++rx_stats.dropped;
+    }
+}
+
+// Logged from the blink task, so a print never sits between two packets
+static void audio_rx_stats_log(void)
+{
+    static uint32_t logged_dropped;
+
+    if (rx_stats.dropped != logged_dropped)
     {
-        int ret = dacamp_pcm_put(spk_buf, spk_data_size / currentSampleLength, currentSampleLength, volume, mute);
+        logged_dropped = rx_stats.dropped;
+
+        TU_LOG1("Audio packets received %lu, converted %lu, dropped %lu\r\n", rx_stats.received, rx_stats.converted, rx_stats.dropped);
     }
+}
 
-    spk_data_size = 0;
+// Logged from the blink task like rx_stats, whenever a count changed
+static void dacamp_stats_log(void)
+{
+    static uint32_t logged_underruns, logged_overloads;
+
+    uint32_t underruns = dacamp_get_pio_underruns();
+    uint32_t overloads = dacamp_get_dsm_overloads();
+
+    if (underruns != logged_underruns || overloads != logged_overloads)
+    {
+        logged_underruns = underruns;
+        logged_overloads = overloads;
+
+        TU_LOG1("PIO DMA underruns %lu, DSM overloads %lu\r\n", underruns, overloads);
+    }
 }
 
 //--------------------------------------------------------------------+
@@ -421,4 +646,6 @@ void led_blinking_task(void)
     led_state = 1 - led_state;
 
     dacamp_debug_stuff_task();
+    audio_rx_stats_log();
+    dacamp_stats_log();
 }
@@ -0,0 +1,146 @@
+#pragma once
+
+//  USB PCM to DSM input frames, one kernel per format and gain case, picked once per packet by pcm_convert_select.
+// the format and gain checks are out of the frame loop, the loop is unrolled by 4 and writes straight into the ring
+//
+// PCM16: uint32_t per frame, L = sample & 0xFFFF, R = sample >> 16
+// PCM24: uint64_t per frame, 24 bit left aligned in each 32 bit half, L is the low half
+// DSM frame: uint64_t, L = low 32 bits, R = high 32 bits, scaled with DSM_INT16/24_TO_INT32_UNITY and gain.h,
+// limiter.h takes it down to the modulator full scale
+
+#include <stdint.h>
+#include <string.h>
+
+#include "dsm.h"
+#include "gain.h"
+
+#define PCM16_LEFT(pcm)         ((int16_t)(pcm))
+#define PCM16_RIGHT(pcm)        ((int16_t)((pcm) >> 16))
+
+#define PCM24_LEFT(pcm)         (((int32_t)(pcm)) >> 8)
+#define PCM24_RIGHT(pcm)        ((int32_t)((pcm) >> 32) >> 8)
+
+#define PCM_DSM_LEFT(pcm)       ((int32_t)(pcm))
+#define PCM_DSM_RIGHT(pcm)      ((int32_t)((pcm) >> 32))
+#define PCM_DSM_FRAME(left, right)  (((uint64_t)((left) & 0xFFFFFFFF)) | (((uint64_t)((right)) << 32)))
+
+typedef void (*pcm_convert_t)(uint64_t* dst, const void* src, int count, gain_t* left, gain_t* right);
+
+typedef enum pcm_gain_case
+{
+    PCM_GAIN_UNITY,     //both channels at 0 dB, nothing to multiply
+    PCM_GAIN_FIXED,     //settled gains, one gain_apply per sample
+    PCM_GAIN_RAMP,      //at least one channel still ramping, gain_next per sample
+} pcm_gain_case_t;
+
+#define _PCM_CONVERT_INLINE static inline __attribute__((always_inline))
+
+//sampleSize and gainCase are constants in every caller, the compiler drops the branches
+_PCM_CONVERT_INLINE uint64_t _pcm_convert_frame(const void* src, int i, int sampleSize, pcm_gain_case_t gainCase,
+                                                gain_t* left, gain_t* right, int32_t gainLeft, int32_t gainRight)
+{
+    int32_t sampleLeft, sampleRight;
+
+    if (sampleSize == 4)
+    {
+        uint32_t sample = ((const uint32_t*)src)[i];
+        sampleLeft = DSM_INT16_TO_INT32_UNITY(PCM16_LEFT(sample));
+        sampleRight = DSM_INT16_TO_INT32_UNITY(PCM16_RIGHT(sample));
+    }
+    else
+    {
+        uint64_t sample = ((const uint64_t*)src)[i];
+        sampleLeft = DSM_INT24_TO_INT32_UNITY(PCM24_LEFT(sample));
+        sampleRight = DSM_INT24_TO_INT32_UNITY(PCM24_RIGHT(sample));
+    }
+
+    if (gainCase == PCM_GAIN_FIXED)
+    {
+        sampleLeft = gain_apply(sampleLeft, gainLeft);
+        sampleRight = gain_apply(sampleRight, gainRight);
+    }
+    else if (gainCase == PCM_GAIN_RAMP)
+    {
+        sampleLeft = gain_apply(sampleLeft, gain_next(left));
+        sampleRight = gain_apply(sampleRight, gain_next(right));
+    }
+
+    return PCM_DSM_FRAME(sampleLeft, sampleRight);
+}
+
+_PCM_CONVERT_INLINE void _pcm_convert(uint64_t* dst, const void* src, int count, int sampleSize, pcm_gain_case_t gainCase,
+                                      gain_t* left, gain_t* right)
+{
+    int32_t gainLeft = gain_current(left),
+            gainRight = gain_current(right);
+
+    int i = 0;
+
+    for (; i + 4 <= count; i += 4)
+    {
+        dst[i + 0] = _pcm_convert_frame(src, i + 0, sampleSize, gainCase, left, right, gainLeft, gainRight);
+        dst[i + 1] = _pcm_convert_frame(src, i + 1, sampleSize, gainCase, left, right, gainLeft, gainRight);
+        dst[i + 2] = _pcm_convert_frame(src, i + 2, sampleSize, gainCase, left, right, gainLeft, gainRight);
+        dst[i + 3] = _pcm_convert_frame(src, i + 3, sampleSize, gainCase, left, right, gainLeft, gainRight);
+    }
+
+    for (; i < count; ++i)
+        dst[i] = _pcm_convert_frame(src, i, sampleSize, gainCase, left, right, gainLeft, gainRight);
+}
+
+//both channels settled at 0 gain, the format does not matter
+static void pcm_convert_mute(uint64_t* dst, const void* src, int count, gain_t* left, gain_t* right)
+{
+    memset(dst, 0, count * sizeof(uint64_t));
+}
+
+static void pcm_convert_16_unity(uint64_t* dst, const void* src, int count, gain_t* left, gain_t* right)
+{
+    _pcm_convert(dst, src, count, 4, PCM_GAIN_UNITY, left, right);
+}
+
+static void pcm_convert_16_fixed(uint64_t* dst, const void* src, int count, gain_t* left, gain_t* right)
+{
+    _pcm_convert(dst, src, count, 4, PCM_GAIN_FIXED, left, right);
+}
+
+static void pcm_convert_16_ramp(uint64_t* dst, const void* src, int count, gain_t* left, gain_t* right)
+{
+    _pcm_convert(dst, src, count, 4, PCM_GAIN_RAMP, left, right);
+}
+
+static void pcm_convert_24_unity(uint64_t* dst, const void* src, int count, gain_t* left, gain_t* right)
+{
+    _pcm_convert(dst, src, count, 8, PCM_GAIN_UNITY, left, right);
+}
+
+static void pcm_convert_24_fixed(uint64_t* dst, const void* src, int count, gain_t* left, gain_t* right)
+{
+    _pcm_convert(dst, src, count, 8, PCM_GAIN_FIXED, left, right);
+}
+
+static void pcm_convert_24_ramp(uint64_t* dst, const void* src, int count, gain_t* left, gain_t* right)
+{
+    _pcm_convert(dst, src, count, 8, PCM_GAIN_RAMP, left, right);
+}
+
+//  kernel for sampleSize 4 (PCM16) or 8 (PCM24) and the gains as they are now, after gain_set_target.
+// a ramp that settles inside the packet is finished by the ramp kernel, the next packet gets a settled one
+static pcm_convert_t pcm_convert_select(int sampleSize, const gain_t* left, const gain_t* right)
+{
+    bool pcm16 = sampleSize == 4;
+
+    if (gain_is_ramping(left) || gain_is_ramping(right))
+        return pcm16 ? pcm_convert_16_ramp : pcm_convert_24_ramp;
+
+    int32_t gainLeft = gain_current(left),
+            gainRight = gain_current(right);
+
+    if (!gainLeft && !gainRight)
+        return pcm_convert_mute;
+
+    if (gainLeft == GAIN_UNITY && gainRight == GAIN_UNITY)
+        return pcm16 ? pcm_convert_16_unity : pcm_convert_24_unity;
+
+    return pcm16 ? pcm_convert_16_fixed : pcm_convert_24_fixed;
+}
@@ -0,0 +1,174 @@
+#pragma once
+
+//  DMA ring feeding a PIO state machine: the writer puts words into buf, DMA moves them into the TX FIFO
+// paced by the TX DREQ, so the FIFO gets refilled the moment it has room and nobody polls its level
+//
+// RP2040 DMA has no endless mode: transfer counts are finite and a channel can not chain to itself.
+// Two channels read the same ring instead, each does exactly one lap and then triggers the other one -
+// the read address of the finished channel has wrapped back to buf and TRANS_COUNT reloads on every trigger
+//
+// DMA does not stop on an empty ring, it keeps reading. pio_dma_ring_filled zeroes every word DMA has sent,
+// so a reader that runs past head sends 0b00 symbols, the bridge zero state, and never old audio.
+// it follows the read position across laps by the busy channel, which alternates every lap, so a whole lap
+// between two calls is still seen. once DMA is past head it counts an underrun, zeroes the ring and moves
+// the write position to where DMA reads; the writer only has to keep the ring from running dry
+
+#include <string.h>
+
+#include "hardware/dma.h"
+#include "hardware/pio.h"
+
+typedef struct pio_dma_ring
+{
+    uint32_t* buf;          //aligned to its size in bytes
+    uint32_t sizeWords;     //power of two
+    uint32_t head;          //next word to write, free running
+    uint32_t tail;          //words DMA has read as of the last pio_dma_ring_filled, free running
+    uint32_t underruns;     //times DMA ran past head, since init
+    int channel;            //the one that was reading at tail
+    bool running;
+
+    PIO pio;
+    uint sm;
+    int dmaChannel[2];
+} pio_dma_ring_t;
+
+static bool pio_dma_ring_init(pio_dma_ring_t* ring, uint32_t* buf, uint32_t sizeWords, PIO pio, uint sm)
+{
+    ring->buf = buf;
+    ring->sizeWords = sizeWords;
+    ring->head = ring->tail = ring->underruns = 0;
+    ring->channel = 0;
+    ring->running = false;
+
+    memset(buf, 0, sizeWords * sizeof(uint32_t));
+
+    ring->pio = pio;
+    ring->sm = sm;
+
+    for (int i = 0; i < 2; ++i)
+        if ((ring->dmaChannel[i] = dma_claim_unused_channel(false)) < 0)
+            return false;
+
+    return true;
+}
+
+static dma_channel_config _pio_dma_ring_config(pio_dma_ring_t* ring, int i, bool enable)
+{
+    dma_channel_config config = dma_channel_get_default_config(ring->dmaChannel[i]);
+
+    channel_config_set_transfer_data_size(&config, DMA_SIZE_32);
+    channel_config_set_read_increment(&config, true);
+    channel_config_set_write_increment(&config, false);
+    channel_config_set_ring(&config, false, __builtin_ctz(ring->sizeWords * sizeof(uint32_t)));
+    channel_config_set_dreq(&config, pio_get_dreq(ring->pio, ring->sm, true));
+    channel_config_set_chain_to(&config, ring->dmaChannel[i ^ 1]);
+    channel_config_set_irq_quiet(&config, true);
+    channel_config_set_enable(&config, enable);
+
+    return config;
+}
+
+//starts sending from buf[0], whatever was put since the last stop is already there
+static void pio_dma_ring_start(pio_dma_ring_t* ring)
+{
+    for (int i = 0; i < 2; ++i)
+    {
+        dma_channel_config config = _pio_dma_ring_config(ring, i, true);
+
+        dma_channel_configure(ring->dmaChannel[i], &config,
+                              &ring->pio->txf[ring->sm],   // write to the state machine
+                              ring->buf,                    // read the ring
+                              ring->sizeWords,              // one lap, then the other channel
+                              false);                       // do not start
+    }
+
+    ring->running = true;
+
+    dma_channel_start(ring->dmaChannel[0]);
+}
+
+//stops DMA and empties the ring, the next start sends zero state past whatever gets put before it
+static void pio_dma_ring_stop(pio_dma_ring_t* ring)
+{
+    //disabled first so the abort of one channel can not trigger the other one
+    for (int i = 0; i < 2; ++i)
+    {
+        dma_channel_config config = _pio_dma_ring_config(ring, i, false);
+        dma_channel_set_config(ring->dmaChannel[i], &config, false);
+    }
+
+    dma_channel_abort(ring->dmaChannel[0]);
+    dma_channel_abort(ring->dmaChannel[1]);
+
+    memset(ring->buf, 0, ring->sizeWords * sizeof(uint32_t));
+
+    ring->head = ring->tail = 0;
+    ring->channel = 0;
+    ring->running = false;
+}
+
+//words waiting to be sent, keep it below sizeWords - a full ring reads as an empty one
+static inline uint32_t pio_dma_ring_filled(pio_dma_ring_t* ring)
+{
+    if (!ring->running)
+        return ring->head - ring->tail;
+
+    uint32_t mask = ring->sizeWords - 1;
+
+    //  only the busy channel has a meaningful count, the other one keeps whatever it stopped at.
+    // neither busy is the lap switch, the next call sees the new lap
+    int channel;
+
+    if (dma_channel_is_busy(ring->dmaChannel[0]))
+        channel = 0;
+    else if (dma_channel_is_busy(ring->dmaChannel[1]))
+        channel = 1;
+    else
+        return ring->head - ring->tail;
+
+    uint32_t remaining = dma_channel_hw_addr(ring->dmaChannel[channel])->transfer_count;
+
+    //a finished count is the start of the other channel's lap
+    if (!remaining)
+    {
+        channel ^= 1;
+        remaining = ring->sizeWords;
+    }
+
+    uint32_t readIdx = ring->sizeWords - remaining;
+    uint32_t read = ring->tail & ~mask;
+
+    //laps begun since the last call, the same channel behind the last position has done two
+    if (channel != ring->channel)
+        read += ring->sizeWords;
+    else if (readIdx < (ring->tail & mask))
+        read += 2 * ring->sizeWords;
+
+    read += readIdx;
+    ring->channel = channel;
+
+    if (read - ring->tail > ring->head - ring->tail)
+    {
+        //DMA went past head, it has been sending zero state since. start over right where it reads
+        ++ring->underruns;
+
+        memset(ring->buf, 0, ring->sizeWords * sizeof(uint32_t));
+        ring->head = read;
+    }
+    else
+    {
+        //sent, a later run past head finds zero state here
+        for (uint32_t i = ring->tail; i != read; ++i)
+            ring->buf[i & mask] = 0;
+    }
+
+    ring->tail = read;
+
+    return ring->head - ring->tail;
+}
+
+static inline void pio_dma_ring_put(pio_dma_ring_t* ring, uint32_t word)
+{
+    ring->buf[ring->head++ & (ring->sizeWords - 1)] = word;
+}
@@ -1,20 +1,33 @@
 #pragma once
 
+//  ROSC entropy for seeding dither.h: the ROSC random bit is read directly, no DMA running in the background.
+// rosc_random_get hashes 64 reads into a word and is only meant for seeding,
+// rosc_random_bit is a single register read, cheap enough to stir the generator once per block
+
 #include "pico/stdlib.h"
 #include "pico/rand.h"
-#include "hardware/dma.h"
-#include "hardware/structs/rosc.h"
 
-#define _ROSC_RANDOM_DMA_CHANNEL_CRC 9
-#define _ROSC_RANDOM_DMA_CHANNEL_STORE 10
-#define _ROSC_RANDOM_DMA_CHANNEL_SIGNAL 11
+#if PICO_NO_HARDWARE
 
-static volatile int32_t roscRandomOne = 1;
-static int roscRandomDiscard;
+// host builds (see /host/) have no ROSC
+static bool rosc_random_init(void)
+{
+    return true;
+}
 
-static volatile int32_t roscRandomOut = 0;
+static uint32_t rosc_random_get(void)
+{
+    return get_rand_32();
+}
+
+static inline uint32_t rosc_random_bit(void)
+{
+    return get_rand_32() & 1;
+}
 
-static volatile int roscRandomDataReady = 0;
+#else
+
+#include "hardware/structs/rosc.h"
 
 static bool _rosc_setup(void)
 {
@@ -40,88 +53,26 @@ static bool _rosc_setup(void)
 
 static bool rosc_random_init(void)
 {
-    if (!_rosc_setup() ||
-        dma_channel_is_claimed(_ROSC_RANDOM_DMA_CHANNEL_CRC) ||
-        dma_channel_is_claimed(_ROSC_RANDOM_DMA_CHANNEL_STORE) ||
-        dma_channel_is_claimed(_ROSC_RANDOM_DMA_CHANNEL_SIGNAL) ||
-        (dma_hw->sniff_ctrl & DMA_SNIFF_CTRL_EN_BITS))
-        return false;
+    return _rosc_setup();
+}
+
+//  back to back random bits are biased and correlated, so 64 of them go through a rotate-xor-multiply hash
+static uint32_t rosc_random_get(void)
+{
+    uint32_t x = 0;
 
-    dma_channel_claim(_ROSC_RANDOM_DMA_CHANNEL_CRC);
-    dma_channel_claim(_ROSC_RANDOM_DMA_CHANNEL_STORE);
-    dma_channel_claim(_ROSC_RANDOM_DMA_CHANNEL_SIGNAL);
-
-    // CRC32 seed
-    dma_hw->sniff_data = get_rand_32();
-
-    dma_sniffer_enable(_ROSC_RANDOM_DMA_CHANNEL_CRC, DMA_SNIFF_CTRL_CALC_VALUE_CRC32, true);
-
-    // CRC channel
-    dma_channel_config dmaCrcConfig = dma_channel_get_default_config(_ROSC_RANDOM_DMA_CHANNEL_CRC);
-
-    channel_config_set_transfer_data_size(&dmaCrcConfig, DMA_SIZE_32);
-    channel_config_set_read_increment(&dmaCrcConfig, false);
-    channel_config_set_write_increment(&dmaCrcConfig, false);
-    channel_config_set_irq_quiet(&dmaCrcConfig, true);
-    channel_config_set_enable(&dmaCrcConfig, true);
-    channel_config_set_sniff_enable(&dmaCrcConfig, true);
-    channel_config_set_chain_to(&dmaCrcConfig, _ROSC_RANDOM_DMA_CHANNEL_STORE);
-    channel_config_set_dreq(&dmaCrcConfig, DREQ_FORCE); // permanent unpaced transfer
-
-    dma_channel_configure(_ROSC_RANDOM_DMA_CHANNEL_CRC,
-                          &dmaCrcConfig,
-                          &roscRandomDiscard,  // discard
-                          &rosc_hw->randombit, // read randombit from ROSC
-                          1,                   // one word per transfer
-                          false);              // do not start
-
-    // store channel
-    dma_channel_config dmaStoreConfig = dma_channel_get_default_config(_ROSC_RANDOM_DMA_CHANNEL_STORE);
-
-    channel_config_set_transfer_data_size(&dmaStoreConfig, DMA_SIZE_32);
-    channel_config_set_read_increment(&dmaStoreConfig, false);
-    channel_config_set_write_increment(&dmaStoreConfig, false);
-    channel_config_set_irq_quiet(&dmaStoreConfig, true);
-    channel_config_set_enable(&dmaStoreConfig, true);
-    channel_config_set_chain_to(&dmaStoreConfig, _ROSC_RANDOM_DMA_CHANNEL_SIGNAL);
-    channel_config_set_dreq(&dmaStoreConfig, DREQ_FORCE); // permanent unpaced transfer
-
-    dma_channel_configure(_ROSC_RANDOM_DMA_CHANNEL_STORE,
-                          &dmaStoreConfig,
-                          &roscRandomOut,      // write to output
-                          &dma_hw->sniff_data, // read from CRC32 sniffer
-                          1,                   // one word per transfer
-                          false);              // do not start
-
-    // signal channel
-    dma_channel_config dmaSignalConfig = dma_channel_get_default_config(_ROSC_RANDOM_DMA_CHANNEL_SIGNAL);
-
-    channel_config_set_transfer_data_size(&dmaSignalConfig, DMA_SIZE_32);
-    channel_config_set_read_increment(&dmaSignalConfig, false);
-    channel_config_set_write_increment(&dmaSignalConfig, false);
-    channel_config_set_irq_quiet(&dmaSignalConfig, true);
-    channel_config_set_enable(&dmaSignalConfig, true);
-    channel_config_set_chain_to(&dmaSignalConfig, _ROSC_RANDOM_DMA_CHANNEL_CRC);
-    channel_config_set_dreq(&dmaSignalConfig, DREQ_FORCE); // permanent unpaced transfer
-
-    dma_channel_configure(_ROSC_RANDOM_DMA_CHANNEL_SIGNAL, 
-                          &dmaSignalConfig,
-                          &roscRandomDataReady, // signal data ready
-                          &roscRandomOne,       // read one
-                          1,                    // one word per transfer
-                          false);               // do not start
-
-    dma_channel_start(_ROSC_RANDOM_DMA_CHANNEL_CRC); // now start
+    for (int i = 0; i < 64; ++i)
+    {
+        x = ((x << 5) | (x >> 27)) ^ (rosc_hw->randombit & 1);
+        x *= 0x9E3779B1;
+    }
 
-    return true;
+    return x;
 }
 
-static int32_t rosc_random_get()
+static inline uint32_t rosc_random_bit(void)
 {
-    while (!roscRandomDataReady)
-        tight_loop_contents();
-
-    roscRandomDataReady = 0;
+    return rosc_hw->randombit & 1;
+}
 
-    return roscRandomOut;
-}
\ No newline at end of file
+#endif
@@ -0,0 +1,137 @@
+#pragma once
+
+//  lock-free single producer / single consumer ring of uint64_t for passing PCM frames between the cores
+//
+// head is only written by the producer and tail only by the consumer, both count up freely and wrap at 2^32,
+// a slot is index & mask so the size has to be a power of two. Neither side ever waits for the other one:
+// the producer sees at worst fewer free slots and the consumer fewer filled ones than there really are
+//
+//  the producer either copies frames in with spscring_put or writes them in place:
+// spscring_reserve gives a contiguous run of free slots, spscring_commit publishes what was written there
+
+#include <memory.h>
+#include <stdint.h>
+
+#include "hardware/sync.h"
+
+typedef struct spscring
+{
+    uint64_t* buf;
+    uint32_t mask;              //sizeElements - 1
+    volatile uint32_t head;     //producer, one past the last written slot
+    volatile uint32_t tail;     //consumer, first unread slot
+} spscring_t;
+
+static void spscring_init(spscring_t* ptr, uint64_t* buf, int sizeElements)
+{
+    ptr->buf = buf;
+    ptr->mask = (uint32_t)sizeElements - 1;
+    ptr->head = ptr->tail = 0;
+}
+
+static inline int spscring_filled_slots(const spscring_t* ptr)
+{
+    return (int)(ptr->head - ptr->tail);
+}
+
+static inline int spscring_free_slots(const spscring_t* ptr)
+{
+    return (int)(ptr->mask + 1 - (ptr->head - ptr->tail));
+}
+
+//producer side
+
+//  up to *count free slots in one piece (less at the wrap or when the ring is fuller),
+// *count is set to what is actually available. Nothing is visible to the consumer until spscring_commit
+static inline uint64_t* spscring_reserve(spscring_t* ptr, int* count)
+{
+    uint32_t head = ptr->head;
+    uint32_t free = ptr->mask + 1 - (head - ptr->tail);
+
+    __mem_fence_acquire(); //the consumer is done with the slots before they are overwritten
+
+    uint32_t idx = head & ptr->mask;
+    uint32_t beforeWrap = ptr->mask + 1 - idx;
+
+    if (free > beforeWrap)
+        free = beforeWrap;
+
+    if ((uint32_t)*count > free)
+        *count = (int)free;
+
+    return ptr->buf + idx;
+}
+
+static inline void spscring_commit(spscring_t* ptr, int count)
+{
+    __mem_fence_release(); //frames land before the new head
+
+    ptr->head += (uint32_t)count;
+}
+
+static int spscring_put(spscring_t* ptr, const uint64_t* buf, int elementCount)
+{
+    int ret = 0;
+
+    //two runs at most, before and after the wrap
+    for (int i = 0; i < 2 && ret < elementCount; ++i)
+    {
+        int count = elementCount - ret;
+        uint64_t* dst = spscring_reserve(ptr, &count);
+
+        if (!count)
+            break;
+
+        memcpy(dst, buf + ret, count * sizeof(uint64_t));
+        spscring_commit(ptr, count);
+
+        ret += count;
+    }
+
+    return ret;
+}
+
+//producer position for spscring_discard
+static inline uint32_t spscring_head(const spscring_t* ptr)
+{
+    return ptr->head;
+}
+
+//consumer side
+
+static int spscring_get(spscring_t* ptr, void* buf, int elementCount)
+{
+    uint32_t tail = ptr->tail;
+    uint32_t filled = ptr->head - tail;
+
+    __mem_fence_acquire(); //frames are read only after the head that published them
+
+    int ret = (uint32_t)elementCount > filled
+        ? (int)filled
+        : elementCount;
+
+    uint32_t idx = tail & ptr->mask;
+    int beforeWrap = (int)(ptr->mask + 1 - idx);
+
+    if (beforeWrap >= ret)
+        memcpy(buf, ptr->buf + idx, ret * sizeof(uint64_t));
+    else
+    {
+        memcpy(buf, ptr->buf + idx, beforeWrap * sizeof(uint64_t));
+        memcpy((char*)buf + beforeWrap * sizeof(uint64_t), ptr->buf, (ret - beforeWrap) * sizeof(uint64_t));
+    }
+
+    __mem_fence_release(); //reads are done before the slots are handed back
+
+    ptr->tail = tail + (uint32_t)ret;
+
+    return ret;
+}
+
+//  drops everything up to head, a spscring_head value the producer took earlier.
+// this is the clear of the lock-free ring: only the consumer may move tail
+static inline void spscring_discard(spscring_t* ptr, uint32_t head)
+{
+    if ((int32_t)(head - ptr->tail) > 0)
+        ptr->tail = head;
+}
@@ -78,14 +78,15 @@ uint8_t const *tud_descriptor_device_cb(void)
 #define CONFIG_TOTAL_LEN (TUD_CONFIG_DESC_LEN + CFG_TUD_AUDIO * TUD_AUDIO_DAC_AMP_STEREO_DESC_LEN)
 
 #define EPNUM_AUDIO_OUT 0x01
+#define EPNUM_AUDIO_FB  0x01 //IN, same number as the data endpoint it belongs to
 
 uint8_t const desc_configuration[] =
 {
     // Interface count, string index, total length, attribute, power in mA
     TUD_CONFIG_DESCRIPTOR(1, ITF_NUM_TOTAL, 0, CONFIG_TOTAL_LEN, 0x00, 100),
 
-    // Interface number, string index, EP Out & EP In address, EP size
-    TUD_AUDIO_DAC_AMP_STEREO_DESCRIPTOR(2, EPNUM_AUDIO_OUT, EPNUM_AUDIO_IN | 0x80)
+    // Interface number, string index, EP Out & feedback EP In address
+    TUD_AUDIO_DAC_AMP_STEREO_DESCRIPTOR(2, EPNUM_AUDIO_OUT, EPNUM_AUDIO_FB | 0x80)
 };
 
 // Invoked when received GET CONFIGURATION DESCRIPTOR
@@ -1,230 +1,420 @@
-#include <stdint.h>
-
-// import numpy as np
-// from fractions import Fraction
-
-// def approximate_fraction(value, max_numerator):
-//     frac = Fraction(1/value).limit_denominator(max_denominator=max_numerator)
-//     return Fraction(frac.denominator, frac.numerator)
-
-// dbValues = np.arange(0, -50, -0.5)
-// multipliers = 10 ** (dbValues / 20)
-// fractions = [approximate_fraction(m, 128) for m in multipliers]
+#pragma once
 
-// print('numerators:')
+#include <stdint.h>
 
-// for db, multiplier, fraction in zip(dbValues, multipliers, fractions):
-//    print(f'    {fraction.numerator:>4}, // {db:>5} dB: {multiplier:.5f} ~ {fraction:.5f} = {fraction.numerator}/{fraction.denominator}')
+//  Q15 gain per 1/8 dB of attenuation, 0 .. -49.875 dB, applied with multiplies and shifts by gain.h.
+// the index is -volume >> VOLUME_LUT_STEP_BITS with volume in UAC2 units of 1/256 dB
 
-// print('denominators:')
+#define VOLUME_LUT_STEP_BITS    5
+#define VOLUME_LUT_Q            15
+#define VOLUME_LUT_LENGTH       400
 
-// for db, multiplier, fraction in zip(dbValues, multipliers, fractions):
-//     print(f'    {fraction.denominator:>8}, // {db:>5} dB: {multiplier:.5f} ~ {fraction:.5f} = {fraction.numerator}/{fraction.denominator}')
+// committed rather than generated by the build, pcm_bench -c (ctest) recomputes it:
+// for i in range(400):
+//     db = -i / 8
+//     gain = round(2 ** 15 * 10 ** (db / 20))
+//     print(f'    {gain:>5}, // {db:>7.3f} dB: {gain / 2 ** 15:.5f}')
 
-static const int32_t volumeLutNumerator[100] = 
+static const uint16_t volumeLut[VOLUME_LUT_LENGTH] = 
 {
-    1,   //   0.0 dB: 1.00000 ~ 1.00000 = 1/1
-    118, //  -0.5 dB: 0.94406 ~ 0.94400 = 118/125
-    41,  //  -1.0 dB: 0.89125 ~ 0.89130 = 41/46
-    122, //  -1.5 dB: 0.84140 ~ 0.84138 = 122/145
-    112, //  -2.0 dB: 0.79433 ~ 0.79433 = 112/141
-    3,   //  -2.5 dB: 0.74989 ~ 0.75000 = 3/4
-    80,  //  -3.0 dB: 0.70795 ~ 0.70796 = 80/113
-    127, //  -3.5 dB: 0.66834 ~ 0.66842 = 127/190
-    53,  //  -4.0 dB: 0.63096 ~ 0.63095 = 53/84
-    109, //  -4.5 dB: 0.59566 ~ 0.59563 = 109/183
-    122, //  -5.0 dB: 0.56234 ~ 0.56221 = 122/217
-    43,  //  -5.5 dB: 0.53088 ~ 0.53086 = 43/81
-    128, //  -6.0 dB: 0.50119 ~ 0.50196 = 128/255
-    97,  //  -6.5 dB: 0.47315 ~ 0.47317 = 97/205
-    88,  //  -7.0 dB: 0.44668 ~ 0.44670 = 88/197
-    35,  //  -7.5 dB: 0.42170 ~ 0.42169 = 35/83
-    84,  //  -8.0 dB: 0.39811 ~ 0.39810 = 84/211
-    56,  //  -8.5 dB: 0.37584 ~ 0.37584 = 56/149
-    11,  //  -9.0 dB: 0.35481 ~ 0.35484 = 11/31
-    68,  //  -9.5 dB: 0.33497 ~ 0.33498 = 68/203
-    37,  // -10.0 dB: 0.31623 ~ 0.31624 = 37/117
-    123, // -10.5 dB: 0.29854 ~ 0.29854 = 123/412
-    104, // -11.0 dB: 0.28184 ~ 0.28184 = 104/369
-    120, // -11.5 dB: 0.26607 ~ 0.26608 = 120/451
-    53,  // -12.0 dB: 0.25119 ~ 0.25118 = 53/211
-    106, // -12.5 dB: 0.23714 ~ 0.23714 = 106/447
-    15,  // -13.0 dB: 0.22387 ~ 0.22388 = 15/67
-    108, // -13.5 dB: 0.21135 ~ 0.21135 = 108/511
-    84,  // -14.0 dB: 0.19953 ~ 0.19952 = 84/421
-    68,  // -14.5 dB: 0.18836 ~ 0.18837 = 68/361
-    77,  // -15.0 dB: 0.17783 ~ 0.17783 = 77/433
-    23,  // -15.5 dB: 0.16788 ~ 0.16788 = 23/137
-    42,  // -16.0 dB: 0.15849 ~ 0.15849 = 42/265
-    79,  // -16.5 dB: 0.14962 ~ 0.14962 = 79/528
-    88,  // -17.0 dB: 0.14125 ~ 0.14125 = 88/623
-    2,   // -17.5 dB: 0.13335 ~ 0.13333 = 2/15
-    88,  // -18.0 dB: 0.12589 ~ 0.12589 = 88/699
-    128, // -18.5 dB: 0.11885 ~ 0.11885 = 128/1077
-    80,  // -19.0 dB: 0.11220 ~ 0.11220 = 80/713
-    59,  // -19.5 dB: 0.10593 ~ 0.10592 = 59/557
-    1,   // -20.0 dB: 0.10000 ~ 0.10000 = 1/10
-    27,  // -20.5 dB: 0.09441 ~ 0.09441 = 27/286
-    109, // -21.0 dB: 0.08913 ~ 0.08913 = 109/1223
-    87,  // -21.5 dB: 0.08414 ~ 0.08414 = 87/1034
-    56,  // -22.0 dB: 0.07943 ~ 0.07943 = 56/705
-    128, // -22.5 dB: 0.07499 ~ 0.07499 = 128/1707
-    8,   // -23.0 dB: 0.07079 ~ 0.07080 = 8/113
-    53,  // -23.5 dB: 0.06683 ~ 0.06683 = 53/793
-    86,  // -24.0 dB: 0.06310 ~ 0.06310 = 86/1363
-    118, // -24.5 dB: 0.05957 ~ 0.05957 = 118/1981
-    23,  // -25.0 dB: 0.05623 ~ 0.05623 = 23/409
-    104, // -25.5 dB: 0.05309 ~ 0.05309 = 104/1959
-    127, // -26.0 dB: 0.05012 ~ 0.05012 = 127/2534
-    126, // -26.5 dB: 0.04732 ~ 0.04732 = 126/2663
-    31,  // -27.0 dB: 0.04467 ~ 0.04467 = 31/694
-    7,   // -27.5 dB: 0.04217 ~ 0.04217 = 7/166
-    101, // -28.0 dB: 0.03981 ~ 0.03981 = 101/2537
-    28,  // -28.5 dB: 0.03758 ~ 0.03758 = 28/745
-    87,  // -29.0 dB: 0.03548 ~ 0.03548 = 87/2452
-    89,  // -29.5 dB: 0.03350 ~ 0.03350 = 89/2657
-    114, // -30.0 dB: 0.03162 ~ 0.03162 = 114/3605
-    127, // -30.5 dB: 0.02985 ~ 0.02985 = 127/4254
-    27,  // -31.0 dB: 0.02818 ~ 0.02818 = 27/958
-    125, // -31.5 dB: 0.02661 ~ 0.02661 = 125/4698
-    37,  // -32.0 dB: 0.02512 ~ 0.02512 = 37/1473
-    112, // -32.5 dB: 0.02371 ~ 0.02371 = 112/4723
-    127, // -33.0 dB: 0.02239 ~ 0.02239 = 127/5673
-    73,  // -33.5 dB: 0.02113 ~ 0.02113 = 73/3454
-    59,  // -34.0 dB: 0.01995 ~ 0.01995 = 59/2957
-    113, // -34.5 dB: 0.01884 ~ 0.01884 = 113/5999
-    47,  // -35.0 dB: 0.01778 ~ 0.01778 = 47/2643
-    83,  // -35.5 dB: 0.01679 ~ 0.01679 = 83/4944
-    94,  // -36.0 dB: 0.01585 ~ 0.01585 = 94/5931
-    127, // -36.5 dB: 0.01496 ~ 0.01496 = 127/8488
-    73,  // -37.0 dB: 0.01413 ~ 0.01413 = 73/5168
-    95,  // -37.5 dB: 0.01334 ~ 0.01334 = 95/7124
-    67,  // -38.0 dB: 0.01259 ~ 0.01259 = 67/5322
-    43,  // -38.5 dB: 0.01189 ~ 0.01189 = 43/3618
-    8,   // -39.0 dB: 0.01122 ~ 0.01122 = 8/713
-    101, // -39.5 dB: 0.01059 ~ 0.01059 = 101/9535
-    1,   // -40.0 dB: 0.01000 ~ 0.01000 = 1/100
-    67,  // -40.5 dB: 0.00944 ~ 0.00944 = 67/7097
-    109, // -41.0 dB: 0.00891 ~ 0.00891 = 109/12230
-    127, // -41.5 dB: 0.00841 ~ 0.00841 = 127/15094
-    121, // -42.0 dB: 0.00794 ~ 0.00794 = 121/15233
-    71,  // -42.5 dB: 0.00750 ~ 0.00750 = 71/9468
-    67,  // -43.0 dB: 0.00708 ~ 0.00708 = 67/9464
-    85,  // -43.5 dB: 0.00668 ~ 0.00668 = 85/12718
-    47,  // -44.0 dB: 0.00631 ~ 0.00631 = 47/7449
-    92,  // -44.5 dB: 0.00596 ~ 0.00596 = 92/15445
-    93,  // -45.0 dB: 0.00562 ~ 0.00562 = 93/16538
-    74,  // -45.5 dB: 0.00531 ~ 0.00531 = 74/13939
-    19,  // -46.0 dB: 0.00501 ~ 0.00501 = 19/3791
-    43,  // -46.5 dB: 0.00473 ~ 0.00473 = 43/9088
-    86,  // -47.0 dB: 0.00447 ~ 0.00447 = 86/19253
-    51,  // -47.5 dB: 0.00422 ~ 0.00422 = 51/12094
-    53,  // -48.0 dB: 0.00398 ~ 0.00398 = 53/13313
-    69,  // -48.5 dB: 0.00376 ~ 0.00376 = 69/18359
-    68,  // -49.0 dB: 0.00355 ~ 0.00355 = 68/19165
-    13   // -49.5 dB: 0.00335 ~ 0.00335 = 13/3881
+    32768, //   0.000 dB: 1.00000
+    32300, //  -0.125 dB: 0.98572
+    31838, //  -0.250 dB: 0.97162
+    31383, //  -0.375 dB: 0.95773
+    30935, //  -0.500 dB: 0.94406
+    30493, //  -0.625 dB: 0.93057
+    30057, //  -0.750 dB: 0.91727
+    29628, //  -0.875 dB: 0.90417
+    29205, //  -1.000 dB: 0.89127
+    28787, //  -1.125 dB: 0.87851
+    28376, //  -1.250 dB: 0.86597
+    27970, //  -1.375 dB: 0.85358
+    27571, //  -1.500 dB: 0.84140
+    27177, //  -1.625 dB: 0.82938
+    26789, //  -1.750 dB: 0.81754
+    26406, //  -1.875 dB: 0.80585
+    26029, //  -2.000 dB: 0.79434
+    25657, //  -2.125 dB: 0.78299
+    25290, //  -2.250 dB: 0.77179
+    24929, //  -2.375 dB: 0.76077
+    24573, //  -2.500 dB: 0.74991
+    24221, //  -2.625 dB: 0.73917
+    23875, //  -2.750 dB: 0.72861
+    23534, //  -2.875 dB: 0.71820
+    23198, //  -3.000 dB: 0.70795
+    22867, //  -3.125 dB: 0.69785
+    22540, //  -3.250 dB: 0.68787
+    22218, //  -3.375 dB: 0.67804
+    21900, //  -3.500 dB: 0.66833
+    21587, //  -3.625 dB: 0.65878
+    21279, //  -3.750 dB: 0.64938
+    20975, //  -3.875 dB: 0.64011
+    20675, //  -4.000 dB: 0.63095
+    20380, //  -4.125 dB: 0.62195
+    20089, //  -4.250 dB: 0.61307
+    19802, //  -4.375 dB: 0.60431
+    19519, //  -4.500 dB: 0.59567
+    19240, //  -4.625 dB: 0.58716
+    18965, //  -4.750 dB: 0.57877
+    18694, //  -4.875 dB: 0.57050
+    18427, //  -5.000 dB: 0.56235
+    18164, //  -5.125 dB: 0.55432
+    17904, //  -5.250 dB: 0.54639
+    17648, //  -5.375 dB: 0.53857
+    17396, //  -5.500 dB: 0.53088
+    17147, //  -5.625 dB: 0.52328
+    16902, //  -5.750 dB: 0.51581
+    16661, //  -5.875 dB: 0.50845
+    16423, //  -6.000 dB: 0.50119
+    16188, //  -6.125 dB: 0.49402
+    15957, //  -6.250 dB: 0.48697
+    15729, //  -6.375 dB: 0.48001
+    15504, //  -6.500 dB: 0.47314
+    15283, //  -6.625 dB: 0.46640
+    15064, //  -6.750 dB: 0.45972
+    14849, //  -6.875 dB: 0.45316
+    14637, //  -7.000 dB: 0.44669
+    14428, //  -7.125 dB: 0.44031
+    14222, //  -7.250 dB: 0.43402
+    14018, //  -7.375 dB: 0.42780
+    13818, //  -7.500 dB: 0.42169
+    13621, //  -7.625 dB: 0.41568
+    13426, //  -7.750 dB: 0.40973
+    13234, //  -7.875 dB: 0.40387
+    13045, //  -8.000 dB: 0.39810
+    12859, //  -8.125 dB: 0.39243
+    12675, //  -8.250 dB: 0.38681
+    12494, //  -8.375 dB: 0.38129
+    12315, //  -8.500 dB: 0.37582
+    12139, //  -8.625 dB: 0.37045
+    11966, //  -8.750 dB: 0.36517
+    11795, //  -8.875 dB: 0.35995
+    11627, //  -9.000 dB: 0.35483
+    11460, //  -9.125 dB: 0.34973
+    11297, //  -9.250 dB: 0.34476
+    11135, //  -9.375 dB: 0.33981
+    10976, //  -9.500 dB: 0.33496
+    10819, //  -9.625 dB: 0.33017
+    10665, //  -9.750 dB: 0.32547
+    10512, //  -9.875 dB: 0.32080
+    10362, // -10.000 dB: 0.31622
+    10214, // -10.125 dB: 0.31171
+    10068, // -10.250 dB: 0.30725
+     9924, // -10.375 dB: 0.30286
+     9783, // -10.500 dB: 0.29855
+     9643, // -10.625 dB: 0.29428
+     9505, // -10.750 dB: 0.29007
+     9369, // -10.875 dB: 0.28592
+     9235, // -11.000 dB: 0.28183
+     9103, // -11.125 dB: 0.27780
+     8973, // -11.250 dB: 0.27383
+     8845, // -11.375 dB: 0.26993
+     8719, // -11.500 dB: 0.26608
+     8594, // -11.625 dB: 0.26227
+     8471, // -11.750 dB: 0.25851
+     8350, // -11.875 dB: 0.25482
+     8231, // -12.000 dB: 0.25119
+     8113, // -12.125 dB: 0.24759
+     7997, // -12.250 dB: 0.24405
+     7883, // -12.375 dB: 0.24057
+     7771, // -12.500 dB: 0.23715
+     7659, // -12.625 dB: 0.23373
+     7550, // -12.750 dB: 0.23041
+     7442, // -12.875 dB: 0.22711
+     7336, // -13.000 dB: 0.22388
+     7231, // -13.125 dB: 0.22067
+     7128, // -13.250 dB: 0.21753
+     7026, // -13.375 dB: 0.21442
+     6925, // -13.500 dB: 0.21133
+     6827, // -13.625 dB: 0.20834
+     6729, // -13.750 dB: 0.20535
+     6633, // -13.875 dB: 0.20242
+     6538, // -14.000 dB: 0.19952
+     6445, // -14.125 dB: 0.19669
+     6353, // -14.250 dB: 0.19388
+     6262, // -14.375 dB: 0.19110
+     6172, // -14.500 dB: 0.18835
+     6084, // -14.625 dB: 0.18567
+     5997, // -14.750 dB: 0.18301
+     5912, // -14.875 dB: 0.18042
+     5827, // -15.000 dB: 0.17783
+     5744, // -15.125 dB: 0.17529
+     5662, // -15.250 dB: 0.17279
+     5581, // -15.375 dB: 0.17032
+     5501, // -15.500 dB: 0.16788
+     5423, // -15.625 dB: 0.16550
+     5345, // -15.750 dB: 0.16312
+     5269, // -15.875 dB: 0.16080
+     5193, // -16.000 dB: 0.15848
+     5119, // -16.125 dB: 0.15622
+     5046, // -16.250 dB: 0.15399
+     4974, // -16.375 dB: 0.15179
+     4903, // -16.500 dB: 0.14963
+     4833, // -16.625 dB: 0.14749
+     4764, // -16.750 dB: 0.14539
+     4696, // -16.875 dB: 0.14331
+     4629, // -17.000 dB: 0.14127
+     4562, // -17.125 dB: 0.13922
+     4497, // -17.250 dB: 0.13724
+     4433, // -17.375 dB: 0.13528
+     4370, // -17.500 dB: 0.13336
+     4307, // -17.625 dB: 0.13144
+     4246, // -17.750 dB: 0.12958
+     4185, // -17.875 dB: 0.12772
+     4125, // -18.000 dB: 0.12589
+     4066, // -18.125 dB: 0.12408
+     4008, // -18.250 dB: 0.12231
+     3951, // -18.375 dB: 0.12057
+     3894, // -18.500 dB: 0.11884
+     3839, // -18.625 dB: 0.11716
+     3784, // -18.750 dB: 0.11548
+     3730, // -18.875 dB: 0.11383
+     3677, // -19.000 dB: 0.11221
+     3624, // -19.125 dB: 0.11060
+     3572, // -19.250 dB: 0.10901
+     3521, // -19.375 dB: 0.10745
+     3471, // -19.500 dB: 0.10593
+     3421, // -19.625 dB: 0.10440
+     3372, // -19.750 dB: 0.10291
+     3324, // -19.875 dB: 0.10144
+     3277, // -20.000 dB: 0.10001
+     3230, // -20.125 dB: 0.09857
+     3184, // -20.250 dB: 0.09717
+     3138, // -20.375 dB: 0.09576
+     3093, // -20.500 dB: 0.09439
+     3049, // -20.625 dB: 0.09305
+     3006, // -20.750 dB: 0.09174
+     2963, // -20.875 dB: 0.09042
+     2920, // -21.000 dB: 0.08911
+     2879, // -21.125 dB: 0.08786
+     2838, // -21.250 dB: 0.08661
+     2797, // -21.375 dB: 0.08536
+     2757, // -21.500 dB: 0.08414
+     2718, // -21.625 dB: 0.08295
+     2679, // -21.750 dB: 0.08176
+     2641, // -21.875 dB: 0.08060
+     2603, // -22.000 dB: 0.07944
+     2566, // -22.125 dB: 0.07831
+     2529, // -22.250 dB: 0.07718
+     2493, // -22.375 dB: 0.07608
+     2457, // -22.500 dB: 0.07498
+     2422, // -22.625 dB: 0.07391
+     2388, // -22.750 dB: 0.07288
+     2353, // -22.875 dB: 0.07181
+     2320, // -23.000 dB: 0.07080
+     2287, // -23.125 dB: 0.06979
+     2254, // -23.250 dB: 0.06879
+     2222, // -23.375 dB: 0.06781
+     2190, // -23.500 dB: 0.06683
+     2159, // -23.625 dB: 0.06589
+     2128, // -23.750 dB: 0.06494
+     2097, // -23.875 dB: 0.06400
+     2068, // -24.000 dB: 0.06311
+     2038, // -24.125 dB: 0.06219
+     2009, // -24.250 dB: 0.06131
+     1980, // -24.375 dB: 0.06042
+     1952, // -24.500 dB: 0.05957
+     1924, // -24.625 dB: 0.05872
+     1896, // -24.750 dB: 0.05786
+     1869, // -24.875 dB: 0.05704
+     1843, // -25.000 dB: 0.05624
+     1816, // -25.125 dB: 0.05542
+     1790, // -25.250 dB: 0.05463
+     1765, // -25.375 dB: 0.05386
+     1740, // -25.500 dB: 0.05310
+     1715, // -25.625 dB: 0.05234
+     1690, // -25.750 dB: 0.05157
+     1666, // -25.875 dB: 0.05084
+     1642, // -26.000 dB: 0.05011
+     1619, // -26.125 dB: 0.04941
+     1596, // -26.250 dB: 0.04871
+     1573, // -26.375 dB: 0.04800
+     1550, // -26.500 dB: 0.04730
+     1528, // -26.625 dB: 0.04663
+     1506, // -26.750 dB: 0.04596
+     1485, // -26.875 dB: 0.04532
+     1464, // -27.000 dB: 0.04468
+     1443, // -27.125 dB: 0.04404
+     1422, // -27.250 dB: 0.04340
+     1402, // -27.375 dB: 0.04279
+     1382, // -27.500 dB: 0.04218
+     1362, // -27.625 dB: 0.04156
+     1343, // -27.750 dB: 0.04099
+     1323, // -27.875 dB: 0.04037
+     1305, // -28.000 dB: 0.03983
+     1286, // -28.125 dB: 0.03925
+     1268, // -28.250 dB: 0.03870
+     1249, // -28.375 dB: 0.03812
+     1232, // -28.500 dB: 0.03760
+     1214, // -28.625 dB: 0.03705
+     1197, // -28.750 dB: 0.03653
+     1180, // -28.875 dB: 0.03601
+     1163, // -29.000 dB: 0.03549
+     1146, // -29.125 dB: 0.03497
+     1130, // -29.250 dB: 0.03448
+     1114, // -29.375 dB: 0.03400
+     1098, // -29.500 dB: 0.03351
+     1082, // -29.625 dB: 0.03302
+     1066, // -29.750 dB: 0.03253
+     1051, // -29.875 dB: 0.03207
+     1036, // -30.000 dB: 0.03162
+     1021, // -30.125 dB: 0.03116
+     1007, // -30.250 dB: 0.03073
+      992, // -30.375 dB: 0.03027
+      978, // -30.500 dB: 0.02985
+      964, // -30.625 dB: 0.02942
+      950, // -30.750 dB: 0.02899
+      937, // -30.875 dB: 0.02859
+      924, // -31.000 dB: 0.02820
+      910, // -31.125 dB: 0.02777
+      897, // -31.250 dB: 0.02737
+      885, // -31.375 dB: 0.02701
+      872, // -31.500 dB: 0.02661
+      859, // -31.625 dB: 0.02621
+      847, // -31.750 dB: 0.02585
+      835, // -31.875 dB: 0.02548
+      823, // -32.000 dB: 0.02512
+      811, // -32.125 dB: 0.02475
+      800, // -32.250 dB: 0.02441
+      788, // -32.375 dB: 0.02405
+      777, // -32.500 dB: 0.02371
+      766, // -32.625 dB: 0.02338
+      755, // -32.750 dB: 0.02304
+      744, // -32.875 dB: 0.02271
+      734, // -33.000 dB: 0.02240
+      723, // -33.125 dB: 0.02206
+      713, // -33.250 dB: 0.02176
+      703, // -33.375 dB: 0.02145
+      693, // -33.500 dB: 0.02115
+      683, // -33.625 dB: 0.02084
+      673, // -33.750 dB: 0.02054
+      663, // -33.875 dB: 0.02023
+      654, // -34.000 dB: 0.01996
+      644, // -34.125 dB: 0.01965
+      635, // -34.250 dB: 0.01938
+      626, // -34.375 dB: 0.01910
+      617, // -34.500 dB: 0.01883
+      608, // -34.625 dB: 0.01855
+      600, // -34.750 dB: 0.01831
+      591, // -34.875 dB: 0.01804
+      583, // -35.000 dB: 0.01779
+      574, // -35.125 dB: 0.01752
+      566, // -35.250 dB: 0.01727
+      558, // -35.375 dB: 0.01703
+      550, // -35.500 dB: 0.01678
+      542, // -35.625 dB: 0.01654
+      535, // -35.750 dB: 0.01633
+      527, // -35.875 dB: 0.01608
+      519, // -36.000 dB: 0.01584
+      512, // -36.125 dB: 0.01562
+      505, // -36.250 dB: 0.01541
+      497, // -36.375 dB: 0.01517
+      490, // -36.500 dB: 0.01495
+      483, // -36.625 dB: 0.01474
+      476, // -36.750 dB: 0.01453
+      470, // -36.875 dB: 0.01434
+      463, // -37.000 dB: 0.01413
+      456, // -37.125 dB: 0.01392
+      450, // -37.250 dB: 0.01373
+      443, // -37.375 dB: 0.01352
+      437, // -37.500 dB: 0.01334
+      431, // -37.625 dB: 0.01315
+      425, // -37.750 dB: 0.01297
+      419, // -37.875 dB: 0.01279
+      413, // -38.000 dB: 0.01260
+      407, // -38.125 dB: 0.01242
+      401, // -38.250 dB: 0.01224
+      395, // -38.375 dB: 0.01205
+      389, // -38.500 dB: 0.01187
+      384, // -38.625 dB: 0.01172
+      378, // -38.750 dB: 0.01154
+      373, // -38.875 dB: 0.01138
+      368, // -39.000 dB: 0.01123
+      362, // -39.125 dB: 0.01105
+      357, // -39.250 dB: 0.01089
+      352, // -39.375 dB: 0.01074
+      347, // -39.500 dB: 0.01059
+      342, // -39.625 dB: 0.01044
+      337, // -39.750 dB: 0.01028
+      332, // -39.875 dB: 0.01013
+      328, // -40.000 dB: 0.01001
+      323, // -40.125 dB: 0.00986
+      318, // -40.250 dB: 0.00970
+      314, // -40.375 dB: 0.00958
+      309, // -40.500 dB: 0.00943
+      305, // -40.625 dB: 0.00931
+      301, // -40.750 dB: 0.00919
+      296, // -40.875 dB: 0.00903
+      292, // -41.000 dB: 0.00891
+      288, // -41.125 dB: 0.00879
+      284, // -41.250 dB: 0.00867
+      280, // -41.375 dB: 0.00854
+      276, // -41.500 dB: 0.00842
+      272, // -41.625 dB: 0.00830
+      268, // -41.750 dB: 0.00818
+      264, // -41.875 dB: 0.00806
+      260, // -42.000 dB: 0.00793
+      257, // -42.125 dB: 0.00784
+      253, // -42.250 dB: 0.00772
+      249, // -42.375 dB: 0.00760
+      246, // -42.500 dB: 0.00751
+      242, // -42.625 dB: 0.00739
+      239, // -42.750 dB: 0.00729
+      235, // -42.875 dB: 0.00717
+      232, // -43.000 dB: 0.00708
+      229, // -43.125 dB: 0.00699
+      225, // -43.250 dB: 0.00687
+      222, // -43.375 dB: 0.00677
+      219, // -43.500 dB: 0.00668
+      216, // -43.625 dB: 0.00659
+      213, // -43.750 dB: 0.00650
+      210, // -43.875 dB: 0.00641
+      207, // -44.000 dB: 0.00632
+      204, // -44.125 dB: 0.00623
+      201, // -44.250 dB: 0.00613
+      198, // -44.375 dB: 0.00604
+      195, // -44.500 dB: 0.00595
+      192, // -44.625 dB: 0.00586
+      190, // -44.750 dB: 0.00580
+      187, // -44.875 dB: 0.00571
+      184, // -45.000 dB: 0.00562
+      182, // -45.125 dB: 0.00555
+      179, // -45.250 dB: 0.00546
+      176, // -45.375 dB: 0.00537
+      174, // -45.500 dB: 0.00531
+      171, // -45.625 dB: 0.00522
+      169, // -45.750 dB: 0.00516
+      167, // -45.875 dB: 0.00510
+      164, // -46.000 dB: 0.00500
+      162, // -46.125 dB: 0.00494
+      160, // -46.250 dB: 0.00488
+      157, // -46.375 dB: 0.00479
+      155, // -46.500 dB: 0.00473
+      153, // -46.625 dB: 0.00467
+      151, // -46.750 dB: 0.00461
+      148, // -46.875 dB: 0.00452
+      146, // -47.000 dB: 0.00446
+      144, // -47.125 dB: 0.00439
+      142, // -47.250 dB: 0.00433
+      140, // -47.375 dB: 0.00427
+      138, // -47.500 dB: 0.00421
+      136, // -47.625 dB: 0.00415
+      134, // -47.750 dB: 0.00409
+      132, // -47.875 dB: 0.00403
+      130, // -48.000 dB: 0.00397
+      129, // -48.125 dB: 0.00394
+      127, // -48.250 dB: 0.00388
+      125, // -48.375 dB: 0.00381
+      123, // -48.500 dB: 0.00375
+      121, // -48.625 dB: 0.00369
+      120, // -48.750 dB: 0.00366
+      118, // -48.875 dB: 0.00360
+      116, // -49.000 dB: 0.00354
+      115, // -49.125 dB: 0.00351
+      113, // -49.250 dB: 0.00345
+      111, // -49.375 dB: 0.00339
+      110, // -49.500 dB: 0.00336
+      108, // -49.625 dB: 0.00330
+      107, // -49.750 dB: 0.00327
+      105  // -49.875 dB: 0.00320
 };
-
-static const int32_t volumeLutDenominator[100] = 
-{
-    1,     //   0.0 dB: 1.00000 ~ 1.00000 = 1/1
-    125,   //  -0.5 dB: 0.94406 ~ 0.94400 = 118/125
-    46,    //  -1.0 dB: 0.89125 ~ 0.89130 = 41/46
-    145,   //  -1.5 dB: 0.84140 ~ 0.84138 = 122/145
-    141,   //  -2.0 dB: 0.79433 ~ 0.79433 = 112/141
-    4,     //  -2.5 dB: 0.74989 ~ 0.75000 = 3/4
-    113,   //  -3.0 dB: 0.70795 ~ 0.70796 = 80/113
-    190,   //  -3.5 dB: 0.66834 ~ 0.66842 = 127/190
-    84,    //  -4.0 dB: 0.63096 ~ 0.63095 = 53/84
-    183,   //  -4.5 dB: 0.59566 ~ 0.59563 = 109/183
-    217,   //  -5.0 dB: 0.56234 ~ 0.56221 = 122/217
-    81,    //  -5.5 dB: 0.53088 ~ 0.53086 = 43/81
-    255,   //  -6.0 dB: 0.50119 ~ 0.50196 = 128/255
-    205,   //  -6.5 dB: 0.47315 ~ 0.47317 = 97/205
-    197,   //  -7.0 dB: 0.44668 ~ 0.44670 = 88/197
-    83,    //  -7.5 dB: 0.42170 ~ 0.42169 = 35/83
-    211,   //  -8.0 dB: 0.39811 ~ 0.39810 = 84/211
-    149,   //  -8.5 dB: 0.37584 ~ 0.37584 = 56/149
-    31,    //  -9.0 dB: 0.35481 ~ 0.35484 = 11/31
-    203,   //  -9.5 dB: 0.33497 ~ 0.33498 = 68/203
-    117,   // -10.0 dB: 0.31623 ~ 0.31624 = 37/117
-    412,   // -10.5 dB: 0.29854 ~ 0.29854 = 123/412
-    369,   // -11.0 dB: 0.28184 ~ 0.28184 = 104/369
-    451,   // -11.5 dB: 0.26607 ~ 0.26608 = 120/451
-    211,   // -12.0 dB: 0.25119 ~ 0.25118 = 53/211
-    447,   // -12.5 dB: 0.23714 ~ 0.23714 = 106/447
-    67,    // -13.0 dB: 0.22387 ~ 0.22388 = 15/67
-    511,   // -13.5 dB: 0.21135 ~ 0.21135 = 108/511
-    421,   // -14.0 dB: 0.19953 ~ 0.19952 = 84/421
-    361,   // -14.5 dB: 0.18836 ~ 0.18837 = 68/361
-    433,   // -15.0 dB: 0.17783 ~ 0.17783 = 77/433
-    137,   // -15.5 dB: 0.16788 ~ 0.16788 = 23/137
-    265,   // -16.0 dB: 0.15849 ~ 0.15849 = 42/265
-    528,   // -16.5 dB: 0.14962 ~ 0.14962 = 79/528
-    623,   // -17.0 dB: 0.14125 ~ 0.14125 = 88/623
-    15,    // -17.5 dB: 0.13335 ~ 0.13333 = 2/15
-    699,   // -18.0 dB: 0.12589 ~ 0.12589 = 88/699
-    1077,  // -18.5 dB: 0.11885 ~ 0.11885 = 128/1077
-    713,   // -19.0 dB: 0.11220 ~ 0.11220 = 80/713
-    557,   // -19.5 dB: 0.10593 ~ 0.10592 = 59/557
-    10,    // -20.0 dB: 0.10000 ~ 0.10000 = 1/10
-    286,   // -20.5 dB: 0.09441 ~ 0.09441 = 27/286
-    1223,  // -21.0 dB: 0.08913 ~ 0.08913 = 109/1223
-    1034,  // -21.5 dB: 0.08414 ~ 0.08414 = 87/1034
-    705,   // -22.0 dB: 0.07943 ~ 0.07943 = 56/705
-    1707,  // -22.5 dB: 0.07499 ~ 0.07499 = 128/1707
-    113,   // -23.0 dB: 0.07079 ~ 0.07080 = 8/113
-    793,   // -23.5 dB: 0.06683 ~ 0.06683 = 53/793
-    1363,  // -24.0 dB: 0.06310 ~ 0.06310 = 86/1363
-    1981,  // -24.5 dB: 0.05957 ~ 0.05957 = 118/1981
-    409,   // -25.0 dB: 0.05623 ~ 0.05623 = 23/409
-    1959,  // -25.5 dB: 0.05309 ~ 0.05309 = 104/1959
-    2534,  // -26.0 dB: 0.05012 ~ 0.05012 = 127/2534
-    2663,  // -26.5 dB: 0.04732 ~ 0.04732 = 126/2663
-    694,   // -27.0 dB: 0.04467 ~ 0.04467 = 31/694
-    166,   // -27.5 dB: 0.04217 ~ 0.04217 = 7/166
-    2537,  // -28.0 dB: 0.03981 ~ 0.03981 = 101/2537
-    745,   // -28.5 dB: 0.03758 ~ 0.03758 = 28/745
-    2452,  // -29.0 dB: 0.03548 ~ 0.03548 = 87/2452
-    2657,  // -29.5 dB: 0.03350 ~ 0.03350 = 89/2657
-    3605,  // -30.0 dB: 0.03162 ~ 0.03162 = 114/3605
-    4254,  // -30.5 dB: 0.02985 ~ 0.02985 = 127/4254
-    958,   // -31.0 dB: 0.02818 ~ 0.02818 = 27/958
-    4698,  // -31.5 dB: 0.02661 ~ 0.02661 = 125/4698
-    1473,  // -32.0 dB: 0.02512 ~ 0.02512 = 37/1473
-    4723,  // -32.5 dB: 0.02371 ~ 0.02371 = 112/4723
-    5673,  // -33.0 dB: 0.02239 ~ 0.02239 = 127/5673
-    3454,  // -33.5 dB: 0.02113 ~ 0.02113 = 73/3454
-    2957,  // -34.0 dB: 0.01995 ~ 0.01995 = 59/2957
-    5999,  // -34.5 dB: 0.01884 ~ 0.01884 = 113/5999
-    2643,  // -35.0 dB: 0.01778 ~ 0.01778 = 47/2643
-    4944,  // -35.5 dB: 0.01679 ~ 0.01679 = 83/4944
-    5931,  // -36.0 dB: 0.01585 ~ 0.01585 = 94/5931
-    8488,  // -36.5 dB: 0.01496 ~ 0.01496 = 127/8488
-    5168,  // -37.0 dB: 0.01413 ~ 0.01413 = 73/5168
-    7124,  // -37.5 dB: 0.01334 ~ 0.01334 = 95/7124
-    5322,  // -38.0 dB: 0.01259 ~ 0.01259 = 67/5322
-    3618,  // -38.5 dB: 0.01189 ~ 0.01189 = 43/3618
-    713,   // -39.0 dB: 0.01122 ~ 0.01122 = 8/713
-    9535,  // -39.5 dB: 0.01059 ~ 0.01059 = 101/9535
-    100,   // -40.0 dB: 0.01000 ~ 0.01000 = 1/100
-    7097,  // -40.5 dB: 0.00944 ~ 0.00944 = 67/7097
-    12230, // -41.0 dB: 0.00891 ~ 0.00891 = 109/12230
-    15094, // -41.5 dB: 0.00841 ~ 0.00841 = 127/15094
-    15233, // -42.0 dB: 0.00794 ~ 0.00794 = 121/15233
-    9468,  // -42.5 dB: 0.00750 ~ 0.00750 = 71/9468
-    9464,  // -43.0 dB: 0.00708 ~ 0.00708 = 67/9464
-    12718, // -43.5 dB: 0.00668 ~ 0.00668 = 85/12718
-    7449,  // -44.0 dB: 0.00631 ~ 0.00631 = 47/7449
-    15445, // -44.5 dB: 0.00596 ~ 0.00596 = 92/15445
-    16538, // -45.0 dB: 0.00562 ~ 0.00562 = 93/16538
-    13939, // -45.5 dB: 0.00531 ~ 0.00531 = 74/13939
-    3791,  // -46.0 dB: 0.00501 ~ 0.00501 = 19/3791
-    9088,  // -46.5 dB: 0.00473 ~ 0.00473 = 43/9088
-    19253, // -47.0 dB: 0.00447 ~ 0.00447 = 86/19253
-    12094, // -47.5 dB: 0.00422 ~ 0.00422 = 51/12094
-    13313, // -48.0 dB: 0.00398 ~ 0.00398 = 53/13313
-    18359, // -48.5 dB: 0.00376 ~ 0.00376 = 69/18359
-    19165, // -49.0 dB: 0.00355 ~ 0.00355 = 68/19165
-    3881   // -49.5 dB: 0.00335 ~ 0.00335 = 13/3881
-};
\ No newline at end of file